@@ -61,6 +61,22 @@ NS_ASSUME_NONNULL_BEGIN
  */
 - (NSString *)uuid;
 
+/**
+ @brief      Retrieve client's performance counters and gauges.
+ @discussion Metrics include listeners events queue depth (\c events.queue.depth) and number of events which
+             has been dropped (\c events.dropped) or coalesced (\c events.coalesced) because of queue overflow.
+             Non-subscribe requests scheduler report number of waiting (\c network.<lane>.queue.depth) and
+             active (\c network.<lane>.active) requests for each priority class. Response cache report
+             number of calls which has been served from cache (\c cache.hits) or sent to \b PubNub network
+             (\c cache.misses) and number of calls which has been attached to identical in-flight request
+             (\c requests.coalesced).
+ 
+ @return Dictionary where each metric name is mapped to it's latest value.
+ 
+ @since 4.8.2
+ */
+- (NSDictionary<NSString *, NSNumber *> *)metrics;
+
 
 ///------------------------------------------------
 /// @name Initialization
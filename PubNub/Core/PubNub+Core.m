@@ -21,6 +21,7 @@
 #import "PubNub+SubscribePrivate.h"
 #import "PNObjectEventListener.h"
 #import "PNPrivateStructures.h"
+#import "PNRequestHandle+Private.h"
 #import "PNClientInformation.h"
 #import "PNRequestParameters.h"
 #import "PNSubscribeStatus.h"
@@ -28,6 +29,10 @@
 #import "PNStatus+Private.h"
 #import "PNConfiguration.h"
 #import "PNReachability.h"
+#import "PNResponseCache.h"
+#import "PNRetryPolicy.h"
+#import "PNRetryBudget.h"
+#import "PNSharedRequest.h"
 #import "PNConstants.h"
 #import "PNKeychain.h"
 #import "PNLogMacro.h"
@@ -112,6 +117,13 @@ NS_ASSUME_NONNULL_BEGIN
  */
 @property (nonatomic, strong) PNReachability *reachability;
 
+/**
+ @brief  Stores reference on budget which limit number of automatic non-subscribe request retry attempts.
+
+ @since 4.8.2
+ */
+@property (nonatomic, strong) PNRetryBudget *requestRetryBudget;
+
 
 #pragma mark - Initialization
 
@@ -153,6 +165,59 @@ NS_ASSUME_NONNULL_BEGIN
 - (void)prepareNetworkManagers;
 
 
+#pragma mark - Operation processing
+
+/**
+ @brief      Compose request to \b PubNub network and retry it in case of failure.
+ @discussion Completion block called only when request succeed or client decided not to retry it anymore.
+
+ @param operationType One of \b PNOperationType enum fields which represent type of operation which be issued
+                      to \b PubNub network.
+ @param parameters    Resource and query path fields wrapped into object.
+ @param data          Reference on data which should be pushed to \b PubNub network.
+ @param policy        Reference on policy which calculate delay before next attempt and track number of
+                      attempts for this API call.
+ @param deadline      Reference on date after which retry attempts shouldn't be done.
+ @param block         Reference on operation processing completion block.
+
+ @return Reference on handle which can be used to cancel first attempt.
+
+ @since 4.8.2
+ */
+- (nullable PNRequestHandle *)processOperation:(PNOperationType)operationType
+                                withParameters:(PNRequestParameters *)parameters
+                                          data:(nullable NSData *)data retryPolicy:(PNRetryPolicy *)policy
+                                      deadline:(NSDate *)deadline completionBlock:(nullable id)block;
+
+/**
+ @brief  Retrieve maximum number of automatic retry attempts for operation.
+
+ @param operationType One of \b PNOperationType enum fields for which number of attempts should be found.
+ @param parameters    Resource and query path fields which will be used to compose request.
+
+ @return Number of attempts or \b 0 in case if operation not configured for retry or can't be safely sent
+         again.
+
+ @since 4.8.2
+ */
+- (NSUInteger)retryAttemptsForOperation:(PNOperationType)operationType
+                         withParameters:(PNRequestParameters *)parameters;
+
+/**
+ @brief  Calculate delay before next attempt of failed request.
+
+ @param status   Reference on request processing status (\c nil for successful requests which provide result).
+ @param policy   Reference on policy which track attempts for this API call.
+ @param deadline Reference on date after which retry attempts shouldn't be done.
+
+ @return Delay in seconds or \b -1 in case if request shouldn't be retried.
+
+ @since 4.8.2
+ */
+- (NSTimeInterval)retryDelayForStatus:(nullable PNStatus *)status withRetryPolicy:(PNRetryPolicy *)policy
+                             deadline:(NSDate *)deadline;
+
+
 #pragma mark - Handlers
 
 /**
@@ -231,6 +296,15 @@ NS_ASSUME_NONNULL_END
     return self.configuration.uuid;
 }
 
+- (NSDictionary<NSString *, NSNumber *> *)metrics {
+    
+    NSMutableDictionary *metrics = [[self.telemetryManager metrics] mutableCopy];
+    [metrics addEntriesFromDictionary:[self.listenersManager metrics]];
+    [metrics addEntriesFromDictionary:[self.serviceNetwork metrics]];
+    
+    return [metrics copy];
+}
+
 
 #pragma mark - Initialization
 
@@ -280,6 +354,7 @@ NS_ASSUME_NONNULL_END
         _listenersManager = [PNStateListener stateListenerForClient:self];
         _heartbeatManager = [PNHeartbeat heartbeatForClient:self];
         _telemetryManager = [PNTelemetry new];
+        _requestRetryBudget = [PNRetryBudget budgetWithMaximumTokens:configuration.requestRetryBudget];
         [self addListener:self];
         [self prepareReachability];
 #if TARGET_OS_IOS
@@ -440,9 +515,16 @@ NS_ASSUME_NONNULL_END
 
     if (shouldCreateSubscriptionNetwork) {
         
+        // Each subscription shard require own long-poll connection.
+        BOOL shouldShardSubscription = _configuration.maximumSubscribeRequestURLLength > 0;
+        NSInteger subscribeConnections = (shouldShardSubscription ? kPNMaximumSubscribeShardsCount : 1);
+        
+        // Watchdog probe shouldn't wait for long-poll request completion.
+        if (_configuration.subscribeWatchdogInterval > 0.f) { subscribeConnections++; }
         _subscriptionNetwork = [PNNetwork networkForClient:self
                                             requestTimeout:_configuration.subscribeMaximumIdleTime
-                                        maximumConnections:1 longPoll:YES];
+                                        maximumConnections:subscribeConnections
+                                                  longPoll:YES];
     }
 
 
@@ -450,30 +532,175 @@ NS_ASSUME_NONNULL_END
                                    requestTimeout:_configuration.nonSubscribeRequestTimeout
                                maximumConnections:maximumConnections
                                          longPoll:NO];
+    
+    if (_configuration.shouldWarmUpConnections) {
+        
+        [_subscriptionNetwork warmUpConnections];
+        [_serviceNetwork warmUpConnections];
+    }
 }
 
 
 #pragma mark - Operation processing
 
-- (void)processOperation:(PNOperationType)operationType withParameters:(PNRequestParameters *)parameters
-         completionBlock:(id)block {
+- (PNRequestHandle *)processOperation:(PNOperationType)operationType
+                       withParameters:(PNRequestParameters *)parameters completionBlock:(id)block {
 
-    [self processOperation:operationType withParameters:parameters data:nil completionBlock:block];
+    return [self processOperation:operationType withParameters:parameters data:nil completionBlock:block];
 }
 
-- (void)processOperation:(PNOperationType)operationType withParameters:(PNRequestParameters *)parameters 
-                    data:(NSData *)data completionBlock:(id)block {
+- (PNRequestHandle *)processOperation:(PNOperationType)operationType
+                       withParameters:(PNRequestParameters *)parameters data:(NSData *)data
+                      completionBlock:(id)block {
     
     if (operationType == PNSubscribeOperation || operationType == PNUnsubscribeOperation) {
         
-        [self.subscriptionNetwork processOperation:operationType withParameters:parameters
-                                              data:data completionBlock:block];
+        return [self.subscriptionNetwork processOperation:operationType withParameters:parameters
+                                                     data:data completionBlock:block];
     }
-    else {
+    
+    NSUInteger attempts = [self retryAttemptsForOperation:operationType withParameters:parameters];
+    if (attempts > 0) {
+
+        // Identical calls coalesced before retry, so attached callers will receive result of last attempt.
+        NSString *requestKey = nil;
+        if (block && !parameters.handle.deadline && !parameters.isFreshResponseRequired) {
+            requestKey = [self.serviceNetwork coalescingKeyForOperation:operationType withParameters:parameters];
+        }
+        if (requestKey) {
+
+            PNSharedRequest *sharedRequest = [self.serviceNetwork attachCompletionBlock:block
+                                                                             withHandle:parameters.handle
+                                                                       toRequestWithKey:requestKey
+                                                                           forOperation:operationType];
+            if (!sharedRequest) {
+
+                PNLogAPICall(self.logger, @"<PubNub::API> Attach %@ call to in-flight request.",
+                             PNOperationTypeStrings[operationType]);
+                [self.telemetryManager incrementMetric:@"requests.coalesced" by:1];
+
+                return parameters.handle;
+            }
+            block = [self.serviceNetwork completionBlockForSharedRequest:sharedRequest withKey:requestKey];
+            parameters.sharedRequest = sharedRequest;
+        }
+
+        PNRetryPolicy *policy = [PNRetryPolicy policyWithInitialDelay:kPNRequestRetryInitialDelay
+                                                         maximumDelay:kPNRequestRetryMaximumDelay
+                                                               budget:attempts];
+        NSDate *deadline = [NSDate dateWithTimeIntervalSinceNow:self.configuration.requestRetryDeadline];
+        if (parameters.handle.deadline) { deadline = [deadline earlierDate:parameters.handle.deadline]; }
         
-        [self.serviceNetwork processOperation:operationType withParameters:parameters
-                                         data:data completionBlock:block];
+        return [self processOperation:operationType withParameters:parameters data:data retryPolicy:policy
+                             deadline:deadline completionBlock:block];
     }
+    
+    return [self.serviceNetwork processOperation:operationType withParameters:parameters
+                                            data:data completionBlock:block];
+}
+
+- (PNRequestHandle *)processOperation:(PNOperationType)operationType
+                       withParameters:(PNRequestParameters *)parameters data:(NSData *)data
+                          retryPolicy:(PNRetryPolicy *)policy deadline:(NSDate *)deadline
+                      completionBlock:(id)block {
+    
+    __weak __typeof(self) weakSelf = self;
+    BOOL expectResult = [self.serviceNetwork operationExpectResult:operationType];
+    PNCompletionBlock handleCompletion = ^(PNResult *result, PNStatus *status) {
+        
+        __strong __typeof(self) strongSelf = weakSelf;
+        NSTimeInterval delay = -1.f;
+        // Request shared with identical API calls should be retried while any of them wait for results.
+        BOOL isAbandoned = (parameters.sharedRequest ? parameters.sharedRequest.isCancelled
+                                                     : parameters.handle.isAbandoned);
+        if (strongSelf && !isAbandoned) {
+            delay = [strongSelf retryDelayForStatus:status withRetryPolicy:policy deadline:deadline];
+        }
+        if (delay >= 0.f) {
+            
+            dispatch_queue_t queue = dispatch_get_global_queue(DISPATCH_QUEUE_PRIORITY_DEFAULT, 0);
+            dispatch_after(dispatch_time(DISPATCH_TIME_NOW, (int64_t)(delay * NSEC_PER_SEC)), queue, ^{
+                [weakSelf processOperation:operationType withParameters:parameters data:data
+                               retryPolicy:policy deadline:deadline completionBlock:block];
+            });
+            return;
+        }
+        
+        if (policy.attempts > 0 && !status.isError) {
+            
+            [strongSelf.telemetryManager incrementMetric:@"retry.succeeded" by:1];
+        }
+        
+        if (block) {
+            
+            if (expectResult) { ((PNCompletionBlock)block)(result, status); }
+            else { ((PNStatusBlock)block)(status); }
+        }
+    };
+    id completionBlock = handleCompletion;
+    if (!expectResult) { completionBlock = ^(PNStatus *status) { handleCompletion(nil, status); }; }
+    
+    return [self.serviceNetwork processOperation:operationType withParameters:parameters
+                                            data:data completionBlock:completionBlock];
+}
+
+- (NSUInteger)retryAttemptsForOperation:(PNOperationType)operationType
+                         withParameters:(PNRequestParameters *)parameters {
+    
+    static NSArray<NSNumber *> *_idempotentOperations;
+    static dispatch_once_t onceToken;
+    dispatch_once(&onceToken, ^{
+        
+        _idempotentOperations = @[
+            @(PNHistoryOperation), @(PNHistoryForChannelsOperation), @(PNDeleteMessageOperation),
+            @(PNHeartbeatOperation), @(PNSetStateOperation), @(PNAddChannelsToGroupOperation),
+            @(PNRemoveChannelsFromGroupOperation), @(PNRemoveGroupOperation),
+            @(PNAddPushNotificationsOnChannelsOperation), @(PNRemovePushNotificationsFromChannelsOperation),
+            @(PNRemoveAllPushNotificationsOperation)];
+    });
+    
+    NSUInteger attempts = self.configuration.requestRetryAttempts[@(operationType)].unsignedIntegerValue;
+    if (operationType == PNPublishOperation) {
+        
+        // Message can be sent again only with same sequence number, so duplicate can be recognized.
+        attempts = (parameters.query[@"seqn"] ? attempts : 0);
+    }
+    else if (![PNResponseCache isIdempotentReadOperation:operationType] &&
+             ![_idempotentOperations containsObject:@(operationType)]) {
+        
+        attempts = 0;
+    }
+    
+    return attempts;
+}
+
+- (NSTimeInterval)retryDelayForStatus:(PNStatus *)status withRetryPolicy:(PNRetryPolicy *)policy
+                             deadline:(NSDate *)deadline {
+    
+    if (!status.isError) {
+        
+        [self.requestRetryBudget recordSuccess];
+        return -1.f;
+    }
+    
+    BOOL isRetryable = (status.category == PNTimeoutCategory || status.category == PNNetworkIssuesCategory ||
+                        status.statusCode >= 500 || status.statusCode == 429);
+    NSTimeInterval delay = (isRetryable ? [policy nextDelay] : -1.f);
+    if (delay < 0.f || [deadline timeIntervalSinceNow] < delay) { return -1.f; }
+    
+    if (![self.requestRetryBudget consumeToken]) {
+        
+        PNLogAPICall(self.logger, @"<PubNub::API> Request retry budget exhausted.");
+        [self.telemetryManager incrementMetric:@"retry.budgetExhausted" by:1];
+        
+        return -1.f;
+    }
+    
+    PNLogAPICall(self.logger, @"<PubNub::API> Retry failed request in %.2f seconds (attempt %@).", delay,
+                 @(policy.attempts));
+    [self.telemetryManager incrementMetric:@"retry.attempts" by:1];
+    
+    return delay;
 }
 
 
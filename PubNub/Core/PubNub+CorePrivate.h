@@ -10,7 +10,7 @@
 
 #pragma mark Class forward
 
-@class PNRequestParameters, PNConfiguration, PNNetwork, PNResult, PNStatus;
+@class PNRequestParameters, PNConfiguration, PNRequestHandle, PNNetwork, PNResult, PNStatus;
 
 
 NS_ASSUME_NONNULL_BEGIN
@@ -139,10 +139,13 @@ NS_ASSUME_NONNULL_BEGIN
  @param parameters    Resource and query path fields wrapped into object.
  @param block         Reference on operation processing completion block.
 
+ @return Reference on handle which can be used to cancel request.
+
  @since 4.0
  */
-- (void)processOperation:(PNOperationType)operationType withParameters:(PNRequestParameters *)parameters
-         completionBlock:(nullable id)block;
+- (nullable PNRequestHandle *)processOperation:(PNOperationType)operationType
+                                withParameters:(PNRequestParameters *)parameters
+                               completionBlock:(nullable id)block;
 
 /**
  @brief  Compose request to \b PubNub network basing on operation type and passed \c parameters.
@@ -153,10 +156,13 @@ NS_ASSUME_NONNULL_BEGIN
  @param data          Reference on data which should be pushed to \b PubNub network.
  @param block         Reference on operation processing completion block.
 
+ @return Reference on handle which can be used to cancel request.
+
  @since 4.0
  */
-- (void)processOperation:(PNOperationType)operationType withParameters:(PNRequestParameters *)parameters 
-                    data:(nullable NSData *)data completionBlock:(nullable id)block;
+- (nullable PNRequestHandle *)processOperation:(PNOperationType)operationType
+                                withParameters:(PNRequestParameters *)parameters
+                                          data:(nullable NSData *)data completionBlock:(nullable id)block;
 
 
 ///------------------------------------------------
@@ -8,6 +8,7 @@
 #import "PNServiceData+Private.h"
 #import "PNErrorStatus+Private.h"
 #import "PNRequestParameters.h"
+#import "PNRequestHandle.h"
 #import "PubNub+CorePrivate.h"
 #import "PNSubscribeStatus.h"
 #import "PNResult+Private.h"
@@ -44,6 +45,8 @@ NS_ASSUME_NONNULL_BEGIN
                                \b 100).
  @param shouldReverseOrder     Whether events order in response should be reversed or not.
  @param shouldIncludeTimeToken Whether event dates (time tokens) should be included in response or not.
+ @param handle                 Reference on handle which allow to cancel API call or limit time during which
+                               result is expected.
  @param block                  History pull processing completion block which pass two arguments: 
                                \c result - in case of successful request processing \c data field will contain
                                results of history request operation; \c status - in case if error occurred 
@@ -54,10 +57,30 @@ NS_ASSUME_NONNULL_BEGIN
 - (void)historyForChannels:(BOOL)multipleChannels object:(id)object start:(nullable NSNumber *)startDate
                        end:(nullable NSNumber *)endDate limit:(nullable NSNumber *)limit 
                    reverse:(nullable NSNumber *)shouldReverseOrder 
-          includeTimeToken:(nullable NSNumber *)shouldIncludeTimeToken  
+          includeTimeToken:(nullable NSNumber *)shouldIncludeTimeToken handle:(nullable PNRequestHandle *)handle
             withCompletion:(PNHistoryCompletionBlock)block;
 
 
+#pragma mark - History manipulation
+
+/**
+ @brief  Allow to remove events from specified \c channel's history within specified time frame.
+
+ @param channel   Name of the channel from which events should be removed.
+ @param startDate Reference on time token for oldest event starting from which events should be removed.
+ @param endDate   Reference on time token for latest event till which events should be removed.
+ @param handle    Reference on handle which allow to cancel API call or limit time during which result is
+                  expected.
+ @param block     Events remove completion block which pass only one argument - request processing status to
+                  report about how data pushing was successful or not.
+
+ @since 4.8.2
+ */
+- (void)deleteMessagesFromChannel:(NSString *)channel start:(nullable NSNumber *)startDate
+                              end:(nullable NSNumber *)endDate handle:(nullable PNRequestHandle *)handle
+                   withCompletion:(nullable PNMessageDeleteCompletionBlock)block;
+
+
 #pragma mark - Handlers
 
 /**
@@ -103,10 +126,12 @@ NS_ASSUME_NONNULL_END
         NSNumber *end = parameters[NSStringFromSelector(@selector(end))];
         NSNumber *reverse = parameters[NSStringFromSelector(@selector(reverse))];
         NSNumber *includeTimeToken = parameters[NSStringFromSelector(@selector(includeTimeToken))];
+        PNRequestHandle *handle = parameters[@"handle"];
         id block = parameters[@"block"];
 
         [self historyForChannels:(channels != nil) object:(channels?: channel) start:start end:end 
-                           limit:limit reverse:reverse includeTimeToken:includeTimeToken withCompletion:block];
+                           limit:limit reverse:reverse includeTimeToken:includeTimeToken handle:handle
+                  withCompletion:block];
     }];
     
     return ^PNHistoryAPICallBuilder *{ return builder; };
@@ -120,9 +145,10 @@ NS_ASSUME_NONNULL_END
         NSString *channel = parameters[NSStringFromSelector(@selector(channel))];
         NSNumber *start = parameters[NSStringFromSelector(@selector(start))];
         NSNumber *end = parameters[NSStringFromSelector(@selector(end))];
+        PNRequestHandle *handle = parameters[@"handle"];
         id block = parameters[@"block"];
         
-        [self deleteMessagesFromChannel:channel start:start end:end withCompletion:block];
+        [self deleteMessagesFromChannel:channel start:start end:end handle:handle withCompletion:block];
     }];
     
     return ^PNDeleteMessageAPICallBuilder *{ return builder; };
@@ -183,13 +209,14 @@ NS_ASSUME_NONNULL_END
          includeTimeToken:(BOOL)shouldIncludeTimeToken withCompletion:(PNHistoryCompletionBlock)block {
     
     [self historyForChannels:NO object:channel start:startDate end:endDate limit:@(limit) 
-                     reverse:@(shouldReverseOrder) includeTimeToken:@(shouldIncludeTimeToken) 
+                     reverse:@(shouldReverseOrder) includeTimeToken:@(shouldIncludeTimeToken) handle:nil
               withCompletion:block];
 }
 
 - (void)historyForChannels:(BOOL)multipleChannels object:(id)object start:(NSNumber *)startDate
                        end:(NSNumber *)endDate limit:(NSNumber *)limit reverse:(NSNumber *)shouldReverseOrder 
-          includeTimeToken:(NSNumber *)shouldIncludeTimeToken withCompletion:(PNHistoryCompletionBlock)block {
+          includeTimeToken:(NSNumber *)shouldIncludeTimeToken handle:(PNRequestHandle *)handle
+            withCompletion:(PNHistoryCompletionBlock)block {
     
     // Swap time frame dates if required.
     if (startDate && endDate && [startDate compare:endDate] == NSOrderedDescending) {
@@ -249,6 +276,7 @@ NS_ASSUME_NONNULL_END
                      (endDate ? [NSString stringWithFormat:@" to %@", endDate] : @""), @(limitValue));
     }
     PNOperationType operation = (!multipleChannels ? PNHistoryOperation : PNHistoryForChannelsOperation);
+    parameters.handle = handle;
 
     __weak __typeof(self) weakSelf = self;
     [self processOperation:operation withParameters:parameters 
@@ -259,7 +287,7 @@ NS_ASSUME_NONNULL_END
 
                 [weakSelf historyForChannels:multipleChannels object:object start:startDate end:endDate 
                                        limit:limit reverse:shouldReverseOrder 
-                            includeTimeToken:shouldIncludeTimeToken withCompletion:block];
+                            includeTimeToken:shouldIncludeTimeToken handle:nil withCompletion:block];
             };
         }
         [weakSelf handleHistoryResult:result withStatus:status completion:block];
@@ -271,6 +299,12 @@ NS_ASSUME_NONNULL_END
 - (void)deleteMessagesFromChannel:(NSString *)channel start:(NSNumber *)startDate end:(NSNumber *)endDate 
                    withCompletion:(PNMessageDeleteCompletionBlock)block {
     
+    [self deleteMessagesFromChannel:channel start:startDate end:endDate handle:nil withCompletion:block];
+}
+
+- (void)deleteMessagesFromChannel:(NSString *)channel start:(NSNumber *)startDate end:(NSNumber *)endDate
+                           handle:(PNRequestHandle *)handle withCompletion:(PNMessageDeleteCompletionBlock)block {
+    
     // Swap time frame dates if required.
     if (startDate && endDate && [startDate compare:endDate] == NSOrderedDescending) {
         
@@ -281,6 +315,7 @@ NS_ASSUME_NONNULL_END
     
     PNRequestParameters *parameters = [PNRequestParameters new];
     parameters.HTTPMethod = @"DELETE";
+    parameters.handle = handle;
     if (startDate) {
         
         [parameters addQueryParameter:[PNNumber timeTokenFromNumber:startDate].stringValue
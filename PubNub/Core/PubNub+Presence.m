@@ -8,6 +8,7 @@
 #import "PubNub+SubscribePrivate.h"
 #import "PNPrivateStructures.h"
 #import "PNRequestParameters.h"
+#import "PNRequestHandle.h"
 #import "PubNub+CorePrivate.h"
 #import "PNStatus+Private.h"
 #import "PNConfiguration.h"
@@ -43,6 +44,45 @@ NS_ASSUME_NONNULL_BEGIN
 - (void)hereNowWithVerbosity:(PNHereNowVerbosityLevel)level forObject:(nullable NSString *)object 
            withOperationType:(PNOperationType)operation completionBlock:(id)block;
 
+/**
+ @brief  Request information about subscribers on specific remote data object live feeds.
+
+ @param level     Reference on one of \b PNHereNowVerbosityLevel fields to instruct what exactly data it
+                  expected in response.
+ @param object    Reference on remote data object for which here now information should be received.
+ @param operation Reference on one of \b PNOperationType fields to identify which kind on of presence 
+                  operation should be performed.
+ @param handle    Reference on handle which allow to cancel API call or limit time during which result is
+                  expected.
+ @param block     Here now processing completion block which pass two arguments: \c result - in case of
+                  successful request processing \c data field will contain results of here now operation; 
+                  \c status - in case if error occurred during request processing.
+
+ @since 4.8.2
+ */
+- (void)hereNowWithVerbosity:(PNHereNowVerbosityLevel)level forObject:(nullable NSString *)object 
+           withOperationType:(PNOperationType)operation handle:(nullable PNRequestHandle *)handle
+             completionBlock:(id)block;
+
+
+#pragma mark - Client where now
+
+/**
+ @brief  Request information about remote data object live feeds on which client with specified UUID
+         subscribed at this moment.
+
+ @param uuid   Reference on UUID for which request should be performed.
+ @param handle Reference on handle which allow to cancel API call or limit time during which result is
+               expected.
+ @param block  Where now processing completion block which pass two arguments: \c result - in case of
+               successful request processing \c data field will contain results of where now operation;
+               \c status - in case if error occurred during request processing.
+
+ @since 4.8.2
+ */
+- (void)whereNowUUID:(NSString *)uuid handle:(nullable PNRequestHandle *)handle
+      withCompletion:(PNWhereNowCompletionBlock)block;
+
 
 #pragma mark - Heartbeat
 
@@ -119,6 +159,12 @@ NS_ASSUME_NONNULL_END
 
             id block = parameters[@"block"];
             [self setConnected:connected forChannels:channels channelGroups:channelGroups withState:state completionBlock:block];
+        } else if ([flags containsObject:NSStringFromSelector(@selector(whereNow))]) {
+            NSString *uuid = parameters[NSStringFromSelector(@selector(uuid))];
+            PNRequestHandle *handle = parameters[@"handle"];
+
+            id block = parameters[@"block"];
+            [self whereNowUUID:uuid handle:handle withCompletion:block];
         } else {
             NSString *object = (parameters[NSStringFromSelector(@selector(channel))]?:
                                 parameters[NSStringFromSelector(@selector(channelGroup))]);
@@ -136,8 +182,10 @@ NS_ASSUME_NONNULL_END
 
                 level = ((NSNumber *)parameters[NSStringFromSelector(@selector(verbosity))]).integerValue;
             }
+            PNRequestHandle *handle = parameters[@"handle"];
             id block = parameters[@"block"];
-            [self hereNowWithVerbosity:level forObject:object withOperationType:type completionBlock:block];
+            [self hereNowWithVerbosity:level forObject:object withOperationType:type handle:handle
+                       completionBlock:block];
         }
     }];
     
@@ -193,7 +241,16 @@ NS_ASSUME_NONNULL_END
 - (void)hereNowWithVerbosity:(PNHereNowVerbosityLevel)level forObject:(NSString *)object 
            withOperationType:(PNOperationType)operation completionBlock:(id)block {
 
+    [self hereNowWithVerbosity:level forObject:object withOperationType:operation handle:nil
+               completionBlock:block];
+}
+
+- (void)hereNowWithVerbosity:(PNHereNowVerbosityLevel)level forObject:(NSString *)object 
+           withOperationType:(PNOperationType)operation handle:(PNRequestHandle *)handle
+             completionBlock:(id)block {
+
     PNRequestParameters *parameters = [PNRequestParameters new];
+    parameters.handle = handle;
     [parameters addQueryParameter:@"1" forFieldName:@"disable_uuids"];
     [parameters addQueryParameter:@"0" forFieldName:@"state"];
     if (level == PNHereNowUUID || level == PNHereNowState){
@@ -245,7 +302,14 @@ NS_ASSUME_NONNULL_END
 
 - (void)whereNowUUID:(NSString *)uuid withCompletion:(PNWhereNowCompletionBlock)block {
 
+    [self whereNowUUID:uuid handle:nil withCompletion:block];
+}
+
+- (void)whereNowUUID:(NSString *)uuid handle:(PNRequestHandle *)handle
+      withCompletion:(PNWhereNowCompletionBlock)block {
+
     PNRequestParameters *parameters = [PNRequestParameters new];
+    parameters.handle = handle;
     if (uuid.length) {
         
         [parameters addPathComponent:[PNString percentEscapedString:uuid] forPlaceholder:@"{uuid}"];
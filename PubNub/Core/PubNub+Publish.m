@@ -5,6 +5,7 @@
  */
 #import "PubNub+Publish.h"
 #import "PNAPICallBuilder+Private.h"
+#import "PNRequestHandle+Private.h"
 #import "PNRequestParameters.h"
 #import "PubNub+CorePrivate.h"
 #import "PNStatus+Private.h"
@@ -52,6 +53,36 @@ NS_ASSUME_NONNULL_BEGIN
            metadata:(nullable NSDictionary<NSString *, id> *)metadata
          completion:(nullable PNPublishCompletionBlock)block;
 
+/**
+ @brief      Send provided Foundation object to \b PubNub service.
+ @discussion Message won't be serialized and encrypted if API call has been abandoned through \c handle.
+
+ @param message     Reference on Foundation object (\a NSString, \a NSNumber, \a NSArray, \a NSDictionary) 
+                    which will be published.
+ @param channel     Reference on name of the channel to which message should be published.
+ @param payloads    Dictionary with payloads for different vendors (Apple with "apns" key and Google with 
+                    "gcm").
+ @param shouldStore With \c NO this message later won't be fetched with \c history API.
+ @param ttl         Specify for how long message should be stored in channe's storage. If \b 0 it will be 
+                    stored foreved or if \c nil - depends from account configuration.
+ @param compressed  Compression useful in case if large data should be published, in another case it will lead
+                    to packet size grow.
+ @param replicate   Whether message should be replicated across the PubNub Real-Time Network and sent 
+                    simultaneously to all subscribed clients on a channel.
+ @param metadata    \b NSDictionary with values which should be used by \b PubNub service to filter messages.
+ @param handle      Reference on handle which allow to cancel API call or limit time during which result is
+                    expected.
+ @param block       Publish processing completion block which pass only one argument - request processing 
+                    status to report about how data pushing was successful or not.
+
+ @since 4.8.2
+ */
+- (void)    publish:(nullable id)message toChannel:(NSString *)channel
+  mobilePushPayload:(nullable NSDictionary<NSString *, id> *)payloads storeInHistory:(BOOL)shouldStore
+                ttl:(nullable NSNumber *)ttl compressed:(BOOL)compressed withReplication:(BOOL)replicate 
+           metadata:(nullable NSDictionary<NSString *, id> *)metadata handle:(nullable PNRequestHandle *)handle
+         completion:(nullable PNPublishCompletionBlock)block;
+
 
 #pragma mark - Message helper
 
@@ -349,6 +380,16 @@ NS_ASSUME_NONNULL_END
                 ttl:(NSNumber *)ttl compressed:(BOOL)compressed withReplication:(BOOL)replicate 
            metadata:(NSDictionary<NSString *, id> *)metadata completion:(PNPublishCompletionBlock)block {
     
+    [self publish:message toChannel:channel mobilePushPayload:payloads storeInHistory:shouldStore ttl:ttl
+       compressed:compressed withReplication:replicate metadata:metadata handle:nil completion:block];
+}
+
+- (void)    publish:(id)message toChannel:(NSString *)channel
+  mobilePushPayload:(NSDictionary<NSString *, id> *)payloads storeInHistory:(BOOL)shouldStore
+                ttl:(NSNumber *)ttl compressed:(BOOL)compressed withReplication:(BOOL)replicate 
+           metadata:(NSDictionary<NSString *, id> *)metadata handle:(PNRequestHandle *)handle
+         completion:(PNPublishCompletionBlock)block {
+    
     // Get next published message sequence number and update stored data.
     NSUInteger nextSequenceNumber = [self.sequenceManager nextSequenceNumber:YES];
 
@@ -362,9 +403,35 @@ NS_ASSUME_NONNULL_END
         }
     }
 
+    handle.operation = PNPublishOperation;
+    PNStatusBlock completion = ^(PNStatus *status) {
+        
+        if (status.isError) {
+            
+            status.retryBlock = ^{
+                
+                [weakSelf publish:message toChannel:channel mobilePushPayload:payloads
+                   storeInHistory:shouldStore compressed:compressed withMetadata:metadata
+                       completion:block];
+            };
+        }
+        [weakSelf callBlock:block status:YES withResult:nil andStatus:status];
+    };
+
     dispatch_async(queue, ^{
         
         __strong __typeof__(weakSelf) strongSelf = weakSelf;
+        if (handle.isAbandoned) {
+            
+            // Network manager will complete abandoned API call without request sending.
+            PNRequestParameters *parameters = [PNRequestParameters new];
+            parameters.handle = handle;
+            [strongSelf processOperation:PNPublishOperation withParameters:parameters
+                         completionBlock:completion];
+            
+            return;
+        }
+        
         BOOL encrypted = NO;
         NSError *publishError = nil;
         NSString *messageForPublish = [PNJSON JSONStringFrom:message withError:&publishError];
@@ -415,19 +482,9 @@ NS_ASSUME_NONNULL_END
                      (!compressed ? [NSString stringWithFormat:@": %@",
                                      (messageForPublish?: @"<error>")] : @"."));
 
+        parameters.handle = handle;
         [strongSelf processOperation:PNPublishOperation withParameters:parameters data:publishData
-                     completionBlock:^(PNStatus *status) {
-           if (status.isError) {
-                
-               status.retryBlock = ^{
-                   
-                   [weakSelf publish:message toChannel:channel mobilePushPayload:payloads
-                      storeInHistory:shouldStore compressed:compressed withMetadata:metadata
-                          completion:block];
-               };
-           }
-           [weakSelf callBlock:block status:YES withResult:nil andStatus:status];
-       }];
+                     completionBlock:completion];
     });
 }
 
@@ -574,11 +631,12 @@ NS_ASSUME_NONNULL_END
     NSNumber *compressed = parameters[NSStringFromSelector(@selector(compress))];
     NSNumber *replicate = parameters[NSStringFromSelector(@selector(replicate))];
     NSDictionary *metadata = parameters[NSStringFromSelector(@selector(metadata))];
+    PNRequestHandle *handle = parameters[@"handle"];
     id block = parameters[@"block"];
     
     [self publish:message toChannel:channel mobilePushPayload:payloads 
    storeInHistory:(shouldStore ? shouldStore.boolValue : YES) ttl:ttl compressed:compressed.boolValue
-  withReplication:(replicate ? replicate.boolValue : YES) metadata:metadata completion:block];
+  withReplication:(replicate ? replicate.boolValue : YES) metadata:metadata handle:handle completion:block];
 }
 
 
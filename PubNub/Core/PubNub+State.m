@@ -7,6 +7,7 @@
 #import "PNClientStateUpdateStatus.h"
 #import "PNAPICallBuilder+Private.h"
 #import "PNRequestParameters.h"
+#import "PNRequestHandle.h"
 #import "PubNub+CorePrivate.h"
 #import "PNStatus+Private.h"
 #import "PNConfiguration.h"
@@ -30,6 +31,8 @@ NS_ASSUME_NONNULL_BEGIN
  @param uuid      Reference on unique user identifier for which state should be bound.
  @param onChannel Whether state has been provided for channel or channel group.
  @param object    Name of remote data object which will store provided state information for \c uuid.
+ @param handle    Reference on handle which allow to cancel API call or limit time during which result is
+                  expected.
  @param block     State modification for user on channel processing completion block which pass only
                   one argument - request processing status to report about how data pushing was 
                   successful or not.
@@ -37,7 +40,7 @@ NS_ASSUME_NONNULL_BEGIN
  @since 4.0
  */
 - (void)setState:(nullable NSDictionary<NSString *, id> *)state forUUID:(NSString *)uuid 
-       onChannel:(BOOL)onChannel withName:(NSString *)object 
+       onChannel:(BOOL)onChannel withName:(NSString *)object handle:(nullable PNRequestHandle *)handle
   withCompletion:(nullable PNSetStateCompletionBlock)block;
 
 /**
@@ -46,6 +49,8 @@ NS_ASSUME_NONNULL_BEGIN
  @param uuid      Reference on unique user identifier for which state should be retrieved.
  @param onChannel Whether state has been provided for channel or channel group.
  @param object    Name of remote data object from which state information for \c uuid will be pulled out.
+ @param handle    Reference on handle which allow to cancel API call or limit time during which result is
+                  expected.
  @param block     State audition for user on remote data object processing completion block which pass two 
                   arguments: \c result - in case of successful request processing \c data field will contain 
                   results of client state retrieve operation; \c status - in case if error occurred during 
@@ -54,7 +59,7 @@ NS_ASSUME_NONNULL_BEGIN
  @since 4.0
  */
 - (void)stateForUUID:(NSString *)uuid onChannel:(BOOL)onChannel withName:(NSString *)object
-      withCompletion:(id)block;
+              handle:(nullable PNRequestHandle *)handle withCompletion:(id)block;
 
 
 #pragma mark - Handlers
@@ -118,12 +123,16 @@ NS_ASSUME_NONNULL_END
                             parameters[NSStringFromSelector(@selector(channelGroup))]);
         BOOL forChannel = (parameters[NSStringFromSelector(@selector(channel))] != nil);
         NSDictionary *state = parameters[NSStringFromSelector(@selector(state))];
+        PNRequestHandle *handle = parameters[@"handle"];
         id block = parameters[@"block"];
         if ([flags containsObject:NSStringFromSelector(@selector(audit))]) {
             
-            [self stateForUUID:uuid onChannel:forChannel withName:object withCompletion:block];
+            [self stateForUUID:uuid onChannel:forChannel withName:object handle:handle withCompletion:block];
+        }
+        else {
+            [self setState:state forUUID:uuid onChannel:forChannel withName:object handle:handle
+            withCompletion:block];
         }
-        else { [self setState:state forUUID:uuid onChannel:forChannel withName:object withCompletion:block]; }
     }];
     
     return ^PNStateAPICallBuilder *{ return builder; };
@@ -135,17 +144,18 @@ NS_ASSUME_NONNULL_END
 - (void)setState:(NSDictionary<NSString *, id> *)state forUUID:(NSString *)uuid onChannel:(NSString *)channel 
   withCompletion:(PNSetStateCompletionBlock)block {
     
-    [self setState:state forUUID:uuid onChannel:YES withName:channel withCompletion:block];
+    [self setState:state forUUID:uuid onChannel:YES withName:channel handle:nil withCompletion:block];
 }
 
 - (void)setState:(NSDictionary<NSString *, id> *)state forUUID:(NSString *)uuid 
   onChannelGroup:(NSString *)group withCompletion:(PNSetStateCompletionBlock)block {
     
-    [self setState:state forUUID:uuid onChannel:NO withName:group withCompletion:block];
+    [self setState:state forUUID:uuid onChannel:NO withName:group handle:nil withCompletion:block];
 }
 
 - (void)setState:(NSDictionary<NSString *, id> *)state forUUID:(NSString *)uuid onChannel:(BOOL)onChannel 
-        withName:(NSString *)object withCompletion:(PNSetStateCompletionBlock)block {
+        withName:(NSString *)object handle:(PNRequestHandle *)handle
+  withCompletion:(PNSetStateCompletionBlock)block {
     
     __weak __typeof(self) weakSelf = self;
     dispatch_queue_t queue = dispatch_get_global_queue(DISPATCH_QUEUE_PRIORITY_DEFAULT, 0);
@@ -159,6 +169,7 @@ NS_ASSUME_NONNULL_END
         
         __strong __typeof__(weakSelf) strongSelf = weakSelf;
         PNRequestParameters *parameters = [PNRequestParameters new];
+        parameters.handle = handle;
         [parameters addPathComponent:(onChannel ? [PNString percentEscapedString:object] : @",")
                       forPlaceholder:@"{channel}"];
         NSString *stateString = ([PNJSON JSONStringFrom:state withError:NULL]?: @"{}");
@@ -184,7 +195,7 @@ NS_ASSUME_NONNULL_END
                 
                status.retryBlock = ^{
                    
-                   [weakSelf setState:state forUUID:uuid onChannel:onChannel withName:object
+                   [weakSelf setState:state forUUID:uuid onChannel:onChannel withName:object handle:nil
                        withCompletion:block];
                };
            }
@@ -200,19 +211,20 @@ NS_ASSUME_NONNULL_END
 - (void)stateForUUID:(NSString *)uuid onChannel:(NSString *)channel
       withCompletion:(PNChannelStateCompletionBlock)block {
     
-    [self stateForUUID:uuid onChannel:YES withName:channel withCompletion:block];
+    [self stateForUUID:uuid onChannel:YES withName:channel handle:nil withCompletion:block];
 }
 
 - (void)stateForUUID:(NSString *)uuid onChannelGroup:(NSString *)group
       withCompletion:(PNChannelGroupStateCompletionBlock)block {
     
-    [self stateForUUID:uuid onChannel:NO withName:group withCompletion:block];
+    [self stateForUUID:uuid onChannel:NO withName:group handle:nil withCompletion:block];
 }
 
 - (void)stateForUUID:(NSString *)uuid onChannel:(BOOL)onChannel withName:(NSString *)object
-      withCompletion:(id)block {
+              handle:(PNRequestHandle *)handle withCompletion:(id)block {
     
     PNRequestParameters *parameters = [PNRequestParameters new];
+    parameters.handle = handle;
     [parameters addPathComponent:(onChannel ? [PNString percentEscapedString:object] : @",")
                   forPlaceholder:@"{channel}"];
     if (uuid.length) {
@@ -235,7 +247,8 @@ NS_ASSUME_NONNULL_END
             
             status.retryBlock = ^{
                 
-                [weakSelf stateForUUID:uuid onChannel:onChannel withName:object withCompletion:block];
+                [weakSelf stateForUUID:uuid onChannel:onChannel withName:object handle:nil
+                        withCompletion:block];
             };
         }
         [weakSelf handleStateResult:(PNChannelClientStateResult *)result withStatus:status
@@ -81,7 +81,8 @@ NS_ASSUME_NONNULL_BEGIN
  @brief      Add observer which conform to \b PNObjectEventListener protocol and would like to receive updates
              based on live feed events and status change.
  @discussion Listener can implement only required callbacks from \b PNObjectEventListener protocol and called
-             only when desired type of event arrive.
+             only when desired type of event arrive. Listener which implement \c -client:didReceiveMessages:
+             receive messages only in batches and \c -client:didReceiveMessage: won't be called.
  
  @param listener Listener which would like to receive updates.
  
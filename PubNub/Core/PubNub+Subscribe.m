@@ -11,17 +11,6 @@
 #import "PNHelpers.h"
 
 
-#pragma mark - Constants
-
-/**
- @brief      Stored reference on subscribe REST API path prefix. 
- @discussion Prefix used for faster request identification (w/o performing search of range with options).
- 
- @since 4.6.2
- */
-static NSString * const kPNSubscribeAPIPrefix = @"/v2/subscribe/";
-
-
 #pragma mark - Interface implementation
 
 @implementation PubNub (Subscribe)
@@ -284,7 +273,7 @@ static NSString * const kPNSubscribeAPIPrefix = @"/v2/subscribe/";
 
 - (void)cancelSubscribeOperations {
     
-    [self.subscriptionNetwork cancelAllOperationsWithURLPrefix:kPNSubscribeAPIPrefix];
+    [self.subscriptionNetwork cancelAllOperationsOfType:PNSubscribeOperation];
 }
 
 #pragma mark -
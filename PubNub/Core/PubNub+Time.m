@@ -3,7 +3,7 @@
  @since 4.0
  @copyright © 2009-2017 PubNub, Inc.
  */
-#import "PubNub+Time.h"
+#import "PubNub+TimePrivate.h"
 #import "PNAPICallBuilder+Private.h"
 #import "PNRequestParameters.h"
 #import "PubNub+CorePrivate.h"
@@ -45,6 +45,20 @@
     }];
 }
 
+
+#pragma mark - Service ping
+
+- (void)pingServiceWithCompletion:(PNTimeCompletionBlock)block {
+    
+    PNRequestParameters *parameters = [PNRequestParameters new];
+    parameters.freshResponseRequired = YES;
+    __weak __typeof(self) weakSelf = self;
+    [self processOperation:PNTimeOperation withParameters:parameters
+           completionBlock:^(PNResult *result, PNStatus *status) {
+        [weakSelf callBlock:block status:NO withResult:result andStatus:status];
+    }];
+}
+
 #pragma mark -
 
 
@@ -0,0 +1,36 @@
+/**
+ @author Sergey Mamontov
+ @since 4.8.2
+ @copyright © 2009-2017 PubNub, Inc.
+ */
+#import "PubNub+Time.h"
+
+
+NS_ASSUME_NONNULL_BEGIN
+
+#pragma mark Private interface declaration
+
+@interface PubNub (TimePrivate)
+
+
+///------------------------------------------------
+/// @name Service ping support
+///------------------------------------------------
+
+/**
+ @brief      Request current time token from \b PubNub network to check whether it is reachable.
+ @discussion Request always sent to \b PubNub network: result won't be taken from responses cache or
+             shared with identical in-flight time token requests.
+ 
+ @param block Reference on block which should be called with service information.
+ 
+ @since 4.8.2
+ */
+- (void)pingServiceWithCompletion:(PNTimeCompletionBlock)block;
+
+#pragma mark -
+
+
+@end
+
+NS_ASSUME_NONNULL_END
@@ -52,6 +52,16 @@ NS_ASSUME_NONNULL_BEGIN
  */
 @property (nonatomic, readonly, strong) PNDeleteMessageAPICallBuilder *(^end)(NSNumber *end);
 
+/**
+ @brief      Specify for how long API call result is expected.
+ @discussion On block call return block which consume \a NSTimeInterval with number of seconds after which
+             API call will be completed with \b PNTimeoutCategory status (request won't be sent or retried
+             and loaded response won't be parsed after deadline).
+ 
+ @since 4.8.2
+ */
+@property (nonatomic, readonly, strong) PNDeleteMessageAPICallBuilder *(^deadline)(NSTimeInterval timeout);
+
 
 ///------------------------------------------------
 /// @name Execution
@@ -63,10 +73,11 @@ NS_ASSUME_NONNULL_BEGIN
  @discussion On block call return block which consume (\b not required) events delete processing completion 
              block which pass only one argument - request processing status to report about how data pushing 
              was successful or not.
+ @discussion Block return reference on handle which can be used to cancel API call.
  
  @since 4.7.0
  */
-@property (nonatomic, readonly, strong) void(^performWithCompletion)(PNMessageDeleteCompletionBlock block);
+@property (nonatomic, readonly, strong) PNRequestHandle *(^performWithCompletion)(PNMessageDeleteCompletionBlock block);
 
 #pragma mark -
 
@@ -44,12 +44,22 @@
     };
 }
 
+- (PNDeleteMessageAPICallBuilder *(^)(NSTimeInterval timeout))deadline {
+    
+    return ^PNDeleteMessageAPICallBuilder* (NSTimeInterval timeout) {
+        
+        [self setValue:@(timeout) forParameter:NSStringFromSelector(_cmd)];
+        
+        return self;
+    };
+}
+
 
 #pragma mark - Execution
 
-- (void(^)(PNMessageDeleteCompletionBlock block))performWithCompletion {
+- (PNRequestHandle *(^)(PNMessageDeleteCompletionBlock block))performWithCompletion {
     
-    return ^(PNMessageDeleteCompletionBlock block) { [super performWithBlock:block]; };
+    return ^PNRequestHandle* (PNMessageDeleteCompletionBlock block) { return [super performWithBlock:block]; };
 }
 
 #pragma mark -
@@ -84,12 +84,22 @@
     };
 }
 
+- (PNHistoryAPICallBuilder *(^)(NSTimeInterval timeout))deadline {
+    
+    return ^PNHistoryAPICallBuilder* (NSTimeInterval timeout) {
+        
+        [self setValue:@(timeout) forParameter:NSStringFromSelector(_cmd)];
+        
+        return self;
+    };
+}
+
 
 #pragma mark - Execution
 
-- (void(^)(PNHistoryCompletionBlock block))performWithCompletion {
+- (PNRequestHandle *(^)(PNHistoryCompletionBlock block))performWithCompletion {
     
-    return ^(PNHistoryCompletionBlock block) { [super performWithBlock:block]; };
+    return ^PNRequestHandle* (PNHistoryCompletionBlock block) { return [super performWithBlock:block]; };
 }
 
 #pragma mark -
@@ -24,12 +24,22 @@
     };
 }
 
+- (PNPresenceChannelGroupHereNowAPICallBuilder *(^)(NSTimeInterval timeout))deadline {
+    
+    return ^PNPresenceChannelGroupHereNowAPICallBuilder* (NSTimeInterval timeout) {
+        
+        [self setValue:@(timeout) forParameter:NSStringFromSelector(_cmd)];
+        
+        return self;
+    };
+}
+
 
 #pragma mark - Execution
 
-- (void(^)(PNChannelGroupHereNowCompletionBlock block))performWithCompletion {
+- (PNRequestHandle *(^)(PNChannelGroupHereNowCompletionBlock block))performWithCompletion {
     
-    return ^(PNChannelGroupHereNowCompletionBlock block){ [super performWithBlock:block]; };
+    return ^PNRequestHandle* (PNChannelGroupHereNowCompletionBlock block) { return [super performWithBlock:block]; };
 }
 
 #pragma mark -
@@ -27,6 +27,16 @@ NS_ASSUME_NONNULL_BEGIN
  */
 @property (nonatomic, readonly, strong) PNPresenceChannelHereNowAPICallBuilder *(^verbosity)(PNHereNowVerbosityLevel verbosity);
 
+/**
+ @brief      Specify for how long API call result is expected.
+ @discussion On block call return block which consume \a NSTimeInterval with number of seconds after which
+             API call will be completed with \b PNTimeoutCategory status (request won't be sent or retried
+             and loaded response won't be parsed after deadline).
+ 
+ @since 4.8.2
+ */
+@property (nonatomic, readonly, strong) PNPresenceChannelHereNowAPICallBuilder *(^deadline)(NSTimeInterval timeout);
+
 
 ///------------------------------------------------
 /// @name Execution
@@ -39,13 +49,14 @@ NS_ASSUME_NONNULL_BEGIN
              pass two arguments: \c result - in case of successful request processing \c data field will 
              contain results of here now operation; \c status - in case if error occurred during request 
              processing.
+ @discussion Block return reference on handle which can be used to cancel API call.
  
  @since 4.5.4
  */
 #pragma clang diagnostic push
 #pragma clang diagnostic ignored "-Wincompatible-pointer-types"
 #pragma clang diagnostic ignored "-Wincompatible-property-type"
-@property (nonatomic, readonly, strong) void(^performWithCompletion)(PNHereNowCompletionBlock block);
+@property (nonatomic, readonly, strong) PNRequestHandle *(^performWithCompletion)(PNHereNowCompletionBlock block);
 #pragma clang diagnostic pop
 
 #pragma mark -
@@ -24,12 +24,22 @@
     };
 }
 
+- (PNPresenceChannelHereNowAPICallBuilder *(^)(NSTimeInterval timeout))deadline {
+    
+    return ^PNPresenceChannelHereNowAPICallBuilder* (NSTimeInterval timeout) {
+        
+        [self setValue:@(timeout) forParameter:NSStringFromSelector(_cmd)];
+        
+        return self;
+    };
+}
+
 
 #pragma mark - Execution
 
-- (void(^)(PNHereNowCompletionBlock block))performWithCompletion {
+- (PNRequestHandle *(^)(PNHereNowCompletionBlock block))performWithCompletion {
     
-    return ^(PNHereNowCompletionBlock block){ [super performWithBlock:block]; };
+    return ^PNRequestHandle* (PNHereNowCompletionBlock block) { return [super performWithBlock:block]; };
 }
 
 
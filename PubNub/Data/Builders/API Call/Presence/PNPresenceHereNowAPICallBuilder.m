@@ -67,9 +67,19 @@
     };
 }
 
-- (void(^)(PNGlobalHereNowCompletionBlock block))performWithCompletion {
+- (PNPresenceHereNowAPICallBuilder *(^)(NSTimeInterval timeout))deadline {
     
-    return ^(PNGlobalHereNowCompletionBlock block){ [super performWithBlock:block]; };
+    return ^PNPresenceHereNowAPICallBuilder* (NSTimeInterval timeout) {
+        
+        [self setValue:@(timeout) forParameter:NSStringFromSelector(_cmd)];
+        
+        return self;
+    };
+}
+
+- (PNRequestHandle *(^)(PNGlobalHereNowCompletionBlock block))performWithCompletion {
+    
+    return ^PNRequestHandle* (PNGlobalHereNowCompletionBlock block) { return [super performWithBlock:block]; };
 }
 
 #pragma mark -
@@ -24,12 +24,22 @@
     };
 }
 
+- (PNPresenceWhereNowAPICallBuilder *(^)(NSTimeInterval timeout))deadline {
+    
+    return ^PNPresenceWhereNowAPICallBuilder* (NSTimeInterval timeout) {
+        
+        [self setValue:@(timeout) forParameter:NSStringFromSelector(_cmd)];
+        
+        return self;
+    };
+}
+
 
 #pragma mark - Execution
 
-- (void(^)(PNWhereNowCompletionBlock block))performWithCompletion {
+- (PNRequestHandle *(^)(PNWhereNowCompletionBlock block))performWithCompletion {
     
-    return ^(PNWhereNowCompletionBlock block){ [super performWithBlock:block]; };
+    return ^PNRequestHandle* (PNWhereNowCompletionBlock block) { return [super performWithBlock:block]; };
 }
 
 #pragma mark -
@@ -94,12 +94,22 @@
     };
 }
 
+- (PNPublishAPICallBuilder *(^)(NSTimeInterval timeout))deadline {
+    
+    return ^PNPublishAPICallBuilder* (NSTimeInterval timeout) {
+        
+        [self setValue:@(timeout) forParameter:NSStringFromSelector(_cmd)];
+        
+        return self;
+    };
+}
+
 
 #pragma mark - Execution
 
-- (void(^)(PNPublishCompletionBlock block))performWithCompletion {
+- (PNRequestHandle *(^)(PNPublishCompletionBlock block))performWithCompletion {
     
-    return ^(PNPublishCompletionBlock block){ [super performWithBlock:block]; };
+    return ^PNRequestHandle* (PNPublishCompletionBlock block) { return [super performWithBlock:block]; };
 }
 
 #pragma mark -
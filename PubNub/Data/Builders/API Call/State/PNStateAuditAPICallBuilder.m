@@ -44,12 +44,22 @@
     };
 }
 
+- (PNStateAuditAPICallBuilder *(^)(NSTimeInterval timeout))deadline {
+    
+    return ^PNStateAuditAPICallBuilder* (NSTimeInterval timeout) {
+        
+        [self setValue:@(timeout) forParameter:NSStringFromSelector(_cmd)];
+        
+        return self;
+    };
+}
+
 
 #pragma mark - Execution
 
-- (void(^)(PNChannelStateCompletionBlock block))performWithCompletion {
+- (PNRequestHandle *(^)(PNChannelStateCompletionBlock block))performWithCompletion {
     
-    return ^(PNChannelStateCompletionBlock block){ [super performWithBlock:block]; };
+    return ^PNRequestHandle* (PNChannelStateCompletionBlock block) { return [super performWithBlock:block]; };
 }
 
 #pragma mark - 
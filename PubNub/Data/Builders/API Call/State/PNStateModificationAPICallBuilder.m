@@ -54,12 +54,22 @@
     };
 }
 
+- (PNStateModificationAPICallBuilder *(^)(NSTimeInterval timeout))deadline {
+    
+    return ^PNStateModificationAPICallBuilder* (NSTimeInterval timeout) {
+        
+        [self setValue:@(timeout) forParameter:NSStringFromSelector(_cmd)];
+        
+        return self;
+    };
+}
+
 
 #pragma mark - Execution
 
-- (void(^)(PNSetStateCompletionBlock block))performWithCompletion {
+- (PNRequestHandle *(^)(PNSetStateCompletionBlock block))performWithCompletion {
     
-    return ^(PNSetStateCompletionBlock block){ [super performWithBlock:block]; };
+    return ^PNRequestHandle* (PNSetStateCompletionBlock block) { return [super performWithBlock:block]; };
 }
 
 #pragma mark - 
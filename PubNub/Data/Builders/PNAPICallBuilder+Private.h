@@ -87,13 +87,17 @@ typedef void(^PNAPICallCompletionBlock)(NSArray<NSString *> * _Nullable flags,
 /**
  @brief      Execute configured API call.
  @discussion Try to use user-provided information to execute target API.
+ @discussion Handle is passed to API call with \c handle parameter and created with \c deadline parameter
+             value (if specified by user).
  
  @since 4.5.4
  
  @param block Reference on API execution completion block to which \b PubNub client will pass execution 
         results.
+ 
+ @return Reference on handle which can be used to cancel API call.
  */
-- (void)performWithBlock:(nullable id)block;
+- (PNRequestHandle *)performWithBlock:(nullable id)block;
 
 #pragma mark -
 
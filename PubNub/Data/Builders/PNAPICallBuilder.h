@@ -1,6 +1,11 @@
 #import <Foundation/Foundation.h>
 
 
+#pragma mark Class forward
+
+@class PNRequestHandle;
+
+
 NS_ASSUME_NONNULL_BEGIN
 
 /**
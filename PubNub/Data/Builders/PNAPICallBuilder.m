@@ -4,6 +4,7 @@
  @copyright © 2009-2017 PubNub, Inc.
  */
 #import "PNAPICallBuilder+Private.h"
+#import "PNRequestHandle+Private.h"
 #import <objc/runtime.h>
 
 
@@ -117,10 +118,15 @@
     self.parameters[parameter] = value;
 }
 
-- (void)performWithBlock:(id)block {
+- (PNRequestHandle *)performWithBlock:(id)block {
     
+    NSNumber *timeout = self.parameters[@"deadline"];
+    PNRequestHandle *handle = [PNRequestHandle handleWithTimeout:timeout.doubleValue];
     self.parameters[@"block"] = block;
+    self.parameters[@"handle"] = handle;
     self.executionBlock(self.flags, self.parameters);
+    
+    return handle;
 }
 
 #pragma mark -
@@ -51,6 +51,15 @@ NS_ASSUME_NONNULL_BEGIN
 /// @name Information
 ///------------------------------------------------
 
+/**
+ @brief      Version of cached client state information.
+ @discussion Version changes each time when cached state information modified and can be used to detect
+             whether information derived from client state should be composed again or not.
+
+ @since 4.8.2
+ */
+@property (nonatomic, readonly, assign) NSUInteger version;
+
 /**
  @brief      Retrieve state information stored in cache.
  @discussion State cache updated every time when client successfully subscribe on remote data object feeds 
@@ -87,6 +96,22 @@ NS_ASSUME_NONNULL_BEGIN
  */
 - (void)mergeWithState:(nullable NSDictionary<NSString *, id> *)state;
 
+/**
+ @brief      Merge \c state into cached client state and provide merged information for \c objects.
+ @discussion Merged state and cache version captured by same cache modification, so if state will be
+             changed concurrently, it will have newer version.
+
+ @param state   State which should be merged into client state stored in cache.
+ @param objects List of object names for which merged data is composed.
+ @param version Pointer which will store version of cache which contain returned merged state.
+
+ @return Merged client state information.
+
+ @since 4.8.2
+ */
+- (nullable NSDictionary *)mergeWithState:(nullable NSDictionary<NSString *, id> *)state
+                               forObjects:(NSArray<NSString *> *)objects version:(NSUInteger *)version;
+
 /**
  @brief  Overwrite client state information bound to specified \c object.
 
@@ -31,6 +31,13 @@ NS_ASSUME_NONNULL_BEGIN
  */
 @property (nonatomic, strong) NSMutableDictionary<NSString *, id> *stateCache;
 
+/**
+ @brief  Stores version of cached client state information.
+
+ @since 4.8.2
+ */
+@property (nonatomic, assign) NSUInteger version;
+
 /**
  @brief  Stores reference on queue which is used to serialize access to shared client state
          information.
@@ -53,6 +60,17 @@ NS_ASSUME_NONNULL_BEGIN
  */
 - (instancetype)initForClient:(PubNub *)client;
 
+
+#pragma mark - Misc
+
+/**
+ @brief      Remove state of objects on which client not subscribed at this moment.
+ @warning    Method should be called within barrier block on \c resourceAccessQueue.
+
+ @since 4.8.2
+ */
+- (void)removeStateForUnsubscribedObjects;
+
 #pragma mark -
 
 
@@ -90,11 +108,20 @@ NS_ASSUME_NONNULL_END
 - (void)inheritStateFromState:(PNClientState *)state {
     
     _stateCache = [state.stateCache mutableCopy];
+    _version++;
 }
 
 
 #pragma mark - Information
 
+- (NSUInteger)version {
+    
+    __block NSUInteger version = 0;
+    dispatch_sync(self.resourceAccessQueue, ^{ version = self->_version; });
+    
+    return version;
+}
+
 - (NSDictionary *)state {
     
     __block NSDictionary *state = nil;
@@ -135,24 +162,57 @@ NS_ASSUME_NONNULL_END
             [state enumerateKeysAndObjectsUsingBlock:^(NSString *objectName, NSDictionary *stateForObject,
                                                        __unused BOOL *stateEnumeratorStop) {
                 
-                self.stateCache[objectName] = stateForObject;
+                if (![self.stateCache[objectName] isEqual:stateForObject]) {
+                    
+                    self.stateCache[objectName] = stateForObject;
+                    self->_version++;
+                }
             }];
             
-            // Clean up state cache from objects on which client not subscribed at this moment.
-            NSMutableArray *objects = [NSMutableArray arrayWithArray:[self.stateCache allKeys]];
-            [objects removeObjectsInArray:[self.client.subscriberManager allObjects]];
-            [objects removeObjectsInArray:[self.client.heartbeatManager allObjects]];
-            [self removeStateForObjects:objects];
+            [self removeStateForUnsubscribedObjects];
         });
     }
 }
 
+- (NSDictionary *)mergeWithState:(NSDictionary<NSString *, id> *)state forObjects:(NSArray<NSString *> *)objects
+                         version:(NSUInteger *)version {
+    
+    __block NSDictionary *mergedState = nil;
+    dispatch_barrier_sync(self.resourceAccessQueue, ^{
+        
+        NSMutableDictionary *mutableState = [NSMutableDictionary new];
+        for (NSString *objectName in objects) {
+            
+            NSDictionary *stateForObject = (state[objectName] ?: self.stateCache[objectName]);
+            if (!stateForObject) { continue; }
+            
+            mutableState[objectName] = stateForObject;
+            if (![self.stateCache[objectName] isEqual:stateForObject]) {
+                
+                self.stateCache[objectName] = stateForObject;
+                self->_version++;
+            }
+        }
+        
+        mergedState = (mutableState.count ? [mutableState copy] : nil);
+        if (version) { *version = self->_version; }
+    });
+    
+    if (mergedState.count) {
+        
+        dispatch_barrier_async(self.resourceAccessQueue, ^{ [self removeStateForUnsubscribedObjects]; });
+    }
+    
+    return mergedState;
+}
+
 - (void)setState:(NSDictionary<NSString *, id> *)state forObject:(NSString *)object {
 
     dispatch_barrier_async(self.resourceAccessQueue, ^{
         
         if (state.count) { self.stateCache[object] = state; }
         else { [self.stateCache removeObjectForKey:object]; }
+        self->_version++;
     });
 }
 
@@ -160,10 +220,24 @@ NS_ASSUME_NONNULL_END
     
     dispatch_barrier_async(self.resourceAccessQueue, ^{
         
+        NSUInteger count = self.stateCache.count;
         if (objects.count) { [self.stateCache removeObjectsForKeys:objects]; }
+        if (count != self.stateCache.count) { self->_version++; }
     });
 }
 
+
+#pragma mark - Misc
+
+- (void)removeStateForUnsubscribedObjects {
+    
+    // Clean up state cache from objects on which client not subscribed at this moment.
+    NSMutableArray *objects = [NSMutableArray arrayWithArray:[self.stateCache allKeys]];
+    [objects removeObjectsInArray:[self.client.subscriberManager allObjects]];
+    [objects removeObjectsInArray:[self.client.heartbeatManager allObjects]];
+    [self removeStateForObjects:objects];
+}
+
 #pragma mark -
 
 
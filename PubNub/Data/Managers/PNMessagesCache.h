@@ -0,0 +1,106 @@
+#import <Foundation/Foundation.h>
+
+
+NS_ASSUME_NONNULL_BEGIN
+
+/**
+ @brief      Class which is used by subscriber to store information about recently received messages.
+ @discussion Cache used by messages 'de-dupe' logic to prevent same messages delivery to objects event
+             listeners. Cache has fixed capacity and evict oldest entries when it is full. Messages identified
+             by their time token, channel name and payload digest, so insertion, lookup and eviction
+             performed in constant time. Entries also ordered by time token, so entries for catch up clean up
+             found with binary search. After clean up remaining entries compacted, so freed space used for
+             new messages.
+ @warning    Cache doesn't serialize access to it's content. Caller responsible for calling it's methods from
+             the same queue.
+
+ @author Sergey Mamontov
+ @since 4.8.2
+ @copyright © 2009-2017 PubNub, Inc.
+ */
+@interface PNMessagesCache : NSObject
+
+
+///------------------------------------------------
+/// @name Information
+///------------------------------------------------
+
+/**
+ @brief  Maximum number of messages which can be stored in cache.
+
+ @since 4.8.2
+ */
+@property (nonatomic, readonly, assign) NSUInteger capacity;
+
+/**
+ @brief  Number of messages which is stored in cache at this moment.
+
+ @since 4.8.2
+ */
+@property (nonatomic, readonly, assign) NSUInteger count;
+
+
+///------------------------------------------------
+/// @name Initialization and Configuration
+///------------------------------------------------
+
+/**
+ @brief  Construct messages cache with fixed capacity.
+
+ @param capacity Maximum number of messages which can be stored in cache. If \b 0 is passed, cache won't store
+                 anything and all messages will be treated as unique.
+
+ @return Configured and ready to use messages cache.
+
+ @since 4.8.2
+ */
++ (instancetype)cacheWithCapacity:(NSUInteger)capacity;
+
+/**
+ @brief      Copy messages from another cache.
+ @discussion Messages will be copied from oldest to newest, so if receiver's capacity is smaller than amount
+             of messages in \c cache, oldest of them will be evicted.
+
+ @param cache Reference on cache from which messages should be copied.
+
+ @since 4.8.2
+ */
+- (void)inheritMessagesFromCache:(PNMessagesCache *)cache;
+
+
+///------------------------------------------------
+/// @name Messages
+///------------------------------------------------
+
+/**
+ @brief      Try to store message in cache.
+ @discussion If cache is full, oldest message will be evicted to free space for new entry.
+
+ @param message   Reference on message payload which should be stored.
+ @param timetoken Reference on time token at which message has been published.
+ @param channel   Name of channel to which message has been published.
+
+ @return \c YES in case if message hasn't been received before and listeners should be notified about it.
+
+ @since 4.8.2
+ */
+- (BOOL)storeMessage:(nullable id)message withTimetoken:(NSNumber *)timetoken forChannel:(NSString *)channel;
+
+/**
+ @brief      Remove from cache messages which has been published at same or newer date than passed
+             \c timetoken.
+ @discussion Method used for subscriptions where user pass specific \c timetoken to which client should catch
+             up, so messages which has been received before can be delivered once more.
+
+ @param timetoken Reference on time token starting from which messages should be removed.
+
+ @since 4.8.2
+ */
+- (void)removeMessagesNewerThan:(NSNumber *)timetoken;
+
+#pragma mark -
+
+
+@end
+
+NS_ASSUME_NONNULL_END
@@ -0,0 +1,479 @@
+/**
+ @author Sergey Mamontov
+ @since 4.8.2
+ @copyright © 2009-2017 PubNub, Inc.
+ */
+#import "PNMessagesCache.h"
+
+
+#pragma mark Static
+
+/**
+ @brief  FNV-1a offset basis which is used as initial value for message payload digest.
+
+ @since 4.8.2
+ */
+static uint64_t const kPNMessageDigestOffsetBasis = 0xcbf29ce484222325ULL;
+
+/**
+ @brief  FNV-1a prime which is used to mix message payload bytes into digest.
+
+ @since 4.8.2
+ */
+static uint64_t const kPNMessageDigestPrime = 0x100000001b3ULL;
+
+
+#pragma mark - Private interface declaration
+
+NS_ASSUME_NONNULL_BEGIN
+
+/**
+ @brief  Class which is used to store information about single cached message.
+
+ @since 4.8.2
+ */
+@interface PNMessagesCacheEntry : NSObject
+
+
+#pragma mark - Information
+
+/**
+ @brief  Unique message identifier composed from time token, channel name and payload digest.
+
+ @since 4.8.2
+ */
+@property (nonatomic, copy) NSString *identifier;
+
+/**
+ @brief  Time token at which message has been published.
+
+ @since 4.8.2
+ */
+@property (nonatomic, assign) unsigned long long timetoken;
+
+/**
+ @brief  Index of ring buffer slot in which entry is stored.
+
+ @since 4.8.2
+ */
+@property (nonatomic, assign) NSUInteger slotIndex;
+
+/**
+ @brief  Reference on message payload which is used to verify whether messages with same identifier really
+         equal.
+
+ @since 4.8.2
+ */
+@property (nonatomic, strong) id message;
+
+#pragma mark -
+
+
+@end
+
+
+#pragma mark - Protected interface declaration
+
+@interface PNMessagesCache ()
+
+
+#pragma mark - Information
+
+@property (nonatomic, assign) NSUInteger capacity;
+
+/**
+ @brief      Stores reference on ring buffer with cached messages in order in which they has been stored.
+ @discussion Buffer grows till cache capacity is reached and after that new entries replace oldest one.
+             Buffer compacted after catch up clean up, so it never has empty slots.
+
+ @since 4.8.2
+ */
+@property (nonatomic, strong) NSMutableArray<PNMessagesCacheEntry *> *entries;
+
+/**
+ @brief      Stores reference on list of cached entries sorted by their time token.
+ @discussion Messages mostly arrive in time token order, so new entries usually appended to the end of list.
+             Sorted list allow to find all entries newer than specified time token with binary search.
+
+ @since 4.8.2
+ */
+@property (nonatomic, strong) NSMutableArray<PNMessagesCacheEntry *> *orderedEntries;
+
+/**
+ @brief  Stores index in ring buffer at which next entry should be stored.
+
+ @since 4.8.2
+ */
+@property (nonatomic, assign) NSUInteger nextEntryIndex;
+
+/**
+ @brief  Stores reference on map of message identifiers to cached entries.
+
+ @since 4.8.2
+ */
+@property (nonatomic, strong) NSMutableDictionary<NSString *, PNMessagesCacheEntry *> *entriesIndex;
+
+
+#pragma mark - Initialization and Configuration
+
+/**
+ @brief  Initialize messages cache with fixed capacity.
+
+ @param capacity Maximum number of messages which can be stored in cache.
+
+ @return Initialized and ready to use messages cache.
+
+ @since 4.8.2
+ */
+- (instancetype)initWithCapacity:(NSUInteger)capacity;
+
+
+#pragma mark - Messages
+
+/**
+ @brief      Store entry in ring buffer and index.
+ @discussion If cache is full, oldest entry will be evicted from ring buffer and index.
+
+ @param entry Reference on entry which should be stored.
+
+ @since 4.8.2
+ */
+- (void)storeEntry:(PNMessagesCacheEntry *)entry;
+
+/**
+ @brief  Remove entry from time token ordered list.
+
+ @param entry Reference on entry which should be removed.
+
+ @since 4.8.2
+ */
+- (void)removeOrderedEntry:(PNMessagesCacheEntry *)entry;
+
+/**
+ @brief      Move entries which left after catch up clean up to the beginning of ring buffer.
+ @discussion Entries removed by catch up clean up may be spread across whole ring buffer. Remaining entries
+             stored from oldest to newest, so buffer will grow again into freed slots and new entries won't
+             evict live entries till cache capacity is reached.
+
+ @since 4.8.2
+ */
+- (void)compactEntries;
+
+
+#pragma mark - Misc
+
+/**
+ @brief  Compose unique message identifier.
+
+ @param message   Reference on message payload for which identifier should be composed.
+ @param timetoken Reference on time token at which message has been published.
+ @param channel   Name of channel to which message has been published.
+
+ @return Message identifier which can be used with index.
+
+ @since 4.8.2
+ */
+- (NSString *)identifierForMessage:(id)message withTimetoken:(NSNumber *)timetoken channel:(NSString *)channel;
+
+/**
+ @brief      Calculate message payload digest.
+ @discussion FNV-1a used to calculate digest from payload content without serialization. Digest of
+             dictionary doesn't depend on order of it's keys, so equal payloads always have same digest.
+
+ @param message Reference on message payload for which digest should be calculated.
+
+ @return Message payload digest.
+
+ @since 4.8.2
+ */
+- (uint64_t)digestForMessage:(id)message;
+
+/**
+ @brief  Mix bytes into digest.
+
+ @param digest Digest which should be updated.
+ @param bytes  Pointer on bytes which should be mixed into \c digest.
+ @param length Number of bytes which should be mixed.
+
+ @return Updated digest.
+
+ @since 4.8.2
+ */
+- (uint64_t)digest:(uint64_t)digest byMixingBytes:(const void *)bytes length:(NSUInteger)length;
+
+/**
+ @brief  Comparator which is used to order cache entries by their time token.
+
+ @return Block which compare cache entries.
+
+ @since 4.8.2
+ */
+- (NSComparator)timetokenComparator;
+
+#pragma mark -
+
+
+@end
+
+NS_ASSUME_NONNULL_END
+
+
+#pragma mark - Interface implementation
+
+@implementation PNMessagesCacheEntry
+@end
+
+
+#pragma mark - Interface implementation
+
+@implementation PNMessagesCache
+
+
+#pragma mark - Information
+
+- (NSUInteger)count {
+
+    return self.entriesIndex.count;
+}
+
+
+#pragma mark - Initialization and Configuration
+
++ (instancetype)cacheWithCapacity:(NSUInteger)capacity {
+
+    return [[self alloc] initWithCapacity:capacity];
+}
+
+- (instancetype)initWithCapacity:(NSUInteger)capacity {
+
+    // Check whether initialization was successful or not.
+    if ((self = [super init])) {
+
+        _capacity = capacity;
+        _entries = [NSMutableArray arrayWithCapacity:capacity];
+        _orderedEntries = [NSMutableArray arrayWithCapacity:capacity];
+        _entriesIndex = [NSMutableDictionary dictionaryWithCapacity:capacity];
+    }
+
+    return self;
+}
+
+- (void)inheritMessagesFromCache:(PNMessagesCache *)cache {
+
+    NSUInteger entriesCount = cache.entries.count;
+
+    // Oldest entry is stored at next entry index when buffer is full.
+    NSUInteger oldestEntryIndex = (entriesCount == cache.capacity ? cache.nextEntryIndex : 0);
+    for (NSUInteger entryIdx = 0; entryIdx < entriesCount; entryIdx++) {
+
+        PNMessagesCacheEntry *entry = cache.entries[(oldestEntryIndex + entryIdx) % entriesCount];
+        PNMessagesCacheEntry *entryCopy = [PNMessagesCacheEntry new];
+        entryCopy.identifier = entry.identifier;
+        entryCopy.timetoken = entry.timetoken;
+        entryCopy.message = entry.message;
+        [self storeEntry:entryCopy];
+    }
+}
+
+
+#pragma mark - Messages
+
+- (BOOL)storeMessage:(id)message withTimetoken:(NSNumber *)timetoken forChannel:(NSString *)channel {
+
+    if (self.capacity == 0) {
+        return YES;
+    }
+
+    message = (message ?: [NSNull null]);
+    NSString *identifier = [self identifierForMessage:message withTimetoken:timetoken channel:channel];
+    PNMessagesCacheEntry *cachedEntry = self.entriesIndex[identifier];
+
+    // Entry with same identifier may belong to different message only in case of digest collision. Such
+    // message can't be stored, but still should be delivered.
+    if (cachedEntry) {
+        return ![cachedEntry.message isEqual:message];
+    }
+
+    PNMessagesCacheEntry *entry = [PNMessagesCacheEntry new];
+    entry.identifier = identifier;
+    entry.timetoken = timetoken.unsignedLongLongValue;
+    entry.message = message;
+    [self storeEntry:entry];
+
+    return YES;
+}
+
+- (void)removeMessagesNewerThan:(NSNumber *)timetoken {
+
+    NSUInteger entriesCount = self.orderedEntries.count;
+    if (entriesCount == 0) {
+        return;
+    }
+
+    PNMessagesCacheEntry *bound = [PNMessagesCacheEntry new];
+    bound.timetoken = timetoken.unsignedLongLongValue;
+    NSUInteger boundIndex = [self.orderedEntries indexOfObject:bound
+                                                 inSortedRange:NSMakeRange(0, entriesCount)
+                                                       options:(NSBinarySearchingFirstEqual |
+                                                                NSBinarySearchingInsertionIndex)
+                                               usingComparator:[self timetokenComparator]];
+
+    if (boundIndex < entriesCount) {
+        NSRange removedEntriesRange = NSMakeRange(boundIndex, entriesCount - boundIndex);
+
+        for (PNMessagesCacheEntry *entry in [self.orderedEntries subarrayWithRange:removedEntriesRange]) {
+            [self.entriesIndex removeObjectForKey:entry.identifier];
+        }
+
+        [self.orderedEntries removeObjectsInRange:removedEntriesRange];
+        [self compactEntries];
+    }
+}
+
+- (void)storeEntry:(PNMessagesCacheEntry *)entry {
+
+    if (self.capacity == 0 || self.entriesIndex[entry.identifier]) {
+        return;
+    }
+
+    entry.slotIndex = self.nextEntryIndex;
+    if (self.entries.count < self.capacity) {
+        [self.entries addObject:entry];
+    } else {
+        PNMessagesCacheEntry *evictedEntry = self.entries[self.nextEntryIndex];
+
+        [self.entriesIndex removeObjectForKey:evictedEntry.identifier];
+        [self removeOrderedEntry:evictedEntry];
+        self.entries[self.nextEntryIndex] = entry;
+    }
+
+    NSUInteger entriesCount = self.orderedEntries.count;
+    NSUInteger entryIndex = entriesCount;
+
+    // Check whether entry can't be appended to the end of ordered list.
+    if (entriesCount && self.orderedEntries.lastObject.timetoken > entry.timetoken) {
+        entryIndex = [self.orderedEntries indexOfObject:entry
+                                          inSortedRange:NSMakeRange(0, entriesCount)
+                                                options:(NSBinarySearchingLastEqual |
+                                                         NSBinarySearchingInsertionIndex)
+                                        usingComparator:[self timetokenComparator]];
+    }
+
+    [self.orderedEntries insertObject:entry atIndex:entryIndex];
+    self.entriesIndex[entry.identifier] = entry;
+    self.nextEntryIndex = (self.nextEntryIndex + 1) % self.capacity;
+}
+
+- (void)removeOrderedEntry:(PNMessagesCacheEntry *)entry {
+
+    NSUInteger entriesCount = self.orderedEntries.count;
+    NSUInteger entryIndex = [self.orderedEntries indexOfObject:entry
+                                                 inSortedRange:NSMakeRange(0, entriesCount)
+                                                       options:NSBinarySearchingFirstEqual
+                                               usingComparator:[self timetokenComparator]];
+
+    // Binary search return first entry with same time token, so target entry should be found among them.
+    for (; entryIndex < entriesCount; entryIndex++) {
+        PNMessagesCacheEntry *orderedEntry = self.orderedEntries[entryIndex];
+
+        if (orderedEntry == entry) {
+            [self.orderedEntries removeObjectAtIndex:entryIndex];
+            break;
+        } else if (orderedEntry.timetoken != entry.timetoken) {
+            break;
+        }
+    }
+}
+
+- (void)compactEntries {
+
+    NSUInteger entriesCount = self.entries.count;
+    NSMutableArray<PNMessagesCacheEntry *> *entries = [NSMutableArray arrayWithCapacity:self.capacity];
+
+    // Oldest entry is stored at next entry index when buffer is full.
+    NSUInteger oldestEntryIndex = (entriesCount == self.capacity ? self.nextEntryIndex : 0);
+    for (NSUInteger entryIdx = 0; entryIdx < entriesCount; entryIdx++) {
+        PNMessagesCacheEntry *entry = self.entries[(oldestEntryIndex + entryIdx) % entriesCount];
+
+        if (self.entriesIndex[entry.identifier] == entry) {
+            entry.slotIndex = entries.count;
+            [entries addObject:entry];
+        }
+    }
+
+    self.entries = entries;
+    self.nextEntryIndex = entries.count % self.capacity;
+}
+
+
+#pragma mark - Misc
+
+- (NSString *)identifierForMessage:(id)message withTimetoken:(NSNumber *)timetoken channel:(NSString *)channel {
+
+    return [NSString stringWithFormat:@"%@_%@_%016llx", timetoken, channel, [self digestForMessage:message]];
+}
+
+- (uint64_t)digestForMessage:(id)message {
+
+    // Type marker prevents collision of values which has same string representation (like @"1" and @1).
+    uint8_t type = 0;
+    uint64_t digest = kPNMessageDigestOffsetBasis;
+    if ([message isKindOfClass:[NSString class]]) {
+        NSData *data = [(NSString *)message dataUsingEncoding:NSUTF8StringEncoding];
+        digest = [self digest:[self digest:digest byMixingBytes:&type length:1] byMixingBytes:data.bytes
+                       length:data.length];
+    } else if ([message isKindOfClass:[NSArray class]]) {
+        type = 1;
+        digest = [self digest:digest byMixingBytes:&type length:1];
+
+        for (id object in (NSArray *)message) {
+            uint64_t objectDigest = [self digestForMessage:object];
+            digest = [self digest:digest byMixingBytes:&objectDigest length:sizeof(objectDigest)];
+        }
+    } else if ([message isKindOfClass:[NSDictionary class]]) {
+        type = 2;
+        __block uint64_t pairsDigest = 0;
+
+        // Pair digests combined with commutative operation, so keys order doesn't affect result.
+        [(NSDictionary *)message enumerateKeysAndObjectsUsingBlock:^(id key, id object, __unused BOOL *stop) {
+            uint64_t pair[2] = { [self digestForMessage:key], [self digestForMessage:object] };
+            pairsDigest += [self digest:kPNMessageDigestOffsetBasis byMixingBytes:pair length:sizeof(pair)];
+        }];
+        digest = [self digest:[self digest:digest byMixingBytes:&type length:1] byMixingBytes:&pairsDigest
+                       length:sizeof(pairsDigest)];
+    } else {
+        type = ([message isKindOfClass:[NSNumber class]] ? 3 : 4);
+        NSData *data = [[message description] dataUsingEncoding:NSUTF8StringEncoding];
+        digest = [self digest:[self digest:digest byMixingBytes:&type length:1] byMixingBytes:data.bytes
+                       length:data.length];
+    }
+
+    return digest;
+}
+
+- (uint64_t)digest:(uint64_t)digest byMixingBytes:(const void *)bytes length:(NSUInteger)length {
+
+    const uint8_t *data = bytes;
+    for (NSUInteger byteIdx = 0; byteIdx < length; byteIdx++) {
+        digest ^= data[byteIdx];
+        digest *= kPNMessageDigestPrime;
+    }
+
+    return digest;
+}
+
+- (NSComparator)timetokenComparator {
+
+    return ^NSComparisonResult(PNMessagesCacheEntry *entry1, PNMessagesCacheEntry *entry2) {
+        if (entry1.timetoken == entry2.timetoken) {
+            return NSOrderedSame;
+        }
+
+        return (entry1.timetoken < entry2.timetoken ? NSOrderedAscending : NSOrderedDescending);
+    };
+}
+
+#pragma mark -
+
+
+@end
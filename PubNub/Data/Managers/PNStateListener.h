@@ -58,7 +58,8 @@ NS_ASSUME_NONNULL_BEGIN
  @brief      Add observer which conform to \b PNObjectEventListener protocol and would like to receive updates
              based on live feed events and status change.
  @discussion Listener can implement only required callbacks from \b PNObjectEventListener protocol and called 
-             only when desired type of event arrive.
+             only when desired type of event arrive. Listener which implement \c -client:didReceiveMessages:
+             receive messages only in batches.
  
  @param listener Listener which would like to receive updates.
  
@@ -111,6 +112,19 @@ NS_ASSUME_NONNULL_BEGIN
  */
 - (void)notifyMessage:(PNMessageResult *)message;
 
+/**
+ @brief      Notify all batch message listeners about new messages.
+ @discussion If \c messagesAggregationWindow is set in client configuration, messages will be appended to
+             previous batch if it still wait for delivery and it's aggregation window not closed yet.
+ @warning    Method should be called within \b -notifyWithBlock: block to shift execution to private protected
+             queue.
+ 
+ @param messages List of event objects which has been received with single subscribe response.
+ 
+ @since 4.8.2
+ */
+- (void)notifyMessages:(NSArray<PNMessageResult *> *)messages;
+
 /**
  @brief   Notify all presence event listeners about new event.
  @warning Method should be called within \b -notifyWithBlock: block to shift execution to private 
@@ -143,6 +157,32 @@ NS_ASSUME_NONNULL_BEGIN
  */
 - (void)notifyHeartbeatStatus:(PNStatus *)status;
 
+/**
+ @brief      Call \c block as soon as there is free space in pending events queue.
+ @discussion Block will be called right away if pending events queue limit not reached or if configured
+             overflow policy doesn't require to hold subscription loop.
+ 
+ @param block Reference on block which should be called when listeners catch up with pending events.
+ 
+ @since 4.8.2
+ */
+- (void)notifyWhenEventsCapacityAvailable:(dispatch_block_t)block;
+
+
+///------------------------------------------------
+/// @name Metrics
+///------------------------------------------------
+
+/**
+ @brief  Retrieve pending events queue gauges.
+ 
+ @return Dictionary with current (\c events.queue.depth) and maximum (\c events.queue.maxDepth) queue depth
+         and number of dropped (\c events.dropped) and coalesced (\c events.coalesced) events.
+ 
+ @since 4.8.2
+ */
+- (NSDictionary<NSString *, NSNumber *> *)metrics;
+
 #pragma mark -
 
 
@@ -7,9 +7,48 @@
 #import "PNObjectEventListener.h"
 #import "PubNub+CorePrivate.h"
 #import "PNSubscribeStatus.h"
+#import "PNConfiguration.h"
+#import "PNSubscriberResults.h"
 #import "PNHelpers.h"
 
 
+#pragma mark Static
+
+/**
+ @brief  Maximum number of pending events which will be delivered to listeners by single block scheduled on
+         callback queue.
+ 
+ @since 4.8.2
+ */
+static NSUInteger const kPNMaximumEventsPerDelivery = 50;
+
+/**
+ @brief  Keys under which pending event information is stored.
+ 
+ @since 4.8.2
+ */
+static NSString * const kPNEventTypeKey = @"type";
+static NSString * const kPNEventObjectKey = @"object";
+static NSString * const kPNEventListenersKey = @"listeners";
+static NSString * const kPNEventCoalesceKey = @"coalesce";
+static NSString * const kPNEventDeliveryDateKey = @"date";
+
+
+#pragma mark - Types
+
+/**
+ @brief  Types of events which can be delivered to listeners.
+ 
+ @since 4.8.2
+ */
+typedef NS_ENUM(NSUInteger, PNListenerEventType) {
+    PNListenerMessageEvent,
+    PNListenerPresenceEvent,
+    PNListenerStatusEvent,
+    PNListenerMessagesBatchEvent
+};
+
+
 NS_ASSUME_NONNULL_BEGIN
 
 #pragma mark Protected interface declaration
@@ -36,6 +75,15 @@ NS_ASSUME_NONNULL_BEGIN
  */
 @property (nonatomic, strong) NSHashTable<id <PNObjectEventListener>> *messageListeners;
 
+/**
+ @brief  Stores list of listeners which would like to receive all messages from subscribe response at once.
+ 
+ @return Hash table with list of batch message listeners.
+ 
+ @since 4.8.2
+ */
+@property (nonatomic, strong) NSHashTable<id <PNObjectEventListener>> *messagesBatchListeners;
+
 /**
  @brief  Stores list of listeners which would like to be notified when new presence event arrive from remote 
          data feed objects on which client subscribed at this moment.
@@ -62,6 +110,78 @@ NS_ASSUME_NONNULL_BEGIN
  */
 @property (nonatomic, strong) dispatch_queue_t resourceAccessQueue;
 
+/**
+ @brief      Stores list of events which wait for delivery to listeners on callback queue.
+ @discussion Each entry is mutable dictionary which store event type, object, listeners list and key which is
+             used to coalesce events.
+ 
+ @since 4.8.2
+ */
+@property (nonatomic, strong) NSMutableArray<NSMutableDictionary *> *pendingEvents;
+
+/**
+ @brief      Stores number of real-time events which wait for delivery to listeners.
+ @discussion Each message from messages batch counted separately, so queue limit applied to number of
+             messages and not to number of \c pendingEvents entries.
+ 
+ @since 4.8.2
+ */
+@property (nonatomic, assign) NSUInteger pendingEventsCount;
+
+/**
+ @brief      Stores reference on pending events which can be coalesced with new events.
+ @discussion Keys composed from event type and channel name, so only latest event for channel will be stored
+             when \b PNEventsOverflowCoalescePolicy is used.
+ 
+ @since 4.8.2
+ */
+@property (nonatomic, strong) NSMutableDictionary<NSString *, NSMutableDictionary *> *coalescibleEvents;
+
+/**
+ @brief  Stores list of blocks which wait for free space in pending events queue.
+ 
+ @since 4.8.2
+ */
+@property (nonatomic, strong) NSMutableArray<dispatch_block_t> *capacityObservers;
+
+/**
+ @brief  Stores whether pending events delivery block has been scheduled on callback queue.
+ 
+ @since 4.8.2
+ */
+@property (nonatomic, assign, getter = isEventsDeliveryScheduled) BOOL eventsDeliveryScheduled;
+
+/**
+ @brief  Stores maximum number of events which has been waiting for delivery at the same time.
+ 
+ @since 4.8.2
+ */
+@property (nonatomic, assign) NSUInteger maximumPendingEventsCount;
+
+/**
+ @brief  Stores number of events which has been dropped because of queue overflow.
+ 
+ @since 4.8.2
+ */
+@property (nonatomic, assign) NSUInteger droppedEventsCount;
+
+/**
+ @brief  Stores number of events which has been replaced by newer events from same channel.
+ 
+ @since 4.8.2
+ */
+@property (nonatomic, assign) NSUInteger coalescedEventsCount;
+
+/**
+ @brief  Stores reference on lock which is used to protect pending events queue.
+ 
+ @since 4.8.2
+ */
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wpartial-availability"
+@property (nonatomic, assign) os_unfair_lock eventsLock;
+#pragma clang diagnostic pop
+
 
 #pragma mark - Initialization and Configuration
 
@@ -86,6 +206,55 @@ NS_ASSUME_NONNULL_BEGIN
  */
 - (void)notifyStatusObservers:(PNStatus *)status;
 
+/**
+ @brief      Place event into pending events queue.
+ @discussion If queue reached configured limit, overflow policy will be applied to messages and presence
+             events. Statuses never dropped.
+ 
+ @param object    Reference on event object which should be delivered to \c listeners.
+ @param type      One of \b PNListenerEventType enum fields which describe passed \c object.
+ @param listeners List of listeners which should receive event.
+ 
+ @since 4.8.2
+ */
+- (void)enqueueEvent:(id)object ofType:(PNListenerEventType)type
+        forListeners:(NSArray<id <PNObjectEventListener>> *)listeners;
+
+/**
+ @brief      Deliver pending events to listeners.
+ @discussion Method should be called on callback queue. Limited number of events delivered at once, so
+             callback queue won't be blocked for long by events burst.
+ 
+ @since 4.8.2
+ */
+- (void)deliverPendingEvents;
+
+/**
+ @brief      Remove oldest pending messages and presence events.
+ @discussion If messages batch has more messages than should be dropped, only oldest messages removed from
+             it. Statuses never dropped.
+ @warning    Method should be called within \c eventsLock.
+ 
+ @param count Number of real-time events which should be dropped.
+ 
+ @return Number of real-time events which has been dropped (less than \c count in case if there is not
+         enough events which can be dropped).
+ 
+ @since 4.8.2
+ */
+- (NSUInteger)dropOldestPendingEvents:(NSUInteger)count;
+
+/**
+ @brief  Number of real-time events which is stored in pending event entry.
+ 
+ @param event Reference on entry from pending events queue.
+ 
+ @return Number of messages for messages batch or \b 1 for rest of events.
+ 
+ @since 4.8.2
+ */
+- (NSUInteger)eventsCountInPendingEvent:(NSDictionary *)event;
+
 
 #pragma mark - Misc
 
@@ -125,9 +294,14 @@ NS_ASSUME_NONNULL_END
         
         _client = client;
         _messageListeners = [NSHashTable weakObjectsHashTable];
+        _messagesBatchListeners = [NSHashTable weakObjectsHashTable];
         _presenceEventListeners = [NSHashTable weakObjectsHashTable];
         _stateListeners = [NSHashTable weakObjectsHashTable];
         _resourceAccessQueue = dispatch_queue_create("com.pubnub.listener", DISPATCH_QUEUE_SERIAL);
+        _pendingEvents = [NSMutableArray new];
+        _coalescibleEvents = [NSMutableDictionary new];
+        _capacityObservers = [NSMutableArray new];
+        _eventsLock = OS_UNFAIR_LOCK_INIT;
     }
     
     return self;
@@ -141,6 +315,7 @@ NS_ASSUME_NONNULL_END
     
     dispatch_async(self.resourceAccessQueue, ^{
         self.messageListeners = [listener listenersCopyFrom:listener.messageListeners];
+        self.messagesBatchListeners = [listener listenersCopyFrom:listener.messagesBatchListeners];
         self.presenceEventListeners = [listener listenersCopyFrom:listener.presenceEventListeners];
         self.stateListeners = [listener listenersCopyFrom:listener.stateListeners];
     });
@@ -153,7 +328,11 @@ NS_ASSUME_NONNULL_END
     
     dispatch_async(self.resourceAccessQueue, ^{
         
-        if ([listener respondsToSelector:@selector(client:didReceiveMessage:)]) {
+        if ([listener respondsToSelector:@selector(client:didReceiveMessages:)]) {
+            
+            [self.messagesBatchListeners addObject:listener];
+        }
+        else if ([listener respondsToSelector:@selector(client:didReceiveMessage:)]) {
             
             [self.messageListeners addObject:listener];
         }
@@ -174,6 +353,7 @@ NS_ASSUME_NONNULL_END
     dispatch_async(self.resourceAccessQueue, ^{
         
         [self.messageListeners removeObject:listener];
+        [self.messagesBatchListeners removeObject:listener];
         [self.presenceEventListeners removeObject:listener];
         [self.stateListeners removeObject:listener];
     });
@@ -184,6 +364,7 @@ NS_ASSUME_NONNULL_END
     dispatch_async(self.resourceAccessQueue, ^{
             
         [self.messageListeners removeAllObjects];
+        [self.messagesBatchListeners removeAllObjects];
         [self.presenceEventListeners removeAllObjects];
         [self.stateListeners removeAllObjects];
     });
@@ -200,73 +381,313 @@ NS_ASSUME_NONNULL_END
 - (void)notifyMessage:(PNMessageResult *)message {
     
     NSArray<id <PNObjectEventListener>> *listeners = self.messageListeners.allObjects;
+    if (listeners.count) { [self enqueueEvent:message ofType:PNListenerMessageEvent forListeners:listeners]; }
+}
+
+- (void)notifyMessages:(NSArray<PNMessageResult *> *)messages {
+    
+    NSArray<id <PNObjectEventListener>> *listeners = self.messagesBatchListeners.allObjects;
+    if (messages.count && listeners.count) {
+        
+        [self enqueueEvent:messages ofType:PNListenerMessagesBatchEvent forListeners:listeners];
+    }
+}
+
+- (void)notifyPresenceEvent:(PNPresenceEventResult *)event {
+    
+    [self enqueueEvent:event ofType:PNListenerPresenceEvent forListeners:self.presenceEventListeners.allObjects];
+}
+
+- (void)notifyStatusChange:(PNSubscribeStatus *)status {
+    
+    [self notifyStatusObservers:status];
+}
+
+- (void)notifyHeartbeatStatus:(PNStatus *)status {
+    
+    [self notifyStatusObservers:status];
+}
+
+- (void)notifyWhenEventsCapacityAvailable:(dispatch_block_t)block {
+    
+    __block BOOL hasCapacity = YES;
     // Silence static analyzer warnings.
     // Code is aware about this case and at the end will simply call on 'nil' object method.
     // In most cases if referenced object become 'nil' it mean what there is no more need in
     // it and probably whole client instance has been deallocated.
     #pragma clang diagnostic push
     #pragma clang diagnostic ignored "-Warc-repeated-use-of-weak"
-    pn_dispatch_async(self.client.callbackQueue, ^{
+    PNConfiguration *configuration = self.client.configuration;
+    #pragma clang diagnostic pop
+    if (configuration.maximumPendingEvents > 0 &&
+        configuration.eventsOverflowPolicy == PNEventsOverflowBlockPolicy) {
         
-        for (id <PNObjectEventListener> listener in listeners) {
+        pn_lock(&_eventsLock, ^{
             
-            [listener client:self.client didReceiveMessage:message];
-        }
+            hasCapacity = (self->_pendingEventsCount < configuration.maximumPendingEvents);
+            if (!hasCapacity) { [self->_capacityObservers addObject:[block copy]]; }
+        });
+    }
+    
+    if (hasCapacity) { block(); }
+}
+
+
+#pragma mark - Metrics
+
+- (NSDictionary<NSString *, NSNumber *> *)metrics {
+    
+    __block NSDictionary *metrics = nil;
+    pn_lock(&_eventsLock, ^{
+        
+        metrics = @{
+            @"events.queue.depth": @(self->_pendingEventsCount),
+            @"events.queue.maxDepth": @(self->_maximumPendingEventsCount),
+            @"events.dropped": @(self->_droppedEventsCount),
+            @"events.coalesced": @(self->_coalescedEventsCount)
+        };
     });
-    #pragma clang diagnostic pop
+    
+    return metrics;
 }
 
-- (void)notifyPresenceEvent:(PNPresenceEventResult *)event {
+
+#pragma mark - Notification
+
+- (void)notifyStatusObservers:(PNStatus *)status {
+    
+    [self enqueueEvent:status ofType:PNListenerStatusEvent forListeners:self.stateListeners.allObjects];
+}
+
+- (void)enqueueEvent:(id)object ofType:(PNListenerEventType)type
+        forListeners:(NSArray<id <PNObjectEventListener>> *)listeners {
     
-    NSArray<id <PNObjectEventListener>> *listeners = self.presenceEventListeners.allObjects;
     // Silence static analyzer warnings.
     // Code is aware about this case and at the end will simply call on 'nil' object method.
     // In most cases if referenced object become 'nil' it mean what there is no more need in
     // it and probably whole client instance has been deallocated.
     #pragma clang diagnostic push
     #pragma clang diagnostic ignored "-Warc-repeated-use-of-weak"
-    pn_dispatch_async(self.client.callbackQueue, ^{
+    PNConfiguration *configuration = self.client.configuration;
+    NSUInteger maximumPendingEvents = configuration.maximumPendingEvents;
+    PNEventsOverflowPolicy policy = configuration.eventsOverflowPolicy;
+    NSTimeInterval aggregationWindow = configuration.messagesAggregationWindow;
+    NSTimeInterval date = [[NSDate date] timeIntervalSince1970];
+    NSString *coalesceKey = nil;
+    if (type == PNListenerMessagesBatchEvent) { object = [object mutableCopy]; }
+    else if (type != PNListenerStatusEvent && policy == PNEventsOverflowCoalescePolicy) {
+        
+        PNSubscriberData *data = (type == PNListenerMessageEvent ? ((PNMessageResult *)object).data
+                                                                 : ((PNPresenceEventResult *)object).data);
+        NSString *channel = data.channel;
+        if (channel) { coalesceKey = [NSString stringWithFormat:@"%@:%@", @(type), channel]; }
+    }
+    __block NSUInteger eventsCount = (type == PNListenerMessagesBatchEvent ? ((NSArray *)object).count : 1);
+    __block BOOL shouldScheduleDelivery = NO;
+    
+    pn_lock(&_eventsLock, ^{
         
-        for (id <PNObjectEventListener> listener in listeners) {
+        // Overflow policy applied before messages batch merged with pending batch, so each message
+        // counted against queue limit.
+        NSUInteger overflowCount = 0;
+        if (maximumPendingEvents > 0 && self->_pendingEventsCount + eventsCount > maximumPendingEvents) {
+            
+            overflowCount = self->_pendingEventsCount + eventsCount - maximumPendingEvents;
+        }
+        if (overflowCount && type != PNListenerStatusEvent && policy != PNEventsOverflowBlockPolicy) {
+            
+            NSMutableDictionary *pendingEvent = (coalesceKey ? self->_coalescibleEvents[coalesceKey] : nil);
+            if (pendingEvent) {
+                
+                // Replace pending event from same channel with newer one.
+                pendingEvent[kPNEventObjectKey] = object;
+                pendingEvent[kPNEventListenersKey] = listeners;
+                self->_coalescedEventsCount++;
+                
+                return;
+            }
             
-            [listener client:self.client didReceivePresenceEvent:event];
+            NSUInteger droppedEventsCount = [self dropOldestPendingEvents:overflowCount];
+            self->_droppedEventsCount += droppedEventsCount;
+            if (type == PNListenerMessagesBatchEvent && droppedEventsCount < overflowCount) {
+                
+                // Batch doesn't fit into queue even after all pending events has been dropped.
+                NSUInteger trimmedEventsCount = MIN(overflowCount - droppedEventsCount, eventsCount);
+                [(NSMutableArray *)object removeObjectsInRange:NSMakeRange(0, trimmedEventsCount)];
+                self->_droppedEventsCount += trimmedEventsCount;
+                eventsCount -= trimmedEventsCount;
+                
+                if (!eventsCount) { return; }
+            }
         }
+        
+        NSMutableDictionary *lastEvent = self->_pendingEvents.lastObject;
+        if (type == PNListenerMessagesBatchEvent && aggregationWindow > 0.f &&
+            ((NSNumber *)lastEvent[kPNEventTypeKey]).unsignedIntegerValue == PNListenerMessagesBatchEvent &&
+            ((NSNumber *)lastEvent[kPNEventDeliveryDateKey]).doubleValue > date &&
+            [lastEvent[kPNEventListenersKey] isEqualToArray:listeners]) {
+            
+            // Consecutive response received while previous batch aggregation window still open.
+            [(NSMutableArray *)lastEvent[kPNEventObjectKey] addObjectsFromArray:object];
+            self->_pendingEventsCount += eventsCount;
+            self->_maximumPendingEventsCount = MAX(self->_maximumPendingEventsCount, self->_pendingEventsCount);
+            
+            return;
+        }
+        
+        NSMutableDictionary *event = [@{ kPNEventTypeKey: @(type), kPNEventObjectKey: object,
+                                         kPNEventListenersKey: listeners } mutableCopy];
+        if (type == PNListenerMessagesBatchEvent && aggregationWindow > 0.f) {
+            
+            event[kPNEventDeliveryDateKey] = @(date + aggregationWindow);
+        }
+        if (coalesceKey) {
+            
+            event[kPNEventCoalesceKey] = coalesceKey;
+            self->_coalescibleEvents[coalesceKey] = event;
+        }
+        [self->_pendingEvents addObject:event];
+        self->_pendingEventsCount += eventsCount;
+        self->_maximumPendingEventsCount = MAX(self->_maximumPendingEventsCount, self->_pendingEventsCount);
+        
+        shouldScheduleDelivery = !self->_eventsDeliveryScheduled;
+        self->_eventsDeliveryScheduled = YES;
     });
+    
+    if (shouldScheduleDelivery) {
+        
+        pn_dispatch_async(self.client.callbackQueue, ^{ [self deliverPendingEvents]; });
+    }
     #pragma clang diagnostic pop
 }
 
-- (void)notifyStatusChange:(PNSubscribeStatus *)status {
+- (void)deliverPendingEvents {
     
-    [self notifyStatusObservers:status];
-}
-
-- (void)notifyHeartbeatStatus:(PNStatus *)status {
+    NSUInteger maximumPendingEvents = self.client.configuration.maximumPendingEvents;
+    __block NSArray<NSDictionary *> *events = nil;
+    __block NSArray<dispatch_block_t> *capacityObservers = nil;
+    NSTimeInterval date = [[NSDate date] timeIntervalSince1970];
+    __block NSTimeInterval deliveryDelay = 0.f;
+    __block BOOL hasMoreEvents = NO;
+    pn_lock(&_eventsLock, ^{
+        
+        NSRange eventsRange = NSMakeRange(0, MIN(self->_pendingEvents.count, kPNMaximumEventsPerDelivery));
+        for (NSUInteger eventIdx = 0; eventIdx < eventsRange.length; eventIdx++) {
+            
+            // Messages batch (and all events after it) wait till batch aggregation window will be closed.
+            NSNumber *deliveryDate = self->_pendingEvents[eventIdx][kPNEventDeliveryDateKey];
+            if (deliveryDate.doubleValue > date) {
+                
+                deliveryDelay = deliveryDate.doubleValue - date;
+                eventsRange.length = eventIdx;
+                break;
+            }
+        }
+        events = [self->_pendingEvents subarrayWithRange:eventsRange];
+        [self->_pendingEvents removeObjectsInRange:eventsRange];
+        for (NSDictionary *event in events) {
+            
+            NSString *coalesceKey = event[kPNEventCoalesceKey];
+            self->_pendingEventsCount -= [self eventsCountInPendingEvent:event];
+            if (coalesceKey && self->_coalescibleEvents[coalesceKey] == event) {
+                
+                [self->_coalescibleEvents removeObjectForKey:coalesceKey];
+            }
+        }
+        
+        // Subscription loop can continue as soon as there is free space for new events.
+        if (maximumPendingEvents == 0 || self->_pendingEventsCount < maximumPendingEvents) {
+            
+            capacityObservers = [self->_capacityObservers copy];
+            [self->_capacityObservers removeAllObjects];
+        }
+        
+        hasMoreEvents = self->_pendingEvents.count > 0;
+        self->_eventsDeliveryScheduled = hasMoreEvents;
+    });
     
-    [self notifyStatusObservers:status];
-}
-
-
-#pragma mark - Notification
-
-- (void)notifyStatusObservers:(PNStatus *)status {
+    for (dispatch_block_t block in capacityObservers) { block(); }
     
-    NSArray<id <PNObjectEventListener>> *listeners = self.stateListeners.allObjects;
     // Silence static analyzer warnings.
     // Code is aware about this case and at the end will simply call on 'nil' object method.
     // In most cases if referenced object become 'nil' it mean what there is no more need in
     // it and probably whole client instance has been deallocated.
     #pragma clang diagnostic push
     #pragma clang diagnostic ignored "-Warc-repeated-use-of-weak"
-    pn_dispatch_async(self.client.callbackQueue, ^{
+    for (NSDictionary *event in events) {
         
-        for (id <PNObjectEventListener> listener in listeners) {
+        PNListenerEventType type = ((NSNumber *)event[kPNEventTypeKey]).unsignedIntegerValue;
+        id object = event[kPNEventObjectKey];
+        if (type == PNListenerMessagesBatchEvent) { object = [object copy]; }
+        for (id <PNObjectEventListener> listener in event[kPNEventListenersKey]) {
             
-            [listener client:self.client didReceiveStatus:status];
+            if (type == PNListenerMessageEvent) { [listener client:self.client didReceiveMessage:object]; }
+            else if (type == PNListenerMessagesBatchEvent) {
+                
+                [listener client:self.client didReceiveMessages:object];
+            }
+            else if (type == PNListenerPresenceEvent) {
+                
+                [listener client:self.client didReceivePresenceEvent:object];
+            }
+            else { [listener client:self.client didReceiveStatus:object]; }
         }
-    });
+    }
+    
+    dispatch_queue_t callbackQueue = self.client.callbackQueue;
+    if (hasMoreEvents && deliveryDelay > 0.f && callbackQueue) {
+        
+        dispatch_after(dispatch_time(DISPATCH_TIME_NOW, (int64_t)(deliveryDelay * NSEC_PER_SEC)), callbackQueue,
+                       ^{ [self deliverPendingEvents]; });
+    }
+    else if (hasMoreEvents) { pn_dispatch_async(callbackQueue, ^{ [self deliverPendingEvents]; }); }
     #pragma clang diagnostic pop
 }
 
+- (NSUInteger)dropOldestPendingEvents:(NSUInteger)count {
+    
+    NSUInteger droppedEventsCount = 0;
+    NSUInteger eventIdx = 0;
+    while (droppedEventsCount < count && eventIdx < self.pendingEvents.count) {
+        
+        NSDictionary *event = self.pendingEvents[eventIdx];
+        PNListenerEventType type = ((NSNumber *)event[kPNEventTypeKey]).unsignedIntegerValue;
+        if (type == PNListenerStatusEvent) {
+            
+            eventIdx++;
+            continue;
+        }
+        
+        NSUInteger eventsCount = [self eventsCountInPendingEvent:event];
+        NSUInteger requiredCount = count - droppedEventsCount;
+        if (type == PNListenerMessagesBatchEvent && eventsCount > requiredCount) {
+            
+            // Only oldest messages removed from batch.
+            [(NSMutableArray *)event[kPNEventObjectKey] removeObjectsInRange:NSMakeRange(0, requiredCount)];
+            droppedEventsCount += requiredCount;
+            continue;
+        }
+        
+        NSString *coalesceKey = event[kPNEventCoalesceKey];
+        if (coalesceKey && self.coalescibleEvents[coalesceKey] == event) {
+            
+            [self.coalescibleEvents removeObjectForKey:coalesceKey];
+        }
+        [self.pendingEvents removeObjectAtIndex:eventIdx];
+        droppedEventsCount += eventsCount;
+    }
+    self.pendingEventsCount -= droppedEventsCount;
+    
+    return droppedEventsCount;
+}
+
+- (NSUInteger)eventsCountInPendingEvent:(NSDictionary *)event {
+    
+    BOOL isBatch = (((NSNumber *)event[kPNEventTypeKey]).unsignedIntegerValue == PNListenerMessagesBatchEvent);
+    
+    return (isBatch ? ((NSArray *)event[kPNEventObjectKey]).count : 1);
+}
+
 
 #pragma mark - Misc
 
@@ -73,6 +73,18 @@ typedef void(^PNSubscriberCompletionBlock)(PNSubscribeStatus * _Nullable status)
  */
 - (NSArray<NSString *> *)presenceChannels;
 
+/**
+ @brief      Maximum number of long-poll responses which can wait for processing and delivery to listeners
+             when subscribe requests pipelining is enabled.
+ @discussion When this limit is reached, next subscribe request will be postponed till one of batches will be
+             delivered to listeners.
+ 
+ @return Maximum number of pending event batches.
+ 
+ @since 4.8.2
+ */
++ (NSUInteger)maximumPendingEventBatches;
+
 
 ///------------------------------------------------
 /// @name Initialization and Configuration
@@ -12,24 +12,39 @@
 #import "PNErrorStatus+Private.h"
 #import "PNSubscriberResults.h"
 #import "PNRequestParameters.h"
+#import "PNSubscriberSnapshot.h"
+#import "PNMessagesCache.h"
+#import "PNRetryPolicy.h"
 #import "PubNub+CorePrivate.h"
 #import "PNStatus+Private.h"
 #import "PNResult+Private.h"
 #import "PNConfiguration.h"
-#import <objc/runtime.h>
 #import "PNLogMacro.h"
+#import "PNConstants.h"
 #import "PNHelpers.h"
 
 
 #pragma mark Static
 
 /**
- @brief  Reference on time which should be used by retry timer as interval between subscription
-         retry attempts.
- 
- @since 4.0
+ @brief      Maximum number of long-poll responses which can wait for processing and delivery to listeners
+             when subscribe requests pipelining is enabled.
+ @discussion When this limit is reached, next subscribe request will be postponed till one of batches will be
+             delivered to listeners.
+
+ @since 4.8.2
+ */
+static NSUInteger const kPubNubMaximumPendingEventBatches = 10;
+
+/**
+ @brief      Length of subscribe request URL which is reserved for origin, keys and query parameters which is
+             not related to subscription objects list.
+ @discussion This value used to calculate how many channels and groups can be placed into each subscription
+             shard.
+
+ @since 4.8.2
  */
-static NSTimeInterval const kPubNubSubscriptionRetryInterval = 1.0f;
+static NSUInteger const kPubNubSubscribeRequestReservedURLLength = 1024;
 
 
 #pragma mark - Structures
@@ -124,52 +139,125 @@ NS_ASSUME_NONNULL_BEGIN
 @property (nonatomic, assign) BOOL mayRequireSubscriptionRestore;
 
 /**
- @brief  Actual storage for list of channels on which client subscribed at this moment and listen 
-         for updates from live feeds.
- 
- @since 4.0
+ @brief      Stores reference on latest published subscription information snapshot.
+ @discussion Snapshot store list of channels, groups and presence channels on which client subscribed at
+             this moment, subscription loop time tokens, filter expression and retry timer.
+             Property declared as \c atomic, so readers get consistent snapshot with single load and without
+             hop to resource access queue. New snapshot published synchronously (within \c snapshotLock),
+             so writer will read it's own changes right after update.
+
+ @since 4.8.2
  */
-@property (nonatomic, strong) NSMutableSet<NSString *> *channelsSet;
+@property (atomic, strong) PNSubscriberSnapshot *snapshot;
 
 /**
- @brief  Actual storage for list of channel groups on which client subscribed at this moment and 
-         listen for updates from live feeds.
- 
- @since 4.0
+ @brief  Stores reference on lock which is used to serialize subscription information snapshot updates.
+
+ @since 4.8.2
  */
-@property (nonatomic, strong) NSMutableSet<NSString *> *channelGroupsSet;
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wpartial-availability"
+@property (nonatomic, assign) os_unfair_lock snapshotLock;
+#pragma clang diagnostic pop
 
 /**
- @brief  Actual storage for list of presence channels on which client subscribed at this moment and
-         listen for presence updates.
- 
- @since 4.0
+ @brief      Stores whether subscriber handle part of subscription objects for another subscriber.
+ @discussion Shard subscribers run their own subscribe loop. Connection state changes doesn't reported to
+             listeners, but errors forwarded to \c primarySubscriber.
+
+ @since 4.8.2
  */
-@property (nonatomic, strong) NSMutableSet<NSString *> *presenceChannelsSet;
+@property (nonatomic, assign, getter = isShard) BOOL shard;
 
 /**
- @brief  Stores reference on dictionary which is used in messages 'de-dupe' logic to prevent same messages 
-         or prsence events delivering to objects event listeners.
- 
- @since 4.5.8
+ @brief  Stores reference on subscriber for which receiver handle part of subscription objects.
+
+ @since 4.8.2
+ */
+@property (nonatomic, nullable, weak) PNSubscriber *primarySubscriber;
+
+/**
+ @brief      Stores reference on list of subscribers which handle rest of subscription objects which doesn't
+             fit into single subscribe request.
+ @discussion List is empty if all channels and groups can be used with single subscribe request.
+
+ @since 4.8.2
  */
-@property (nonatomic, strong) NSMutableDictionary<NSString *, NSMutableArray<NSDictionary *> *> *cachedObjects;
+@property (nonatomic, strong) NSMutableArray<PNSubscriber *> *shards;
 
 /**
- @brief      Stores reference on list of cached object identifiers.
- @discussion Array used every time when maximum cached objects count has been reached to clean up cache 
-             from older entries.
+ @brief      Stores reference on list of channels (including presence) which should be used with subscribe
+             request of receiver.
+ @discussion \c nil in case if subscription objects doesn't require sharding.
+
+ @since 4.8.2
+ */
+@property (nonatomic, nullable, copy) NSArray<NSString *> *shardChannels;
+
+/**
+ @brief      Stores reference on list of channel groups which should be used with subscribe request of
+             receiver.
+ @discussion \c nil in case if subscription objects doesn't require sharding.
+
+ @since 4.8.2
+ */
+@property (nonatomic, nullable, copy) NSArray<NSString *> *shardChannelGroups;
+
+/**
+ @brief  Stores whether subscription objects list has been changed and shards should be re-calculated.
+
+ @since 4.8.2
+ */
+@property (nonatomic, assign) BOOL shouldUpdateShards;
+
+/**
+ @brief      Stores version of subscription objects list.
+ @discussion Version changed each time when channels, groups, shard objects or filter expression change and
+             used to detect whether cached subscribe request components can be used or not.
+
+ @since 4.8.2
+ */
+@property (nonatomic, assign) NSUInteger objectsListVersion;
+
+/**
+ @brief      Stores reference on percent-encoded subscribe request components which has been composed for
+             current subscription objects list and client state.
+ @discussion Dictionary may contain \c channels, \c groups and \c state keys. Components re-used by
+             subscription loop as long as subscription objects list and client state not changed, so each
+             next long-poll request require only time token and region update.
+
+ @since 4.8.2
+ */
+@property (nonatomic, nullable, strong) NSDictionary<NSString *, NSString *> *subscribeRequestComponents;
+
+/**
+ @brief  Stores version of subscription objects list for which \c subscribeRequestComponents has been composed.
+
+ @since 4.8.2
+ */
+@property (nonatomic, assign) NSUInteger subscribeRequestObjectsListVersion;
+
+/**
+ @brief  Stores version of client state for which \c subscribeRequestComponents has been composed.
+
+ @since 4.8.2
+ */
+@property (nonatomic, assign) NSUInteger subscribeRequestStateVersion;
+
+/**
+ @brief  Stores reference on cache which is used in messages 'de-dupe' logic to prevent same messages 
+         delivering to objects event listeners.
  
- @since 4.5.8
+ @since 4.8.2
  */
-@property (nonatomic, strong) NSMutableArray<NSString *> *cachedObjectIdentifiers;
+@property (nonatomic, strong) PNMessagesCache *messagesCache;
 
 /**
  @brief  Stores reference on percent-escaped message filtering expression.
  
  @since 4.3.0
  */
-@property (nonatomic, nullable, copy) NSString *escapedFilterExpression;
+@property (nonatomic, nullable, readonly, copy) NSString *escapedFilterExpression;
 
 /**
  @brief      Reference on time token which is used for current subscribe loop iteration.
@@ -231,6 +319,49 @@ NS_ASSUME_NONNULL_BEGIN
  */
 @property (nonatomic, nullable, strong) dispatch_source_t retryTimer;
 
+/**
+ @brief      Stores reference on policy which is used to calculate delay between subscription retry attempts.
+ @discussion Policy reset as soon as subscribe request will be successfully completed.
+ 
+ @since 4.8.2
+ */
+@property (nonatomic, strong) PNRetryPolicy *retryPolicy;
+
+/**
+ @brief      Stores reference on queue which is used to process received events when subscribe requests
+             pipelining is enabled.
+ @discussion Events de-duplication and delivery scheduling performed on this queue while next long-poll
+             request already sent to \b PubNub network.
+
+ @since 4.8.2
+ */
+@property (nonatomic, strong) dispatch_queue_t eventsProcessingQueue;
+
+/**
+ @brief  Stores number of long-poll responses which has been passed to events processing queue and still not
+         delivered to listeners.
+
+ @since 4.8.2
+ */
+@property (nonatomic, assign) NSUInteger pendingEventBatchesCount;
+
+/**
+ @brief  Stores whether next subscription cycle has been postponed because of too many pending event batches.
+
+ @since 4.8.2
+ */
+@property (nonatomic, assign, getter = isSubscriptionCycleDeferred) BOOL subscriptionCycleDeferred;
+
+/**
+ @brief  Stores reference on lock which is used to protect events pipeline counters.
+
+ @since 4.8.2
+ */
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wpartial-availability"
+@property (nonatomic, assign) os_unfair_lock eventsPipelineLock;
+#pragma clang diagnostic pop
+
 
 #pragma mark - Initialization and Configuration
 
@@ -245,9 +376,41 @@ NS_ASSUME_NONNULL_BEGIN
  */
 - (instancetype)initForClient:(PubNub *)client;
 
+/**
+ @brief  Construct subscriber which will handle part of subscription objects for another subscriber.
+
+ @param subscriber Reference on subscriber for which shard should be created.
+
+ @return Configured and ready to use subscriber shard.
+
+ @since 4.8.2
+ */
++ (instancetype)shardForSubscriber:(PNSubscriber *)subscriber;
+
 
 #pragma mark - Subscription information modification
 
+/**
+ @brief      Update subscription information snapshot.
+ @discussion Block receive mutable copy of currently published snapshot and it's immutable copy will be
+             published right after block execution.
+ @warning    Block shouldn't update snapshot again, because snapshot updates serialized with non-recursive
+             lock.
+
+ @param block Reference on block which should modify passed snapshot.
+
+ @since 4.8.2
+ */
+- (void)updateSnapshotWithBlock:(void(^)(PNMutableSubscriberSnapshot *snapshot))block;
+
+/**
+ @brief  Mark subscription objects list as changed, so shards and subscribe request components will be
+         composed again.
+
+ @since 4.8.2
+ */
+- (void)invalidateObjectsList;
+
 /**
  @brief      Update current subscriber state.
  @discussion If possible, state transition will be reported to the listeners.
@@ -287,9 +450,10 @@ NS_ASSUME_NONNULL_BEGIN
 
 /**
  @brief      Launch subscription retry timer.
- @discussion Launch timer with default 1 second interval after each subscribe attempt. In most of cases timer
-             used to retry subscription after PubNub Access Manager denial because of client doesn't has 
-             enough rights.
+ @discussion Launch timer with interval calculated by retry policy after each subscribe attempt. In most of
+             cases timer used to retry subscription after PubNub Access Manager denial because of client
+             doesn't has enough rights. Timer won't be launched if retry budget exhausted, except for
+             shard subscriber which isn't restored by reachability and continue retry with maximum delay.
 
  @since 4.0
  */
@@ -305,6 +469,90 @@ NS_ASSUME_NONNULL_BEGIN
 - (void)stopRetryTimer;
 
 
+#pragma mark - Sharding
+
+/**
+ @brief      Split subscription objects between receiver and shard subscribers if required.
+ @discussion Shards re-calculated only for initial subscription or when list of subscription objects has
+             been changed.
+
+ @param initialSubscribe Whether client trying to subscribe using \b 0 time token.
+ @param state            Reference on client state which should be bound to channels on which client has
+                         been subscribed or will subscribe now.
+
+ @return List of shard subscribers which should perform initial subscription.
+
+ @since 4.8.2
+ */
+- (NSArray<PNSubscriber *> *)updateShardsIfRequired:(BOOL)initialSubscribe
+                                          withState:(nullable NSDictionary<NSString *, id> *)state;
+
+/**
+ @brief      Split channels and groups into lists which fit into subscribe request URL.
+ @discussion Objects which already has been assigned to one of shards stay in it, because each shard has own
+             time token and moved object would miss events which has been received by shard with older time
+             token. New objects appended to last shard while their encoded names length fit into length
+             which is left after reserved for rest of query parameters (including client state and filter
+             expression).
+
+ @param channels       List of channels (including presence) which should be split.
+ @param groups         List of channel groups which should be split.
+ @param previousShards List of dictionaries with \c channels and \c groups keys which describe current
+                       objects assignment (first entry for receiver).
+ @param state          Reference on client state which will be sent along with subscribe request.
+
+ @return List of dictionaries with \c channels and \c groups keys. Entries for shards from
+         \c previousShards returned at same indices (empty if shard lost all it's objects).
+
+ @since 4.8.2
+ */
+- (NSArray<NSDictionary<NSString *, NSArray<NSString *> *> *> *)shardsForChannels:(NSArray<NSString *> *)channels
+                                                                           groups:(NSArray<NSString *> *)groups
+                                                                   previousShards:(nullable NSArray<NSDictionary *> *)previousShards
+                                                                        withState:(nullable NSDictionary *)state;
+
+/**
+ @brief      Copy subscription loop information from another subscriber.
+ @discussion Used when objects of one subscriber passed to another, so they will catch up from time token
+             which has been used for them before.
+
+ @param subscriber       Reference on subscriber from which time tokens should be copied.
+ @param initialSubscribe Whether receiver is about to subscribe using \b 0 time token (copied time token
+                         will be used to catch up).
+
+ @since 4.8.2
+ */
+- (void)inheritTimeTokenFromSubscriber:(PNSubscriber *)subscriber forInitialSubscribe:(BOOL)initialSubscribe;
+
+/**
+ @brief  Replace list of subscription objects for shard subscriber.
+
+ @param channels List of channels (including presence) which should be handled by shard.
+ @param groups   List of channel groups which should be handled by shard.
+
+ @since 4.8.2
+ */
+- (void)setShardChannels:(NSArray<NSString *> *)channels groups:(NSArray<NSString *> *)groups;
+
+/**
+ @brief  Stop subscribe loop of all shard subscribers and release them.
+
+ @since 4.8.2
+ */
+- (void)removeShards;
+
+/**
+ @brief      Handle status change of one of shard subscribers.
+ @discussion Shard's errors (like access denied for channels from shard) reported to listeners by subscriber
+             which manage shards.
+
+ @param status Reference on status object which should be passed along to listeners.
+
+ @since 4.8.2
+ */
+- (void)handleShardStatus:(PNSubscribeStatus *)status;
+
+
 #pragma mark - Unsubscription
 
 /**
@@ -388,6 +636,58 @@ NS_ASSUME_NONNULL_BEGIN
 - (void)handleLiveFeedEvents:(PNSubscribeStatus *)status forInitialSubscription:(BOOL)initialSubscription 
            overrideTimeToken:(nullable NSNumber *)overrideTimeToken;
 
+/**
+ @brief      Pass received events to separate processing stage and continue subscription cycle.
+ @discussion Next subscribe request will be sent right away if there is not too many event batches which
+             wait for delivery. Otherwise subscription cycle will be continued as soon as one of them will be
+             delivered to listeners.
+
+ @param events              List of events which has been received from \b PubNub network.
+ @param status              Reference on status object which has been received from \b PubNub network.
+ @param initialSubscription Whether events has been received in response on initial subscription request.
+ @param overrideTimeToken   Reference on timetoken which is used to override timetoken which has been received
+                            during initial subscription.
+
+ @since 4.8.2
+ */
+- (void)enqueueLiveFeedEvents:(NSMutableArray<NSDictionary *> *)events fromStatus:(PNSubscribeStatus *)status
+       forInitialSubscription:(BOOL)initialSubscription overrideTimeToken:(nullable NSNumber *)overrideTimeToken;
+
+/**
+ @brief  Handle delivery of events batch which has been processed on events processing queue.
+
+ @since 4.8.2
+ */
+- (void)handleLiveFeedEventsBatchDelivery;
+
+/**
+ @brief      Clean up list of received events before delivery to listeners.
+ @discussion Remove from \c events messages which has been received before and clean up messages cache if
+             user requested catch up from specific timetoken.
+
+ @param events              List of events which has been received from \b PubNub network.
+ @param initialSubscription Whether events has been received in response on initial subscription request.
+ @param overrideTimeToken   Reference on timetoken which is used to override timetoken which has been received
+                            during initial subscription.
+
+ @since 4.8.2
+ */
+- (void)prepareLiveFeedEvents:(NSMutableArray<NSDictionary *> *)events
+       forInitialSubscription:(BOOL)initialSubscription overrideTimeToken:(nullable NSNumber *)overrideTimeToken;
+
+/**
+ @brief      Deliver received events to listeners.
+ @warning    Method should be called within \c -notifyWithBlock: of listeners manager.
+
+ @param events        List of events which should be delivered to listeners.
+ @param eventsCount   Number of events which has been received in response (before de-duplication).
+ @param status        Reference on status object which has been received from \b PubNub network.
+
+ @since 4.8.2
+ */
+- (void)notifyLiveFeedEvents:(NSArray<NSDictionary *> *)events receivedCount:(NSUInteger)eventsCount
+                  fromStatus:(PNSubscribeStatus *)status;
+
 /**
  @brief  Process message which just has been received from \b PubNub service through live feed on which client
          subscribed at this moment.
@@ -395,9 +695,12 @@ NS_ASSUME_NONNULL_BEGIN
  @param data Reference on result data which hold information about request on which this response has been 
              received and message itself.
  
+ @return \c YES in case if message has been delivered to message listeners (\c NO if decryption error status
+         has been reported instead).
+ 
  @since 4.0
  */
-- (void)handleNewMessage:(PNMessageResult *)data;
+- (BOOL)handleNewMessage:(PNMessageResult *)data;
 
 /**
  @brief  Process presence event which just has been received from \b PubNub service through presence live
@@ -424,6 +727,21 @@ NS_ASSUME_NONNULL_BEGIN
  */
 - (PNRequestParameters *)subscribeRequestParametersWithState:(nullable NSDictionary<NSString *, id> *)state;
 
+/**
+ @brief      Compose percent-encoded subscribe request components for current subscription objects list.
+ @discussion Composed components stored by receiver and re-used by subscribe requests till subscription
+             objects list or client state will change. Components composed with explicitly passed \c state
+             won't be stored.
+
+ @param state Reference on client state which should be bound to channels on which client has been subscribed
+              or will subscribe now.
+
+ @return Dictionary with \c channels, \c groups and \c state request components.
+
+ @since 4.8.2
+ */
+- (NSDictionary<NSString *, NSString *> *)subscribeRequestComponentsWithState:(nullable NSDictionary<NSString *, id> *)state;
+
 /**
  @brief      Clean up \c events list from messages which has been already received.
  @discussion Use messages cache to identify message duplicates and remove them from input \c events list so 
@@ -440,38 +758,12 @@ NS_ASSUME_NONNULL_BEGIN
 /**
  @brief      Remove from messages cache those who has date same or newer than passed \c timetoken.
  @discussion Method used for subscriptions where user pass specific \c timetoken to which client should catch
-             up. It expensive to run, but subscriptions to specific \c timetoken pretty rare and shouldn't 
-             affect overall performance. 
+             up. Messages cache ordered by time token, so clean up require only binary search and range
+             removal.
  @warning    Method should be called within resource access queue to prevent race of conditions.
  */
 - (void)clearCacheFromMessagesNewerThan:(NSNumber *)timetoken;
 
-/**
- @brief      Store to cache passed \c object.
- @discussion This method used by 'de-dupe' logic to identify unique objects about which object listeners 
-             should be notified.
- @warning    Method should be called within resource access queue to prevent race of conditions.
- 
- @since 4.5.8
- 
- @param object Reference on object which client should try to store in cache.
- @param size   Maximum number of objects which can be stored in cache and used during messages de-dpublication
-               process.
- 
- @return \c YES in case if object successfuly stored in cache and object listeners should be notified about 
-         it.
- */
-- (BOOL)cacheObjectIfPossible:(NSDictionary *)object withMaximumCacheSize:(NSUInteger)size;
-
-/**
- @brief  Shrink messages cache size to specified size if required.
- 
- @since 4.5.8
- 
- @param maximumCacheSize Messages cache maximum size.
- */
-- (void)cleanUpCachedObjectsIfRequired:(NSUInteger)maximumCacheSize;
-
 /**
  @brief  Append subscriber information to status object.
  
@@ -493,50 +785,43 @@ NS_ASSUME_NONNULL_END
 
 @implementation PNSubscriber
 
-@synthesize retryTimer = _retryTimer;
-@synthesize overrideTimeToken = _overrideTimeToken;
-@synthesize currentTimeToken = _currentTimeToken;
-@synthesize lastTimeToken = _lastTimeToken;
-@synthesize currentTimeTokenRegion = _currentTimeTokenRegion;
-@synthesize lastTimeTokenRegion = _lastTimeTokenRegion;
-@synthesize filterExpression = _filterExpression;
-
 
 #pragma mark - Information
 
 - (dispatch_source_t)retryTimer {
     
-    __block dispatch_source_t retryTimer = nil;
-    pn_safe_property_read(self.resourceAccessQueue, ^{ retryTimer = self->_retryTimer; });
-    
-    return retryTimer;
+    return self.snapshot.retryTimer;
 }
 
 - (void)setRetryTimer:(dispatch_source_t)retryTimer {
     
-    pn_safe_property_write(self.resourceAccessQueue, ^{ self->_retryTimer = retryTimer; });
+    [self updateSnapshotWithBlock:^(PNMutableSubscriberSnapshot *snapshot) { snapshot.retryTimer = retryTimer; }];
 }
 
 
 #pragma mark - State Information and Manipulation
 
++ (NSUInteger)maximumPendingEventBatches {
+    
+    return kPubNubMaximumPendingEventBatches;
+}
+
 - (NSArray<NSString *> *)allObjects {
     
-    return [[[self channels] arrayByAddingObjectsFromArray:[self presenceChannels]]
-            arrayByAddingObjectsFromArray:[self channelGroups]];
+    PNSubscriberSnapshot *snapshot = self.snapshot;
+    
+    return [[snapshot.channels.allObjects arrayByAddingObjectsFromArray:snapshot.presenceChannels.allObjects]
+            arrayByAddingObjectsFromArray:snapshot.channelGroups.allObjects];
 }
 
 - (NSArray<NSString *> *)channels {
     
-    __block NSArray *channels = nil;
-    pn_safe_property_read(self.resourceAccessQueue, ^{ channels = self.channelsSet.allObjects; });
-    
-    return channels;
+    return self.snapshot.channels.allObjects;
 }
 
 - (void)addChannels:(NSArray<NSString *> *)channels {
     
-    pn_safe_property_write(self.resourceAccessQueue, ^{
+    [self updateSnapshotWithBlock:^(PNMutableSubscriberSnapshot *snapshot) {
         
         NSArray *channelsOnly = [PNChannel objectsWithOutPresenceFrom:channels];
         if ([channelsOnly count] != [channels count]) {
@@ -544,139 +829,163 @@ NS_ASSUME_NONNULL_END
             // Add presence channels to corresponding storage.
             NSMutableSet *channelsSet = [NSMutableSet setWithArray:channels];
             [channelsSet minusSet:[NSSet setWithArray:channelsOnly]];
-            [self.presenceChannelsSet unionSet:channelsSet];
+            snapshot.presenceChannels = [snapshot.presenceChannels setByAddingObjectsFromSet:channelsSet];
         }
-        [self.channelsSet addObjectsFromArray:channelsOnly];
-    });
+        snapshot.channels = [snapshot.channels setByAddingObjectsFromArray:channelsOnly];
+    }];
+    [self invalidateObjectsList];
 }
 
 - (void)removeChannels:(NSArray<NSString *> *)channels {
     
-    pn_safe_property_write(self.resourceAccessQueue, ^{
+    [self updateSnapshotWithBlock:^(PNMutableSubscriberSnapshot *snapshot) {
         
         NSSet *channelsSet = [NSSet setWithArray:channels];
-        [self.presenceChannelsSet minusSet:channelsSet];
-        [self.channelsSet minusSet:channelsSet];
-    });
+        NSMutableSet *presenceChannels = [snapshot.presenceChannels mutableCopy];
+        NSMutableSet *channelsOnly = [snapshot.channels mutableCopy];
+        [presenceChannels minusSet:channelsSet];
+        [channelsOnly minusSet:channelsSet];
+        snapshot.presenceChannels = presenceChannels;
+        snapshot.channels = channelsOnly;
+    }];
+    [self invalidateObjectsList];
 }
 
 - (NSArray<NSString *> *)channelGroups {
     
-    __block NSArray *channelGroups = nil;
-    pn_safe_property_read(self.resourceAccessQueue, ^{ channelGroups = self.channelGroupsSet.allObjects; });
-    
-    return channelGroups;
+    return self.snapshot.channelGroups.allObjects;
 }
 
 - (void)addChannelGroups:(NSArray<NSString *> *)groups {
     
-    pn_safe_property_write(self.resourceAccessQueue, ^{ 
+    [self updateSnapshotWithBlock:^(PNMutableSubscriberSnapshot *snapshot) {
         
-        [self.channelGroupsSet addObjectsFromArray:groups];
-    });
+        snapshot.channelGroups = [snapshot.channelGroups setByAddingObjectsFromArray:groups];
+    }];
+    [self invalidateObjectsList];
 }
 
 - (void)removeChannelGroups:(NSArray<NSString *> *)groups {
     
-    pn_safe_property_write(self.resourceAccessQueue, ^{
+    [self updateSnapshotWithBlock:^(PNMutableSubscriberSnapshot *snapshot) {
         
-        [self.channelGroupsSet minusSet:[NSSet setWithArray:groups]];
-    });
+        NSMutableSet *channelGroups = [snapshot.channelGroups mutableCopy];
+        [channelGroups minusSet:[NSSet setWithArray:groups]];
+        snapshot.channelGroups = channelGroups;
+    }];
+    [self invalidateObjectsList];
 }
 
 - (NSArray<NSString *> *)presenceChannels {
     
-    __block NSArray *presenceChannels = nil;
-    pn_safe_property_read(self.resourceAccessQueue, ^{
-        
-        presenceChannels = self.presenceChannelsSet.allObjects;
-    });
-    
-    return presenceChannels;
+    return self.snapshot.presenceChannels.allObjects;
 }
 
 - (void)addPresenceChannels:(NSArray<NSString *> *)presenceChannels {
     
-    pn_safe_property_write(self.resourceAccessQueue, ^{
+    [self updateSnapshotWithBlock:^(PNMutableSubscriberSnapshot *snapshot) {
         
-        [self.presenceChannelsSet addObjectsFromArray:presenceChannels];
-    });
+        snapshot.presenceChannels = [snapshot.presenceChannels setByAddingObjectsFromArray:presenceChannels];
+    }];
+    [self invalidateObjectsList];
 }
 
 - (void)removePresenceChannels:(NSArray<NSString *> *)presenceChannels {
     
+    [self updateSnapshotWithBlock:^(PNMutableSubscriberSnapshot *snapshot) {
+        
+        NSMutableSet *channels = [snapshot.presenceChannels mutableCopy];
+        [channels minusSet:[NSSet setWithArray:presenceChannels]];
+        snapshot.presenceChannels = channels;
+    }];
+    [self invalidateObjectsList];
+}
+
+- (void)invalidateObjectsList {
+    
     pn_safe_property_write(self.resourceAccessQueue, ^{
         
-        [self.presenceChannelsSet minusSet:[NSSet setWithArray:presenceChannels]];
+        self->_shouldUpdateShards = YES;
+        self->_objectsListVersion++;
     });
 }
 
 - (NSNumber *)currentTimeToken {
     
-    __block NSNumber *currentTimeToken = nil;
-    pn_safe_property_read(self.resourceAccessQueue, ^{ currentTimeToken = self->_currentTimeToken; });
-    
-    return currentTimeToken;
+    return self.snapshot.currentTimeToken;
 }
 
 - (void)setCurrentTimeToken:(NSNumber *)currentTimeToken {
     
-    pn_safe_property_write(self.resourceAccessQueue, ^{ self->_currentTimeToken = currentTimeToken; });
+    [self updateSnapshotWithBlock:^(PNMutableSubscriberSnapshot *snapshot) {
+        
+        snapshot.currentTimeToken = currentTimeToken;
+    }];
 }
 
 - (NSNumber *)lastTimeToken {
     
-    __block NSNumber *lastTimeToken = nil;
-    pn_safe_property_read(self.resourceAccessQueue, ^{ lastTimeToken = self->_lastTimeToken; });
-    
-    return lastTimeToken;
+    return self.snapshot.lastTimeToken;
 }
 
 - (void)setLastTimeToken:(NSNumber *)lastTimeToken {
     
-    pn_safe_property_write(self.resourceAccessQueue, ^{ self->_lastTimeToken = lastTimeToken; });
+    [self updateSnapshotWithBlock:^(PNMutableSubscriberSnapshot *snapshot) {
+        
+        snapshot.lastTimeToken = lastTimeToken;
+    }];
 }
 
 - (NSNumber *)overrideTimeToken {
     
-    __block NSNumber *overrideTimeToken = nil;
-    pn_safe_property_read(self.resourceAccessQueue, ^{ overrideTimeToken = self->_overrideTimeToken; });
-    
-    return overrideTimeToken;
+    return self.snapshot.overrideTimeToken;
 }
 
 - (void)setOverrideTimeToken:(NSNumber *)overrideTimeToken {
     
-    pn_safe_property_write(self.resourceAccessQueue, ^{
+    [self updateSnapshotWithBlock:^(PNMutableSubscriberSnapshot *snapshot) {
         
-        self->_overrideTimeToken = [PNNumber timeTokenFromNumber:overrideTimeToken];
-    });
+        snapshot.overrideTimeToken = [PNNumber timeTokenFromNumber:overrideTimeToken];
+    }];
 }
 
 - (NSNumber *)currentTimeTokenRegion {
     
-    __block NSNumber *currentTimeTokenRegion = nil;
-    pn_safe_property_read(self.resourceAccessQueue, ^{ currentTimeTokenRegion = self->_currentTimeTokenRegion; });
-    
-    return currentTimeTokenRegion;
+    return self.snapshot.currentTimeTokenRegion;
 }
 
 - (void)setCurrentTimeTokenRegion:(NSNumber *)currentTimeTokenRegion {
     
-    pn_safe_property_write(self.resourceAccessQueue, ^{ self->_currentTimeTokenRegion = currentTimeTokenRegion; });
+    [self updateSnapshotWithBlock:^(PNMutableSubscriberSnapshot *snapshot) {
+        
+        snapshot.currentTimeTokenRegion = currentTimeTokenRegion;
+    }];
 }
 
 - (NSNumber *)lastTimeTokenRegion {
     
-    __block NSNumber *lastTimeTokenRegion = nil;
-    pn_safe_property_read(self.resourceAccessQueue, ^{ lastTimeTokenRegion = self->_lastTimeTokenRegion; });
-    
-    return lastTimeTokenRegion;
+    return self.snapshot.lastTimeTokenRegion;
 }
 
 - (void)setLastTimeTokenRegion:(NSNumber *)lastTimeTokenRegion {
     
-    pn_safe_property_write(self.resourceAccessQueue, ^{ self->_lastTimeTokenRegion = lastTimeTokenRegion; });
+    [self updateSnapshotWithBlock:^(PNMutableSubscriberSnapshot *snapshot) {
+        
+        snapshot.lastTimeTokenRegion = lastTimeTokenRegion;
+    }];
+}
+
+
+#pragma mark - Subscription information modification
+
+- (void)updateSnapshotWithBlock:(void(^)(PNMutableSubscriberSnapshot *snapshot))block {
+    
+    pn_lock(&_snapshotLock, ^{
+        
+        PNMutableSubscriberSnapshot *snapshot = [self.snapshot mutableCopy];
+        block(snapshot);
+        self.snapshot = [snapshot copy];
+    });
 }
 
 - (void)updateStateTo:(PNSubscriberState)state withStatus:(PNSubscribeStatus *)status
@@ -786,10 +1095,18 @@ NS_ASSUME_NONNULL_END
             // more need in it and probably whole client instance has been deallocated.
             #pragma clang diagnostic push
             #pragma clang diagnostic ignored "-Warc-repeated-use-of-weak"
-            [self.client.listenersManager notifyWithBlock:^{
+            // Subscription state reported to listeners only by subscriber which manage shards.
+            if (!self.isShard) {
                 
-                [self.client.listenersManager notifyStatusChange:(PNSubscribeStatus *)targetStatus];
-            }];
+                [self.client.listenersManager notifyWithBlock:^{
+                    
+                    [self.client.listenersManager notifyStatusChange:(PNSubscribeStatus *)targetStatus];
+                }];
+            }
+            else if (category != PNConnectedCategory && category != PNReconnectedCategory) {
+                
+                [self.primarySubscriber handleShardStatus:(PNSubscribeStatus *)targetStatus];
+            }
             #pragma clang diagnostic pop
         } else { category = (status ? status.category : PNUnknownCategory); }
         if (block) { pn_dispatch_async(self.client.callbackQueue, ^{ block(category); }); }
@@ -811,36 +1128,54 @@ NS_ASSUME_NONNULL_END
         
         _client = client;
         [_client.logger enableLogLevel:PNAPICallLogLevel];
-        _channelsSet = [NSMutableSet new];
-        _channelGroupsSet = [NSMutableSet new];
-        _presenceChannelsSet = [NSMutableSet new];
-        _cachedObjectIdentifiers = [NSMutableArray new];
-        _cachedObjects = [NSMutableDictionary new];
-        _currentTimeToken = @0;
-        _lastTimeToken = @0;
+        _snapshot = [PNSubscriberSnapshot snapshot];
+        _snapshotLock = OS_UNFAIR_LOCK_INIT;
+        _messagesCache = [PNMessagesCache cacheWithCapacity:client.configuration.maximumMessagesCacheSize];
+        _retryPolicy = [PNRetryPolicy policyWithConfiguration:client.configuration];
         _resourceAccessQueue = dispatch_queue_create("com.pubnub.subscriber",
                                                      DISPATCH_QUEUE_CONCURRENT);
+        _eventsProcessingQueue = dispatch_queue_create("com.pubnub.subscriber.events",
+                                                       DISPATCH_QUEUE_SERIAL);
+        _eventsPipelineLock = OS_UNFAIR_LOCK_INIT;
+        _shards = [NSMutableArray new];
+        _shouldUpdateShards = YES;
     }
     
     return self;
 }
 
++ (instancetype)shardForSubscriber:(PNSubscriber *)subscriber {
+    
+    PNSubscriber *shard = [self subscriberForClient:subscriber.client];
+    shard.shard = YES;
+    shard.primarySubscriber = subscriber;
+    shard.messagesCache = subscriber.messagesCache;
+    shard.eventsProcessingQueue = subscriber.eventsProcessingQueue;
+    shard.filterExpression = subscriber.filterExpression;
+    
+    return shard;
+}
+
 - (void)inheritStateFromSubscriber:(PNSubscriber *)subscriber {
     
-    _channelsSet = [subscriber.channelsSet mutableCopy];
-    _channelGroupsSet = [subscriber.channelGroupsSet mutableCopy];
-    _presenceChannelsSet = [subscriber.presenceChannelsSet mutableCopy];
-    if (_channelsSet.count || _channelGroupsSet.count || _presenceChannelsSet.count) {
+    PNSubscriberSnapshot *subscriberSnapshot = subscriber.snapshot;
+    [self updateSnapshotWithBlock:^(PNMutableSubscriberSnapshot *snapshot) {
+        
+        snapshot.channels = subscriberSnapshot.channels;
+        snapshot.channelGroups = subscriberSnapshot.channelGroups;
+        snapshot.presenceChannels = subscriberSnapshot.presenceChannels;
+        snapshot.currentTimeToken = subscriberSnapshot.currentTimeToken;
+        snapshot.lastTimeToken = subscriberSnapshot.lastTimeToken;
+        snapshot.currentTimeTokenRegion = subscriberSnapshot.currentTimeTokenRegion;
+        snapshot.lastTimeTokenRegion = subscriberSnapshot.lastTimeTokenRegion;
+        snapshot.escapedFilterExpression = subscriberSnapshot.escapedFilterExpression;
+    }];
+    if (subscriberSnapshot.channels.count || subscriberSnapshot.channelGroups.count ||
+        subscriberSnapshot.presenceChannels.count) {
         
         _currentState = PNDisconnectedSubscriberState;
     }
-    _cachedObjects = [subscriber.cachedObjects mutableCopy];
-    _cachedObjectIdentifiers = [subscriber.cachedObjectIdentifiers mutableCopy];
-    _currentTimeToken = subscriber.currentTimeToken;
-    _lastTimeToken = subscriber.lastTimeToken;
-    _currentTimeTokenRegion = subscriber.currentTimeTokenRegion;
-    _lastTimeTokenRegion = subscriber.lastTimeTokenRegion;
-    _escapedFilterExpression = subscriber.escapedFilterExpression;
+    [_messagesCache inheritMessagesFromCache:subscriber.messagesCache];
 }
 
 
@@ -848,27 +1183,22 @@ NS_ASSUME_NONNULL_END
 
 - (NSString *)filterExpression {
     
-    __block NSString *expression = nil;
-    pn_safe_property_read(self.resourceAccessQueue, ^{ expression = self->_filterExpression; });
-
-    return expression;
+    return self.snapshot.filterExpression;
 }
 
 - (void)setFilterExpression:(NSString *)filterExpression {
     
-    pn_safe_property_write(self.resourceAccessQueue, ^{
+    [self updateSnapshotWithBlock:^(PNMutableSubscriberSnapshot *snapshot) {
         
-        self->_filterExpression = [filterExpression copy];
-        self->_escapedFilterExpression = (filterExpression? [PNString percentEscapedString:filterExpression] : nil);
-    });
+        snapshot.filterExpression = filterExpression;
+        snapshot.escapedFilterExpression = (filterExpression? [PNString percentEscapedString:filterExpression] : nil);
+    }];
+    [self invalidateObjectsList];
 }
 
 - (NSString *)escapedFilterExpression {
     
-    __block NSString *expression = nil;
-    pn_safe_property_read(self.resourceAccessQueue, ^{ expression = self->_escapedFilterExpression; });
-    
-    return expression;
+    return self.snapshot.escapedFilterExpression;
 }
 
 
@@ -891,7 +1221,12 @@ NS_ASSUME_NONNULL_END
     // it and probably whole client instance has been deallocated.
     #pragma clang diagnostic push
     #pragma clang diagnostic ignored "-Warc-repeated-use-of-weak"
-    if ([self allObjects].count) {
+    NSUInteger objectsCount = [self allObjects].count;
+    
+    // Shard which lost it's subscription objects doesn't need to report anything.
+    if (self.isShard && objectsCount == 0) { return; }
+    
+    if (objectsCount) {
 
         // Storing time token override
         self.overrideTimeToken = timeToken;
@@ -901,25 +1236,28 @@ NS_ASSUME_NONNULL_END
         if (initialSubscribe) {
             
             self.mayRequireSubscriptionRestore = NO;
-            pn_safe_property_write(self.resourceAccessQueue, ^{
+            pn_lock(&_eventsPipelineLock, ^{ self->_subscriptionCycleDeferred = NO; });
+            [self updateSnapshotWithBlock:^(PNMutableSubscriberSnapshot *snapshot) {
                 
-                if (self->_currentTimeToken && [self->_currentTimeToken compare:@0] != NSOrderedSame) {
+                if (snapshot.currentTimeToken && [snapshot.currentTimeToken compare:@0] != NSOrderedSame) {
                     
-                    self->_lastTimeToken = self->_currentTimeToken;
+                    snapshot.lastTimeToken = snapshot.currentTimeToken;
                 }
-                if (self->_currentTimeTokenRegion && [self->_currentTimeTokenRegion compare:@0] != NSOrderedSame &&
-                    [self->_currentTimeTokenRegion compare:@(-1)] == NSOrderedDescending) {
+                if (snapshot.currentTimeTokenRegion && [snapshot.currentTimeTokenRegion compare:@0] != NSOrderedSame &&
+                    [snapshot.currentTimeTokenRegion compare:@(-1)] == NSOrderedDescending) {
                     
-                    self->_lastTimeTokenRegion = self->_currentTimeTokenRegion;
+                    snapshot.lastTimeTokenRegion = snapshot.currentTimeTokenRegion;
                 }
-                self->_currentTimeToken = @0;
-                self->_currentTimeTokenRegion = @(-1);
-            });
+                snapshot.currentTimeToken = @0;
+                snapshot.currentTimeTokenRegion = @(-1);
+            }];
         }
         
+        NSArray<PNSubscriber *> *shards = nil;
+        if (!self.isShard) { shards = [self updateShardsIfRequired:initialSubscribe withState:state]; }
         PNRequestParameters *parameters = [self subscribeRequestParametersWithState:state];
         
-        if (initialSubscribe) {
+        if (initialSubscribe && !self.isShard) {
             
             PNLogAPICall(self.client.logger, @"<PubNub::API> Subscribe (channels: %@; groups: %@)%@",
                          parameters.pathComponents[@"{channels}"], parameters.query[@"channel-group"],
@@ -937,19 +1275,26 @@ NS_ASSUME_NONNULL_END
                   pn_dispatch_async(weakSelf.client.callbackQueue, ^{ block((PNSubscribeStatus *)status); });
               }
           }];
+        
+        for (PNSubscriber *shard in shards) {
+            
+            [shard subscribe:YES usingTimeToken:timeToken withState:state completion:nil];
+        }
     }
     else {
         
+        [self removeShards];
+
         PNStatus *status = [PNStatus statusForOperation:PNSubscribeOperation category:PNDisconnectedCategory
                                     withProcessingError:nil];
         [self.client appendClientInformation:status];
-        pn_safe_property_write(self.resourceAccessQueue, ^{
+        [self updateSnapshotWithBlock:^(PNMutableSubscriberSnapshot *snapshot) {
             
-            self->_lastTimeToken = @0;
-            self->_currentTimeToken = @0;
-            self->_lastTimeTokenRegion = @(-1);
-            self->_currentTimeTokenRegion = @(-1);
-        });
+            snapshot.lastTimeToken = @0;
+            snapshot.currentTimeToken = @0;
+            snapshot.lastTimeTokenRegion = @(-1);
+            snapshot.currentTimeTokenRegion = @(-1);
+        }];
         if (block) {
             
             pn_dispatch_async(self.client.callbackQueue, ^{ block((PNSubscribeStatus *)status); });
@@ -968,13 +1313,13 @@ NS_ASSUME_NONNULL_END
 - (void)restoreSubscriptionCycleIfRequiredWithCompletion:(PNSubscriberCompletionBlock)block {
     
     __block BOOL shouldRestore;
-    __block BOOL ableToRestore;
+    PNSubscriberSnapshot *snapshot = self.snapshot;
+    BOOL ableToRestore = (snapshot.channels.count || snapshot.channelGroups.count ||
+                          snapshot.presenceChannels.count);
     pn_safe_property_read(self.resourceAccessQueue, ^{
         
         shouldRestore = (self.currentState == PNDisconnectedUnexpectedlySubscriberState &&
                          self.mayRequireSubscriptionRestore);
-        ableToRestore = ([self.channelsSet count] || [self.channelGroupsSet count] ||
-                         [self.presenceChannelsSet count]);
     });
     if (shouldRestore && ableToRestore) {
         
@@ -1049,13 +1394,13 @@ NS_ASSUME_NONNULL_END
     NSSet *subscriptionObjects = [NSSet setWithArray:[self allObjects]];
     if (subscriptionObjects.count == 0) {
         
-        pn_safe_property_write(self.resourceAccessQueue, ^{
+        [self updateSnapshotWithBlock:^(PNMutableSubscriberSnapshot *snapshot) {
             
-            self->_lastTimeToken = @0;
-            self->_currentTimeToken = @0;
-            self->_lastTimeTokenRegion = @(-1);
-            self->_currentTimeTokenRegion = @(-1);
-        });
+            snapshot.lastTimeToken = @0;
+            snapshot.currentTimeToken = @0;
+            snapshot.lastTimeTokenRegion = @(-1);
+            snapshot.currentTimeTokenRegion = @(-1);
+        }];
     }
     
     if (channelsWithOutPresence.count || groupsWithOutPresence.count) {
@@ -1132,14 +1477,25 @@ NS_ASSUME_NONNULL_END
     
     [self stopRetryTimer];
     
+    NSTimeInterval delay = [self.retryPolicy nextDelay];
+    if (delay < 0.f) {
+        
+        PNLogAPICall(self.client.logger, @"<PubNub::API> Subscription retry budget exhausted (%@ attempts)",
+                     @(self.retryPolicy.attempts));
+        
+        // Shard doesn't managed by reachability, so it continue retry in same way as reachability check.
+        if (!self.isShard) { return; }
+        delay = self.retryPolicy.maximumDelay;
+    }
+    
     __weak __typeof(self) weakSelf = self;
     dispatch_queue_t timerQueue = dispatch_get_global_queue(DISPATCH_QUEUE_PRIORITY_DEFAULT, 0);
     dispatch_source_t timer = dispatch_source_create(DISPATCH_SOURCE_TYPE_TIMER, 0, 0, timerQueue);
     dispatch_source_set_event_handler(timer, ^{
         [weakSelf continueSubscriptionCycleIfRequiredWithCompletion:nil];
     });
-    dispatch_time_t start = dispatch_time(DISPATCH_TIME_NOW, (int64_t)(kPubNubSubscriptionRetryInterval * NSEC_PER_SEC));
-    dispatch_source_set_timer(timer, start, (uint64_t)(kPubNubSubscriptionRetryInterval * NSEC_PER_SEC), NSEC_PER_SEC);
+    dispatch_time_t start = dispatch_time(DISPATCH_TIME_NOW, (int64_t)(delay * NSEC_PER_SEC));
+    dispatch_source_set_timer(timer, start, (uint64_t)(delay * NSEC_PER_SEC), NSEC_PER_SEC);
     self.retryTimer = timer;
     dispatch_resume(timer);
 }
@@ -1152,6 +1508,261 @@ NS_ASSUME_NONNULL_END
 }
 
 
+#pragma mark - Sharding
+
+- (NSArray<PNSubscriber *> *)updateShardsIfRequired:(BOOL)initialSubscribe
+                                          withState:(NSDictionary<NSString *, id> *)state {
+    
+    __block BOOL shouldUpdateShards = NO;
+    pn_safe_property_read(self.resourceAccessQueue, ^{ shouldUpdateShards = self->_shouldUpdateShards; });
+    if (!initialSubscribe && !shouldUpdateShards) { return nil; }
+    
+    NSArray *channels = [[self channels] arrayByAddingObjectsFromArray:[self presenceChannels]];
+    NSArray *groups = [self channelGroups];
+    NSArray *objects = [channels arrayByAddingObjectsFromArray:groups];
+    NSDictionary *mergedState = [self.client.clientStateManager stateMergedWith:state forObjects:objects];
+    __block NSArray<PNSubscriber *> *existingShards = nil;
+    __block NSArray<NSString *> *primaryChannels = nil;
+    __block NSArray<NSString *> *primaryGroups = nil;
+    pn_safe_property_read(self.resourceAccessQueue, ^{
+        
+        existingShards = [self->_shards copy];
+        primaryChannels = self->_shardChannels;
+        primaryGroups = self->_shardChannelGroups;
+    });
+    
+    // Receiver's objects list stored only when it has been split between shards.
+    NSMutableArray<NSDictionary *> *previousShards = nil;
+    if (primaryChannels || primaryGroups) {
+        
+        previousShards = [NSMutableArray arrayWithObject:@{ @"channels": (primaryChannels ?: @[]),
+                                                            @"groups": (primaryGroups ?: @[]) }];
+        for (PNSubscriber *shard in existingShards) {
+            
+            [previousShards addObject:@{ @"channels": [shard channels], @"groups": [shard channelGroups] }];
+        }
+    }
+    NSArray<NSDictionary *> *objectsShards = [self shardsForChannels:channels groups:groups
+                                                      previousShards:previousShards withState:mergedState];
+    NSMutableArray<PNSubscriber *> *subscribers = [NSMutableArray arrayWithObject:self];
+    [subscribers addObjectsFromArray:existingShards];
+    NSMutableArray<NSDictionary *> *usedObjectsShards = [NSMutableArray new];
+    NSMutableArray<PNSubscriber *> *unusedShards = [NSMutableArray new];
+    NSMutableArray<PNSubscriber *> *shards = [NSMutableArray new];
+    PNSubscriber *replacedShard = nil;
+    
+    // Re-use already created shards to keep their subscription loop information. Shards which lost all
+    // objects removed and if receiver lost own objects, it take over objects of first shard along with it's
+    // time token.
+    for (NSUInteger shardIdx = 0; shardIdx < MAX(objectsShards.count, subscribers.count); shardIdx++) {
+        
+        PNSubscriber *shard = (shardIdx < subscribers.count ? subscribers[shardIdx] : nil);
+        NSDictionary *objectsShard = (shardIdx < objectsShards.count ? objectsShards[shardIdx] : nil);
+        if ([objectsShard[@"channels"] count] + [objectsShard[@"groups"] count] == 0) {
+            
+            if (shard && shard != self) { [unusedShards addObject:shard]; }
+            continue;
+        }
+        
+        if (!usedObjectsShards.count) {
+            
+            if (shard != self && shard) {
+                
+                replacedShard = shard;
+                [unusedShards addObject:shard];
+            }
+        }
+        else {
+            
+            if (!shard) {
+                
+                shard = [PNSubscriber shardForSubscriber:self];
+                [shard inheritTimeTokenFromSubscriber:self forInitialSubscribe:initialSubscribe];
+            }
+            [shard setShardChannels:objectsShard[@"channels"] groups:objectsShard[@"groups"]];
+            [shards addObject:shard];
+        }
+        [usedObjectsShards addObject:objectsShard];
+    }
+    
+    if (replacedShard) { [self inheritTimeTokenFromSubscriber:replacedShard forInitialSubscribe:initialSubscribe]; }
+    
+    pn_safe_property_write(self.resourceAccessQueue, ^{
+        
+        BOOL isSharded = usedObjectsShards.count > 1;
+        self->_shardChannels = (isSharded ? usedObjectsShards.firstObject[@"channels"] : nil);
+        self->_shardChannelGroups = (isSharded ? usedObjectsShards.firstObject[@"groups"] : nil);
+        self->_shouldUpdateShards = NO;
+        self->_objectsListVersion++;
+        self->_shards = shards;
+    });
+    
+    for (PNSubscriber *shard in unusedShards) {
+        
+        [shard setShardChannels:@[] groups:@[]];
+        [shard stopRetryTimer];
+    }
+    
+    if (shards.count) {
+        
+        PNLogAPICall(self.client.logger, @"<PubNub::API> Subscription objects split between %@ subscribe "
+                     "requests.", @(shards.count + 1));
+    }
+    
+    return shards;
+}
+
+- (NSArray<NSDictionary<NSString *, NSArray<NSString *> *> *> *)shardsForChannels:(NSArray<NSString *> *)channels
+                                                                           groups:(NSArray<NSString *> *)groups
+                                                                   previousShards:(NSArray<NSDictionary *> *)previousShards
+                                                                        withState:(NSDictionary *)state {
+    
+    NSUInteger maximumLength = self.client.configuration.maximumSubscribeRequestURLLength;
+    if (maximumLength == 0) { return @[@{ @"channels": channels, @"groups": groups }]; }
+    
+    NSUInteger reservedLength = kPubNubSubscribeRequestReservedURLLength + self.escapedFilterExpression.length;
+    if (state.count) {
+        
+        NSString *stateString = [PNJSON JSONStringFrom:state withError:nil];
+        reservedLength += [PNString percentEscapedString:stateString].length;
+    }
+    NSUInteger availableLength = (maximumLength > reservedLength ? maximumLength - reservedLength : 0);
+    NSMutableSet<NSString *> *newChannels = [NSMutableSet setWithArray:channels];
+    NSMutableSet<NSString *> *newGroups = [NSMutableSet setWithArray:groups];
+    NSMutableArray<NSDictionary *> *shards = [NSMutableArray new];
+    __block NSMutableArray<NSString *> *shardChannels = nil;
+    __block NSMutableArray<NSString *> *shardGroups = nil;
+    __block NSUInteger shardLength = 0;
+    
+    void(^addShard)(void) = ^{
+        
+        shardChannels = [NSMutableArray new];
+        shardGroups = [NSMutableArray new];
+        shardLength = 0;
+        [shards addObject:@{ @"channels": shardChannels, @"groups": shardGroups }];
+    };
+    void(^addObjectToShard)(NSString *, BOOL) = ^(NSString *object, BOOL isGroup) {
+        
+        // Each encoded name in list separated by comma.
+        [(isGroup ? shardGroups : shardChannels) addObject:object];
+        shardLength += [PNString percentEscapedString:object].length + 1;
+    };
+    
+    for (NSDictionary *previousShard in previousShards) {
+        
+        addShard();
+        for (NSString *channel in previousShard[@"channels"]) {
+            
+            if ([newChannels containsObject:channel]) {
+                
+                [newChannels removeObject:channel];
+                addObjectToShard(channel, NO);
+            }
+        }
+        for (NSString *group in previousShard[@"groups"]) {
+            
+            if ([newGroups containsObject:group]) {
+                
+                [newGroups removeObject:group];
+                addObjectToShard(group, YES);
+            }
+        }
+    }
+    if (!shards.count) { addShard(); }
+    
+    void(^appendObject)(NSString *, BOOL) = ^(NSString *object, BOOL isGroup) {
+        
+        NSUInteger length = [PNString percentEscapedString:object].length + 1;
+        if (shardLength > 0 && shardLength + length > availableLength &&
+            shards.count < kPNMaximumSubscribeShardsCount) {
+            
+            addShard();
+        }
+        addObjectToShard(object, isGroup);
+    };
+    
+    for (NSString *channel in [channels sortedArrayUsingSelector:@selector(compare:)]) {
+        
+        if ([newChannels containsObject:channel]) { appendObject(channel, NO); }
+    }
+    for (NSString *group in [groups sortedArrayUsingSelector:@selector(compare:)]) {
+        
+        if ([newGroups containsObject:group]) { appendObject(group, YES); }
+    }
+    
+    return shards;
+}
+
+- (void)inheritTimeTokenFromSubscriber:(PNSubscriber *)subscriber forInitialSubscribe:(BOOL)initialSubscribe {
+    
+    PNSubscriberSnapshot *subscriberSnapshot = subscriber.snapshot;
+    [self updateSnapshotWithBlock:^(PNMutableSubscriberSnapshot *snapshot) {
+        
+        snapshot.currentTimeToken = subscriberSnapshot.currentTimeToken;
+        snapshot.lastTimeToken = subscriberSnapshot.lastTimeToken;
+        snapshot.currentTimeTokenRegion = subscriberSnapshot.currentTimeTokenRegion;
+        snapshot.lastTimeTokenRegion = subscriberSnapshot.lastTimeTokenRegion;
+        
+        // Subscriber which is about to subscribe with 0 time token should catch up from inherited one.
+        if (initialSubscribe && snapshot.currentTimeToken &&
+            [snapshot.currentTimeToken compare:@0] != NSOrderedSame) {
+            
+            snapshot.lastTimeToken = snapshot.currentTimeToken;
+            snapshot.lastTimeTokenRegion = snapshot.currentTimeTokenRegion;
+            snapshot.currentTimeToken = @0;
+            snapshot.currentTimeTokenRegion = @(-1);
+        }
+    }];
+}
+
+- (void)setShardChannels:(NSArray<NSString *> *)channels groups:(NSArray<NSString *> *)groups {
+    
+    [self updateSnapshotWithBlock:^(PNMutableSubscriberSnapshot *snapshot) {
+        
+        snapshot.channels = [NSSet setWithArray:channels];
+        snapshot.presenceChannels = [NSSet set];
+        snapshot.channelGroups = [NSSet setWithArray:groups];
+    }];
+    pn_safe_property_write(self.resourceAccessQueue, ^{ self->_objectsListVersion++; });
+}
+
+- (void)removeShards {
+    
+    __block NSArray<PNSubscriber *> *shards = nil;
+    pn_safe_property_write(self.resourceAccessQueue, ^{
+        
+        shards = self->_shards;
+        self->_shards = [NSMutableArray new];
+        self->_shardChannels = nil;
+        self->_shardChannelGroups = nil;
+        self->_shouldUpdateShards = YES;
+        self->_objectsListVersion++;
+    });
+    
+    for (PNSubscriber *shard in shards) {
+        
+        [shard setShardChannels:@[] groups:@[]];
+        [shard stopRetryTimer];
+    }
+}
+
+
+- (void)handleShardStatus:(PNSubscribeStatus *)status {
+    
+    // Silence static analyzer warnings.
+    // Code is aware about this case and at the end will simply call on 'nil' object method.
+    // In most cases if referenced object become 'nil' it mean what there is no more need in
+    // it and probably whole client instance has been deallocated.
+    #pragma clang diagnostic push
+    #pragma clang diagnostic ignored "-Warc-repeated-use-of-weak"
+    [self.client.listenersManager notifyWithBlock:^{
+        
+        [self.client.listenersManager notifyStatusChange:status];
+    }];
+    #pragma clang diagnostic pop
+}
+
+
 #pragma mark - Handlers
 
 - (void)handleSubscriptionStatus:(PNSubscribeStatus *)status {
@@ -1166,6 +1777,8 @@ NS_ASSUME_NONNULL_END
 
 - (void)handleSuccessSubscriptionStatus:(PNSubscribeStatus *)status {
     
+    [self.retryPolicy reset];
+    
     // Try fetch time token from passed result/status objects.
     BOOL isInitialSubscription = ([status.clientRequest.URL.query rangeOfString:@"tt=0"].location != NSNotFound);
     NSNumber *overrideTimeToken = self.overrideTimeToken;
@@ -1215,7 +1828,7 @@ NS_ASSUME_NONNULL_END
     if (status.category == PNCancelledCategory) {
         
         // Stop heartbeat for now and wait further actions.
-        [self.client.heartbeatManager stopHeartbeatIfPossible];
+        if (!self.isShard) { [self.client.heartbeatManager stopHeartbeatIfPossible]; }
     }
     // Looks like processing failed because of another error.
     // If there is another subscription/unsubscription operations is waiting client shouldn't
@@ -1231,7 +1844,8 @@ NS_ASSUME_NONNULL_END
             
             __weak __typeof(self) weakSelf = self;
             ((PNStatus *)status).automaticallyRetry = (status.category != PNMalformedFilterExpressionCategory &&
-                                                       status.category != PNRequestURITooLongCategory);
+                                                       status.category != PNRequestURITooLongCategory &&
+                                                       [self.retryPolicy canRetry]);
             ((PNStatus *)status).retryCancelBlock = ^{
                 
                 PNLogAPICall(weakSelf.client.logger, @"<PubNub::API> Cancel retry");
@@ -1266,35 +1880,38 @@ NS_ASSUME_NONNULL_END
             /* Do nothing, because we can't stop auto-retry in case of network issues.
              It handled by client configuration. */ };
             
-            pn_safe_property_write(self.resourceAccessQueue, ^{
+            BOOL shouldTryCatchUp = self.client.configuration.shouldTryCatchUpOnSubscriptionRestore;
+            [self updateSnapshotWithBlock:^(PNMutableSubscriberSnapshot *snapshot) {
                 
-                if (self.client.configuration.shouldTryCatchUpOnSubscriptionRestore) {
+                if (shouldTryCatchUp) {
                     
-                    if (self->_currentTimeToken &&
-                        [self->_currentTimeToken compare:@0] != NSOrderedSame) {
+                    if (snapshot.currentTimeToken &&
+                        [snapshot.currentTimeToken compare:@0] != NSOrderedSame) {
                         
-                        self->_lastTimeToken = self->_currentTimeToken;
-                        self->_currentTimeToken = @0;
+                        snapshot.lastTimeToken = snapshot.currentTimeToken;
+                        snapshot.currentTimeToken = @0;
                     }   
-                    if (self->_currentTimeTokenRegion &&
-                        [self->_currentTimeTokenRegion compare:@0] != NSOrderedSame &&
-                        [self->_currentTimeTokenRegion compare:@(-1)] == NSOrderedDescending) {
+                    if (snapshot.currentTimeTokenRegion &&
+                        [snapshot.currentTimeTokenRegion compare:@0] != NSOrderedSame &&
+                        [snapshot.currentTimeTokenRegion compare:@(-1)] == NSOrderedDescending) {
                         
-                        self->_lastTimeTokenRegion = self->_currentTimeTokenRegion;
-                        self->_currentTimeTokenRegion = @(-1);
+                        snapshot.lastTimeTokenRegion = snapshot.currentTimeTokenRegion;
+                        snapshot.currentTimeTokenRegion = @(-1);
                     }
                 }
                 else {
                     
-                    self->_currentTimeToken = @0;
-                    self->_lastTimeToken = @0;
-                    self->_currentTimeTokenRegion = @(-1);
-                    self->_lastTimeTokenRegion = @(-1);
+                    snapshot.currentTimeToken = @0;
+                    snapshot.lastTimeToken = @0;
+                    snapshot.currentTimeTokenRegion = @(-1);
+                    snapshot.lastTimeTokenRegion = @(-1);
                 }
-            });
+            }];
             [(PNStatus *)status updateCategory:PNUnexpectedDisconnectCategory];
             
-            [self.client.heartbeatManager stopHeartbeatIfPossible];
+            // Shard doesn't managed by reachability and should restore it's subscribe loop by itself.
+            if (!self.isShard) { [self.client.heartbeatManager stopHeartbeatIfPossible]; }
+            else { [self startRetryTimer]; }
             [self updateStateTo:PNDisconnectedUnexpectedlySubscriberState withStatus:status completion:nil];
         }
     }
@@ -1305,15 +1922,15 @@ NS_ASSUME_NONNULL_END
 - (void)handleSubscription:(BOOL)initialSubscription timeToken:(NSNumber *)timeToken 
                     region:(NSNumber *)region {
 
-    pn_safe_property_write(self.resourceAccessQueue, ^{
+    [self updateSnapshotWithBlock:^(PNMutableSubscriberSnapshot *snapshot) {
         
         // Whether new time token from response should be applied for next subscription cycle or
         // not.
         BOOL shouldAcceptNewTimeToken = YES;
         
         // Whether time token should be overridden despite subscription behaviour configuration.
-        BOOL shouldOverrideTimeToken = (initialSubscription && self->_overrideTimeToken &&
-                                        [self->_overrideTimeToken compare:@0] != NSOrderedSame);
+        BOOL shouldOverrideTimeToken = (initialSubscription && snapshot.overrideTimeToken &&
+                                        [snapshot.overrideTimeToken compare:@0] != NSOrderedSame);
         
         // Silence static analyzer warnings.
         // Code is aware about this case and at the end will simply call on 'nil' object method.
@@ -1334,31 +1951,31 @@ NS_ASSUME_NONNULL_END
             
             // Ensure what we already don't use value from previous time token assigned during
             // previous sessions.
-            if (shouldUseLastTimeToken && self->_lastTimeToken &&
-                [self->_lastTimeToken compare:@0] != NSOrderedSame) {
+            if (shouldUseLastTimeToken && snapshot.lastTimeToken &&
+                [snapshot.lastTimeToken compare:@0] != NSOrderedSame) {
                 
                 BOOL keepOnListChange = self.client.configuration.shouldKeepTimeTokenOnListChange;
                 PNLogResult(self.client.logger, @"<PubNub> Reuse existing subscription loop information "
                             "because of '%@' is set to 'YES' (timetoken = %@, region = %@)", 
                             (keepOnListChange ? @"keepTimeTokenOnListChange" : @"catchUpOnSubscriptionRestore"),
-                            self->_lastTimeToken, self->_lastTimeTokenRegion);
+                            snapshot.lastTimeToken, snapshot.lastTimeTokenRegion);
                 
                 
                 shouldAcceptNewTimeToken = NO;
                 
                 // Swap time tokens to catch up on events which happened while client changed
                 // channels and groups list configuration.
-                self->_currentTimeToken = self->_lastTimeToken;
-                self->_lastTimeToken = @0;
-                self->_currentTimeTokenRegion = self->_lastTimeTokenRegion;
-                self->_lastTimeTokenRegion = @(-1);
+                snapshot.currentTimeToken = snapshot.lastTimeToken;
+                snapshot.lastTimeToken = @0;
+                snapshot.currentTimeTokenRegion = snapshot.lastTimeTokenRegion;
+                snapshot.lastTimeTokenRegion = @(-1);
             }
         }
         #pragma clang diagnostic pop
         // Ensure what client won't handle delayed requests. It is impossible to have non-initial
         // subscription while current time token report 0.
-        if (!initialSubscription && self->_currentTimeToken &&
-            [self->_currentTimeToken compare:@0] == NSOrderedSame) {
+        if (!initialSubscription && snapshot.currentTimeToken &&
+            [snapshot.currentTimeToken compare:@0] == NSOrderedSame) {
             
             PNLogResult(self.client.logger, @"<PubNub> Ignore new subscription loop information because "
                         "non-initial subscribe request received when current timetoken is 0 (timetoken = %@, "
@@ -1369,25 +1986,25 @@ NS_ASSUME_NONNULL_END
         
         if (shouldAcceptNewTimeToken) {
             
-            if (self->_currentTimeToken && [self->_currentTimeToken compare:@0] != NSOrderedSame) {
+            if (snapshot.currentTimeToken && [snapshot.currentTimeToken compare:@0] != NSOrderedSame) {
                 
-                self->_lastTimeToken = self->_currentTimeToken;
+                snapshot.lastTimeToken = snapshot.currentTimeToken;
             }
-            if (self->_currentTimeTokenRegion && [self->_currentTimeTokenRegion compare:@0] != NSOrderedSame &&
-                [self->_currentTimeTokenRegion compare:@(-1)] == NSOrderedDescending) {
+            if (snapshot.currentTimeTokenRegion && [snapshot.currentTimeTokenRegion compare:@0] != NSOrderedSame &&
+                [snapshot.currentTimeTokenRegion compare:@(-1)] == NSOrderedDescending) {
                 
-                self->_lastTimeTokenRegion = self->_currentTimeTokenRegion;
+                snapshot.lastTimeTokenRegion = snapshot.currentTimeTokenRegion;
             }
-            self->_currentTimeToken = (shouldOverrideTimeToken ? self->_overrideTimeToken : timeToken);
+            snapshot.currentTimeToken = (shouldOverrideTimeToken ? snapshot.overrideTimeToken : timeToken);
             PNLogResult(self.client.logger, @"<PubNub> Did receive next subscription loop information: "
                         "timetoken = %@, region = %@.%@", timeToken, region, 
                         (shouldOverrideTimeToken ? [NSString stringWithFormat:@" But received timetoken "
                                                     "should be replaced with user provided: %@", 
-                                                    self->_overrideTimeToken] : @""));
-            self->_currentTimeTokenRegion = region;
+                                                    snapshot.overrideTimeToken] : @""));
+            snapshot.currentTimeTokenRegion = region;
         }
-        self->_overrideTimeToken = nil;
-    });
+        snapshot.overrideTimeToken = nil;
+    }];
 }
 
 - (void)handleLiveFeedEvents:(PNSubscribeStatus *)status forInitialSubscription:(BOOL)initialSubscription 
@@ -1395,55 +2012,129 @@ NS_ASSUME_NONNULL_END
     
     NSMutableArray *events = [(NSArray *)(status.serviceData)[@"events"] mutableCopy];
     NSUInteger eventsCount = events.count;
-    NSUInteger messageCountThreshold = self.client.configuration.requestMessageCountThreshold;
     if (events.count) {
-        [self.client.listenersManager notifyWithBlock:^{
-            
-            // Check whether after initial subscription client should use user-provided timetoken to catch up on
-            // messages since specified date.
-            if (initialSubscription && overrideTimeToken && [overrideTimeToken compare:@0] != NSOrderedSame) {
-                
-                [self clearCacheFromMessagesNewerThan:overrideTimeToken]; 
-            }
-            
-            // Remove message duplicates from received events list.
-            [self deDuplicateMessages:events];
-            [self continueSubscriptionCycleIfRequiredWithCompletion:nil];
-            
-            // Check whether number of messages exceed specified threshold or not.
-            if (messageCountThreshold > 0 && eventsCount >= messageCountThreshold) {
-                
-                PNSubscribeStatus *exceedStatus = [status copyWithMutatedData:nil];
-                [exceedStatus updateCategory:PNRequestMessageCountExceededCategory];
-                [self.client.listenersManager notifyStatusChange:exceedStatus];
-            }
-            
-            // Iterate through array with notifications and report back using callback blocks to the
-            // user.
-            for (NSMutableDictionary<NSString *, id> *event in events) {
+        if (self.client.configuration.shouldPipelineSubscribeRequests) {
+            [self enqueueLiveFeedEvents:events fromStatus:status forInitialSubscription:initialSubscription
+                      overrideTimeToken:overrideTimeToken];
+        } else {
+            [self.client.listenersManager notifyWithBlock:^{
                 
-                id eventResultObject = [status copyWithMutatedData:event];
+                [self prepareLiveFeedEvents:events forInitialSubscription:initialSubscription
+                          overrideTimeToken:overrideTimeToken];
+                [self notifyLiveFeedEvents:events receivedCount:eventsCount fromStatus:status];
                 
-                // Check whether event has been triggered on presence channel or channel group.
-                if (event[@"presenceEvent"] != nil) {
+                // Hold next long-poll request while listeners doesn't catch up with pending events.
+                [self.client.listenersManager notifyWhenEventsCapacityAvailable:^{
                     
-                    object_setClass(eventResultObject, [PNPresenceEventResult class]);
-                    [self handleNewPresenceEvent:((PNPresenceEventResult *)eventResultObject)];
-                }
-                else {
-                    
-                    object_setClass(eventResultObject, [PNMessageResult class]);
-                    [self handleNewMessage:(PNMessageResult *)eventResultObject];
-                }
-            }
-        }];
+                    [self continueSubscriptionCycleIfRequiredWithCompletion:nil];
+                }];
+            }];
+        }
     } else {
         [self continueSubscriptionCycleIfRequiredWithCompletion:nil];
     }
     [status updateData:[status.serviceData dictionaryWithValuesForKeys:@[@"timetoken", @"region"]]];
 }
 
-- (void)handleNewMessage:(PNMessageResult *)data {
+- (void)enqueueLiveFeedEvents:(NSMutableArray<NSDictionary *> *)events fromStatus:(PNSubscribeStatus *)status
+       forInitialSubscription:(BOOL)initialSubscription overrideTimeToken:(NSNumber *)overrideTimeToken {
+    
+    NSUInteger eventsCount = events.count;
+    __block BOOL shouldContinueSubscriptionCycle = NO;
+    pn_lock(&_eventsPipelineLock, ^{
+        
+        self->_pendingEventBatchesCount++;
+        shouldContinueSubscriptionCycle = (self->_pendingEventBatchesCount < kPubNubMaximumPendingEventBatches);
+        self->_subscriptionCycleDeferred = !shouldContinueSubscriptionCycle;
+    });
+    
+    // Next long-poll request doesn't depend on received events and can be sent before they will be processed.
+    if (shouldContinueSubscriptionCycle) { [self continueSubscriptionCycleIfRequiredWithCompletion:nil]; }
+    
+    dispatch_async(self.eventsProcessingQueue, ^{
+        
+        [self prepareLiveFeedEvents:events forInitialSubscription:initialSubscription
+                  overrideTimeToken:overrideTimeToken];
+        // Silence static analyzer warnings.
+        // Code is aware about this case and at the end will simply call on 'nil' object method.
+        // In most cases if referenced object become 'nil' it mean what there is no more need in
+        // it and probably whole client instance has been deallocated.
+        #pragma clang diagnostic push
+        #pragma clang diagnostic ignored "-Warc-repeated-use-of-weak"
+        [self.client.listenersManager notifyWithBlock:^{
+            
+            [self notifyLiveFeedEvents:events receivedCount:eventsCount fromStatus:status];
+            [self.client.listenersManager notifyWhenEventsCapacityAvailable:^{
+                
+                [self handleLiveFeedEventsBatchDelivery];
+            }];
+        }];
+        #pragma clang diagnostic pop
+    });
+}
+
+- (void)handleLiveFeedEventsBatchDelivery {
+    
+    __block BOOL shouldContinueSubscriptionCycle = NO;
+    pn_lock(&_eventsPipelineLock, ^{
+        
+        self->_pendingEventBatchesCount--;
+        shouldContinueSubscriptionCycle = self->_subscriptionCycleDeferred;
+        self->_subscriptionCycleDeferred = NO;
+    });
+    
+    if (shouldContinueSubscriptionCycle) { [self continueSubscriptionCycleIfRequiredWithCompletion:nil]; }
+}
+
+- (void)prepareLiveFeedEvents:(NSMutableArray<NSDictionary *> *)events
+       forInitialSubscription:(BOOL)initialSubscription overrideTimeToken:(NSNumber *)overrideTimeToken {
+    
+    // Check whether after initial subscription client should use user-provided timetoken to catch up on
+    // messages since specified date.
+    if (initialSubscription && overrideTimeToken && [overrideTimeToken compare:@0] != NSOrderedSame) {
+        
+        [self clearCacheFromMessagesNewerThan:overrideTimeToken]; 
+    }
+    
+    // Remove message duplicates from received events list.
+    [self deDuplicateMessages:events];
+}
+
+- (void)notifyLiveFeedEvents:(NSArray<NSDictionary *> *)events receivedCount:(NSUInteger)eventsCount
+                  fromStatus:(PNSubscribeStatus *)status {
+    
+    NSUInteger messageCountThreshold = self.client.configuration.requestMessageCountThreshold;
+    
+    // Check whether number of messages exceed specified threshold or not.
+    if (messageCountThreshold > 0 && eventsCount >= messageCountThreshold) {
+        
+        PNSubscribeStatus *exceedStatus = [status copyWithMutatedData:nil];
+        [exceedStatus updateCategory:PNRequestMessageCountExceededCategory];
+        [self.client.listenersManager notifyStatusChange:exceedStatus];
+    }
+    
+    // Iterate through array with notifications and report back using callback blocks to the
+    // user.
+    NSMutableArray<PNMessageResult *> *messages = [NSMutableArray arrayWithCapacity:events.count];
+    for (NSMutableDictionary<NSString *, id> *event in events) {
+        
+        // Check whether event has been triggered on presence channel or channel group.
+        // Event objects share request and response information with status by reference.
+        if (event[@"presenceEvent"] != nil) {
+            
+            [self handleNewPresenceEvent:[PNPresenceEventResult objectWithServiceData:event
+                                                                  sharingMetadataWith:status]];
+        }
+        else {
+            
+            PNMessageResult *message = [PNMessageResult objectWithServiceData:event sharingMetadataWith:status];
+            if ([self handleNewMessage:message]) { [messages addObject:message]; }
+        }
+    }
+    [self.client.listenersManager notifyMessages:messages];
+}
+
+- (BOOL)handleNewMessage:(PNMessageResult *)data {
     
     PNErrorStatus *status = nil;
     if (data) {
@@ -1469,6 +2160,8 @@ NS_ASSUME_NONNULL_END
     if (status) { [self.client.listenersManager notifyStatusChange:(id)status]; }
     else if (data) { [self.client.listenersManager notifyMessage:data]; }
     #pragma clang diagnostic pop
+    
+    return (data && !status);
 }
 
 - (void)handleNewPresenceEvent:(PNPresenceEventResult *)data {
@@ -1503,11 +2196,71 @@ NS_ASSUME_NONNULL_END
 
 - (PNRequestParameters *)subscribeRequestParametersWithState:(NSDictionary<NSString *, id> *)state {
     
-    // Compose full list of channels and groups stored in active subscription list.
-    NSArray *channels = [[self channels] arrayByAddingObjectsFromArray:[self presenceChannels]];
+    // Silence static analyzer warnings.
+    // Code is aware about this case and at the end will simply call on 'nil' object method.
+    // In most cases if referenced object become 'nil' it mean what there is no more need in
+    // it and probably whole client instance has been deallocated.
+    #pragma clang diagnostic push
+    #pragma clang diagnostic ignored "-Warc-repeated-use-of-weak"
+    NSUInteger stateVersion = self.client.clientStateManager.version;
+    __block NSDictionary<NSString *, NSString *> *components = nil;
+    pn_safe_property_read(self.resourceAccessQueue, ^{
+        
+        // Re-use components if subscription objects list and client state not changed since last request.
+        if (!state.count && self->_subscribeRequestObjectsListVersion == self->_objectsListVersion &&
+            self->_subscribeRequestStateVersion == stateVersion) {
+            
+            components = self->_subscribeRequestComponents;
+        }
+    });
+    
+    if (!components) { components = [self subscribeRequestComponentsWithState:state]; }
+    
+    // Time token and region taken from same snapshot, so they can't be changed between reads.
+    PNSubscriberSnapshot *snapshot = self.snapshot;
+    PNRequestParameters *parameters = [PNRequestParameters new];
+    [parameters addPathComponent:components[@"channels"] forPlaceholder:@"{channels}"];
+    [parameters addQueryParameter:snapshot.currentTimeToken.stringValue forFieldName:@"tt"];
+    if ([snapshot.currentTimeTokenRegion compare:@(-1)] == NSOrderedDescending) {
+        
+        [parameters addQueryParameter:snapshot.currentTimeTokenRegion.stringValue forFieldName:@"tr"];
+    }
+    
+    if (!self.client.configuration.shouldManagePresenceListManually && self.client.configuration.presenceHeartbeatValue > 0) {
+        
+        [parameters addQueryParameter:@(self.client.configuration.presenceHeartbeatValue).stringValue
+                         forFieldName:@"heartbeat"];
+    }
+    
+    if (components[@"groups"]) { [parameters addQueryParameter:components[@"groups"] forFieldName:@"channel-group"]; }
+    if (components[@"state"]) { [parameters addQueryParameter:components[@"state"] forFieldName:@"state"]; }
+    if (snapshot.escapedFilterExpression) {
+        
+        [parameters addQueryParameter:snapshot.escapedFilterExpression forFieldName:@"filter-expr"];
+    }
+    #pragma clang diagnostic pop
+    
+    return parameters;
+}
+
+- (NSDictionary<NSString *, NSString *> *)subscribeRequestComponentsWithState:(NSDictionary<NSString *, id> *)state {
+    
+    // Compose full list of channels and groups stored in active subscription list (or receiver's shard).
+    __block NSUInteger objectsListVersion = 0;
+    __block NSArray *channels = nil;
+    __block NSArray *groups = nil;
+    pn_safe_property_read(self.resourceAccessQueue, ^{
+        
+        objectsListVersion = self->_objectsListVersion;
+        channels = self->_shardChannels;
+        groups = self->_shardChannelGroups;
+    });
+    channels = (channels ?: [[self channels] arrayByAddingObjectsFromArray:[self presenceChannels]]);
+    groups = (groups ?: [self channelGroups]);
     NSString *channelsList = [PNChannel namesForRequest:channels defaultString:@","];
-    NSString *groupsList = [PNChannel namesForRequest:[self channelGroups]];
-    NSArray *fullObjectsList = [channels arrayByAddingObjectsFromArray:[self channelGroups]];
+    NSString *groupsList = [PNChannel namesForRequest:groups];
+    NSArray *fullObjectsList = [channels arrayByAddingObjectsFromArray:groups];
+    NSMutableDictionary<NSString *, NSString *> *components = [@{ @"channels": channelsList } mutableCopy];
     
     // Silence static analyzer warnings.
     // Code is aware about this case and at the end will simply call on 'nil' object method.
@@ -1515,9 +2268,9 @@ NS_ASSUME_NONNULL_END
     // it and probably whole client instance has been deallocated.
     #pragma clang diagnostic push
     #pragma clang diagnostic ignored "-Warc-repeated-use-of-weak"
-    NSDictionary *mergedState = [self.client.clientStateManager stateMergedWith:state
-                                                                     forObjects:fullObjectsList];
-    [self.client.clientStateManager mergeWithState:mergedState];
+    NSUInteger stateVersion = 0;
+    NSDictionary *mergedState = [self.client.clientStateManager mergeWithState:state forObjects:fullObjectsList
+                                                                        version:&stateVersion];
     
     // Extract state information only for channels and groups which is used in subscribe loop.
     if (self.client.configuration.shouldManagePresenceListManually) {
@@ -1530,127 +2283,64 @@ NS_ASSUME_NONNULL_END
         mergedState = filteredState;
     }
     
-    PNRequestParameters *parameters = [PNRequestParameters new];
-    [parameters addPathComponent:channelsList forPlaceholder:@"{channels}"];
-    [parameters addQueryParameter:self.currentTimeToken.stringValue forFieldName:@"tt"];
-    if ([self.currentTimeTokenRegion compare:@(-1)] == NSOrderedDescending) {
-        
-        [parameters addQueryParameter:self.currentTimeTokenRegion.stringValue forFieldName:@"tr"];
-    }
-    
-    if (!self.client.configuration.shouldManagePresenceListManually && self.client.configuration.presenceHeartbeatValue > 0) {
-        
-        [parameters addQueryParameter:@(self.client.configuration.presenceHeartbeatValue).stringValue
-                         forFieldName:@"heartbeat"];
-    }
-    
-    if (groupsList.length) { [parameters addQueryParameter:groupsList forFieldName:@"channel-group"]; }
+    if (groupsList.length) { components[@"groups"] = groupsList; }
     if (mergedState.count) {
         
         NSString *mergedStateString = [PNJSON JSONStringFrom:mergedState withError:nil];
         if (mergedStateString.length) {
             
-            [parameters addQueryParameter:[PNString percentEscapedString:mergedStateString]
-                             forFieldName:@"state"];
+            components[@"state"] = [PNString percentEscapedString:mergedStateString];
         }
     }
-    if (self.escapedFilterExpression) {
+    #pragma clang diagnostic pop
+    
+    // Components with explicitly passed state can't be re-used by next subscription cycles.
+    if (!state.count) {
         
-        [parameters addQueryParameter:self.escapedFilterExpression forFieldName:@"filter-expr"];
+        pn_safe_property_write(self.resourceAccessQueue, ^{
+            
+            self->_subscribeRequestComponents = [components copy];
+            self->_subscribeRequestObjectsListVersion = objectsListVersion;
+            self->_subscribeRequestStateVersion = stateVersion;
+        });
     }
-    #pragma clang diagnostic pop
     
-    return parameters;
+    return components;
 }
 
 - (void)deDuplicateMessages:(NSMutableArray<NSDictionary *> *)events {
     
-    NSUInteger maximumMessagesCacheSize = self.client.configuration.maximumMessagesCacheSize;
-    if (maximumMessagesCacheSize > 0) {
+    if (self.messagesCache.capacity > 0) {
         
         NSMutableIndexSet *duplicateMessagesIndices = [NSMutableIndexSet indexSet];
         [events enumerateObjectsUsingBlock:^(NSDictionary<NSString *, id> *event, NSUInteger eventIdx, 
                                              BOOL *eventsEnumeratorStop) {
             
             if (event[@"presenceEvent"] == nil && 
-                ![self cacheObjectIfPossible:event withMaximumCacheSize:maximumMessagesCacheSize]) {
+                ![self.messagesCache storeMessage:event[@"message"] withTimetoken:event[@"timetoken"]
+                                       forChannel:event[@"channel"]]) {
                 
                 [duplicateMessagesIndices addIndex:eventIdx];
             }
         }];
         if (duplicateMessagesIndices.count) { [events removeObjectsAtIndexes:duplicateMessagesIndices]; }
-        [self cleanUpCachedObjectsIfRequired:maximumMessagesCacheSize];
     }
 }
 
 - (void)clearCacheFromMessagesNewerThan:(NSNumber *)timetoken {
     
-    NSUInteger maximumMessagesCacheSize = self.client.configuration.maximumMessagesCacheSize;
-    if (maximumMessagesCacheSize > 0) {
-        
-        SEL sortSelector = @selector(localizedCaseInsensitiveCompare:);
-        NSArray<NSString *> *identifiers = [[_cachedObjects allKeys] sortedArrayUsingSelector:sortSelector];
-        NSString *timetokenString = timetoken.stringValue;
-        __block NSUInteger indexOfMessage = NSNotFound;
-        [identifiers enumerateObjectsUsingBlock:^(NSString *identifier, NSUInteger identifierIdx, 
-                                                  BOOL *identifiersEnumeratorStop) {
-            
-            NSString *cachedTimetoken = [identifier componentsSeparatedByString:@"_"][0];
-            NSComparisonResult result = [timetokenString compare:cachedTimetoken options:NSNumericSearch];
-            if (result == NSOrderedSame || result == NSOrderedAscending) { indexOfMessage = identifierIdx; }
-            *identifiersEnumeratorStop = (indexOfMessage != NSNotFound);
-        }];
-        
-        if (indexOfMessage != NSNotFound) {
-            
-            NSRange messagesRange = NSMakeRange(indexOfMessage, identifiers.count - indexOfMessage);
-            identifiers = [identifiers subarrayWithRange:messagesRange];
-            [_cachedObjects removeObjectsForKeys:identifiers];
-            [_cachedObjectIdentifiers removeObjectsInArray:identifiers];
-        }
-    }
-}
-
-- (BOOL)cacheObjectIfPossible:(NSDictionary *)object withMaximumCacheSize:(NSUInteger)size {
-    
-    BOOL cached = NO;
-    NSString *identifier = [@[object[@"timetoken"], object[@"channel"]] componentsJoinedByString:@"_"];
-    NSMutableArray *objects = (_cachedObjects[identifier]?: [NSMutableArray new]);
-    NSUInteger cachedMessagesCount = objects.count;
-    
-    // Cache objects if required.
-    id data = object[@"message"];
-    if (objects.count == 0 || [objects indexOfObject:data] == NSNotFound) {
-        
-        cached = YES; 
-        [objects addObject:data];
-        [_cachedObjectIdentifiers addObject:identifier];
-    }
-    if (cachedMessagesCount == 0) { _cachedObjects[identifier] = objects; }
-    
-    return cached;
-}
-
-- (void)cleanUpCachedObjectsIfRequired:(NSUInteger)maximumCacheSize {
-    
-    if (_cachedObjectIdentifiers.count > maximumCacheSize) {
-        
-        NSString *identifier = [_cachedObjectIdentifiers objectAtIndex:0];
-        NSMutableArray *objects = _cachedObjects[identifier];
-        if (objects.count == 1) { [_cachedObjects removeObjectForKey:identifier]; }
-        else { [objects removeObjectAtIndex:0]; }
-        [_cachedObjectIdentifiers removeObjectAtIndex:0];
-    }
+    [self.messagesCache removeMessagesNewerThan:timetoken];
 }
 
 - (void)appendSubscriberInformation:(PNStatus *)status {
     
-    status.currentTimetoken = _currentTimeToken;
-    status.lastTimeToken = _lastTimeToken;
-    status.currentTimeTokenRegion = _currentTimeTokenRegion;
-    status.lastTimeTokenRegion = _lastTimeTokenRegion;
-    status.subscribedChannels = [_channelsSet setByAddingObjectsFromSet:_presenceChannelsSet].allObjects;
-    status.subscribedChannelGroups = _channelGroupsSet.allObjects;
+    PNSubscriberSnapshot *snapshot = self.snapshot;
+    status.currentTimetoken = snapshot.currentTimeToken;
+    status.lastTimeToken = snapshot.lastTimeToken;
+    status.currentTimeTokenRegion = snapshot.currentTimeTokenRegion;
+    status.lastTimeTokenRegion = snapshot.lastTimeTokenRegion;
+    status.subscribedChannels = [snapshot.channels setByAddingObjectsFromSet:snapshot.presenceChannels].allObjects;
+    status.subscribedChannelGroups = snapshot.channelGroups.allObjects;
 }
 
 #pragma mark -
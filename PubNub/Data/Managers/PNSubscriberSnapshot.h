@@ -0,0 +1,153 @@
+#import <Foundation/Foundation.h>
+
+
+NS_ASSUME_NONNULL_BEGIN
+
+/**
+ @brief      Immutable snapshot of subscriber's subscription information.
+ @discussion Subscriber publish new snapshot each time when list of subscription objects, subscription loop
+             time tokens, filter expression or retry timer change. Published snapshot never modified, so it
+             can be read from any thread without synchronization.
+
+ @author Sergey Mamontov
+ @since 4.8.2
+ @copyright © 2009-2017 PubNub, Inc.
+ */
+@interface PNSubscriberSnapshot : NSObject <NSCopying, NSMutableCopying>
+
+
+///------------------------------------------------
+/// @name Information
+///------------------------------------------------
+
+/**
+ @brief  Set of channels on which client subscribed at this moment.
+
+ @since 4.8.2
+ */
+@property (nonatomic, readonly, copy) NSSet<NSString *> *channels;
+
+/**
+ @brief  Set of channel groups on which client subscribed at this moment.
+
+ @since 4.8.2
+ */
+@property (nonatomic, readonly, copy) NSSet<NSString *> *channelGroups;
+
+/**
+ @brief  Set of presence channels on which client subscribed at this moment.
+
+ @since 4.8.2
+ */
+@property (nonatomic, readonly, copy) NSSet<NSString *> *presenceChannels;
+
+/**
+ @brief      Reference on time token which is used for current subscribe loop iteration.
+ @discussion \b 0 for initial subscription loop and non-zero for long-poll requests.
+
+ @since 4.8.2
+ */
+@property (nonatomic, readonly, strong) NSNumber *currentTimeToken;
+
+/**
+ @brief  Reference on \b PubNub server region identifier (which generated \c currentTimeToken value).
+
+ @since 4.8.2
+ */
+@property (nonatomic, readonly, strong) NSNumber *currentTimeTokenRegion;
+
+/**
+ @brief  Reference on time token which has been used for previous subscribe loop iteration.
+
+ @since 4.8.2
+ */
+@property (nonatomic, readonly, strong) NSNumber *lastTimeToken;
+
+/**
+ @brief  Reference on time token region which has been used for previous subscribe loop iteration.
+
+ @since 4.8.2
+ */
+@property (nonatomic, readonly, strong) NSNumber *lastTimeTokenRegion;
+
+/**
+ @brief  Reference on time token which should be used after initial subscription with \b 0 timetoken.
+
+ @since 4.8.2
+ */
+@property (nonatomic, nullable, readonly, strong) NSNumber *overrideTimeToken;
+
+/**
+ @brief  Stores reference on messages filtering expression.
+
+ @since 4.8.2
+ */
+@property (nonatomic, nullable, readonly, copy) NSString *filterExpression;
+
+/**
+ @brief  Stores reference on percent-escaped messages filtering expression.
+
+ @since 4.8.2
+ */
+@property (nonatomic, nullable, readonly, copy) NSString *escapedFilterExpression;
+
+/**
+ @brief  Stores reference on GCD timer used to re-issue subscribe request.
+
+ @since 4.8.2
+ */
+@property (nonatomic, nullable, readonly, strong) dispatch_source_t retryTimer;
+
+
+///------------------------------------------------
+/// @name Initialization and Configuration
+///------------------------------------------------
+
+/**
+ @brief  Construct snapshot for subscriber which doesn't subscribed on any remote data objects.
+
+ @return Configured and ready to use subscription information snapshot.
+
+ @since 4.8.2
+ */
++ (instancetype)snapshot;
+
+#pragma mark -
+
+
+@end
+
+
+/**
+ @brief      Mutable version of subscription information snapshot.
+ @discussion Subscriber modify mutable copy of currently published snapshot and publish it's immutable copy.
+
+ @author Sergey Mamontov
+ @since 4.8.2
+ @copyright © 2009-2017 PubNub, Inc.
+ */
+@interface PNMutableSubscriberSnapshot : PNSubscriberSnapshot
+
+
+///------------------------------------------------
+/// @name Information
+///------------------------------------------------
+
+@property (nonatomic, copy) NSSet<NSString *> *channels;
+@property (nonatomic, copy) NSSet<NSString *> *channelGroups;
+@property (nonatomic, copy) NSSet<NSString *> *presenceChannels;
+@property (nonatomic, strong) NSNumber *currentTimeToken;
+@property (nonatomic, strong) NSNumber *currentTimeTokenRegion;
+@property (nonatomic, strong) NSNumber *lastTimeToken;
+@property (nonatomic, strong) NSNumber *lastTimeTokenRegion;
+@property (nonatomic, nullable, strong) NSNumber *overrideTimeToken;
+@property (nonatomic, nullable, copy) NSString *filterExpression;
+@property (nonatomic, nullable, copy) NSString *escapedFilterExpression;
+@property (nonatomic, nullable, strong) dispatch_source_t retryTimer;
+
+#pragma mark -
+
+
+@end
+
+NS_ASSUME_NONNULL_END
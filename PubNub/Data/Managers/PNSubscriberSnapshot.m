@@ -0,0 +1,122 @@
+/**
+ @author Sergey Mamontov
+ @since 4.8.2
+ @copyright © 2009-2017 PubNub, Inc.
+ */
+#import "PNSubscriberSnapshot.h"
+
+
+NS_ASSUME_NONNULL_BEGIN
+
+#pragma mark Protected interface declaration
+
+@interface PNSubscriberSnapshot ()
+
+
+#pragma mark - Information
+
+@property (nonatomic, copy) NSSet<NSString *> *channels;
+@property (nonatomic, copy) NSSet<NSString *> *channelGroups;
+@property (nonatomic, copy) NSSet<NSString *> *presenceChannels;
+@property (nonatomic, strong) NSNumber *currentTimeToken;
+@property (nonatomic, strong) NSNumber *currentTimeTokenRegion;
+@property (nonatomic, strong) NSNumber *lastTimeToken;
+@property (nonatomic, strong) NSNumber *lastTimeTokenRegion;
+@property (nonatomic, nullable, strong) NSNumber *overrideTimeToken;
+@property (nonatomic, nullable, copy) NSString *filterExpression;
+@property (nonatomic, nullable, copy) NSString *escapedFilterExpression;
+@property (nonatomic, nullable, strong) dispatch_source_t retryTimer;
+
+
+#pragma mark - Initialization and Configuration
+
+/**
+ @brief  Copy subscription information from another snapshot into receiver.
+
+ @param snapshot Reference on snapshot from which information should be copied.
+
+ @since 4.8.2
+ */
+- (void)copyInformationFromSnapshot:(PNSubscriberSnapshot *)snapshot;
+
+#pragma mark -
+
+
+@end
+
+NS_ASSUME_NONNULL_END
+
+
+#pragma mark - Interface implementation
+
+@implementation PNSubscriberSnapshot
+
+
+#pragma mark - Initialization and Configuration
+
++ (instancetype)snapshot {
+
+    PNSubscriberSnapshot *snapshot = [self new];
+    snapshot.channels = [NSSet set];
+    snapshot.channelGroups = [NSSet set];
+    snapshot.presenceChannels = [NSSet set];
+    snapshot.currentTimeToken = @0;
+    snapshot.currentTimeTokenRegion = @(-1);
+    snapshot.lastTimeToken = @0;
+    snapshot.lastTimeTokenRegion = @(-1);
+
+    return snapshot;
+}
+
+- (void)copyInformationFromSnapshot:(PNSubscriberSnapshot *)snapshot {
+
+    _channels = snapshot.channels;
+    _channelGroups = snapshot.channelGroups;
+    _presenceChannels = snapshot.presenceChannels;
+    _currentTimeToken = snapshot.currentTimeToken;
+    _currentTimeTokenRegion = snapshot.currentTimeTokenRegion;
+    _lastTimeToken = snapshot.lastTimeToken;
+    _lastTimeTokenRegion = snapshot.lastTimeTokenRegion;
+    _overrideTimeToken = snapshot.overrideTimeToken;
+    _filterExpression = snapshot.filterExpression;
+    _escapedFilterExpression = snapshot.escapedFilterExpression;
+    _retryTimer = snapshot.retryTimer;
+}
+
+- (id)copyWithZone:(NSZone *)zone {
+
+    // Immutable snapshot can be shared as-is.
+    if ([self isMemberOfClass:[PNSubscriberSnapshot class]]) { return self; }
+
+    PNSubscriberSnapshot *snapshot = [[PNSubscriberSnapshot allocWithZone:zone] init];
+    [snapshot copyInformationFromSnapshot:self];
+
+    return snapshot;
+}
+
+- (id)mutableCopyWithZone:(NSZone *)zone {
+
+    PNMutableSubscriberSnapshot *snapshot = [[PNMutableSubscriberSnapshot allocWithZone:zone] init];
+    [snapshot copyInformationFromSnapshot:self];
+
+    return snapshot;
+}
+
+#pragma mark -
+
+
+@end
+
+
+#pragma mark - Interface implementation
+
+@implementation PNMutableSubscriberSnapshot
+
+@dynamic channels, channelGroups, presenceChannels;
+@dynamic currentTimeToken, currentTimeTokenRegion, lastTimeToken, lastTimeTokenRegion, overrideTimeToken;
+@dynamic filterExpression, escapedFilterExpression, retryTimer;
+
+#pragma mark -
+
+
+@end
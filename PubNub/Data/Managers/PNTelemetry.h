@@ -31,6 +31,20 @@ NS_ASSUME_NONNULL_BEGIN
  */
 - (NSDictionary *)operationsLatencyForRequest;
 
+/**
+ @brief      Retrieve latency percentile for API endpoint which is used by operation.
+ @discussion Calculated from latencies which has been stored during last minute.
+ 
+ @param percentile    Percentile which should be calculated (for example \b 95 for p95).
+ @param operationType One of \b PNOperationType enumerator fields which describe for which endpoint latency
+                      should be calculated.
+ 
+ @return Latency in seconds or \b -1 in case if there is not enough stored latencies for endpoint.
+ 
+ @since 4.8.2
+ */
+- (NSTimeInterval)latencyPercentile:(double)percentile forOperation:(PNOperationType)operationType;
+
 
 ///------------------------------------------------
 /// @name Telemetry information tracking
@@ -84,6 +98,75 @@ NS_ASSUME_NONNULL_BEGIN
 - (void)setLatency:(NSTimeInterval)latency forOperation:(PNOperationType)operationType;
 
 
+///------------------------------------------------
+/// @name Metrics
+///------------------------------------------------
+
+/**
+ @brief  Retrieve current values of all counters and gauges which has been reported by client components.
+ 
+ @return Dictionary where each metric name is mapped to it's latest value.
+ 
+ @since 4.8.2
+ */
+- (NSDictionary<NSString *, NSNumber *> *)metrics;
+
+/**
+ @brief  Increase value of counter.
+ 
+ @param metric Name of counter which should be changed (counter created with  0 value if it doesn't exist).
+ @param value  Value which should be added to current counter value.
+ 
+ @since 4.8.2
+ */
+- (void)incrementMetric:(NSString *)metric by:(NSInteger)value;
+
+/**
+ @brief  Store gauge value.
+ 
+ @param value  Reference on latest gauge value.
+ @param metric Name of gauge for which value should be stored.
+ 
+ @since 4.8.2
+ */
+- (void)setValue:(NSNumber *)value forMetric:(NSString *)metric;
+
+/**
+ @brief      Store size of compressed response body.
+ @discussion Manager accumulate number of received (\c compression.<endpoint>.receivedBytes) and inflated
+             (\c compression.<endpoint>.inflatedBytes) bytes and update compression ratio gauge
+             (\c compression.<endpoint>.ratio).
+ 
+ @param length         Number of compressed bytes which has been received from \b PubNub network.
+ @param inflatedLength Number of bytes which has been produced from compressed response body.
+ @param endpoint       Shortened name of API endpoint which returned compressed response.
+ 
+ @since 4.8.2
+ */
+- (void)trackCompressedResponseLength:(NSUInteger)length inflatedLength:(NSUInteger)inflatedLength
+                          forEndpoint:(NSString *)endpoint;
+
+
+///------------------------------------------------
+/// @name Operation information
+///------------------------------------------------
+
+/**
+ @brief      Shortened name of API endpoint for specific operation.
+ @discussion Some operations refer to single endpoint with only difference in passed parameters, but actual
+             endpoint is the same. This method return shortened name of this endpoint (\c pub, \c hist,
+             \c pres, \c cg, \c push or \c time).
+ 
+ @param operationType One of \b PNOperationType enumerator fields which describe for which operation endpoint
+                      should be retrieved.
+ 
+ @return Shortened API endpoint name.
+ 
+ @since 4.6.2
+ */
+- (NSString *)endpointNameForOperation:(PNOperationType)operationType;
+
+
 ///------------------------------------------------
 /// @name Misc
 ///------------------------------------------------
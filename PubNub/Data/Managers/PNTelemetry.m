@@ -34,6 +34,13 @@ static NSString * const kPNOperationDateKey = @"d";
  */
 static NSString * const kPNOperationLatencyKey = @"l";
 
+/**
+ @brief  Stores minimum number of stored latencies for endpoint which is required to calculate percentile.
+ 
+ @since 4.8.2
+ */
+static NSUInteger const kPNLatencyPercentileMinimumSamples = 10;
+
 
 NS_ASSUME_NONNULL_BEGIN
 
@@ -74,22 +81,12 @@ NS_ASSUME_NONNULL_BEGIN
  */
 @property (nonatomic, strong) dispatch_queue_t resourceAccessQueue;
 
-
-#pragma mark - Operation information
-
 /**
- @brief      Shortened name of API endpoint for specific operation.
- @discussion Some operations refer to single endpoint with only difference in passed parameters, but actual
-             endpoint is the same. This method return shortened name of this endpoint.
- 
- @param operationType One of \b PNOperationType enumerator fields which describe for which operation endpoint
-                      should be retrieved.
- 
- @return Shortened API endpoint name.
+ @brief  Stores reference on counters and gauges which has been reported by client components.
  
- @since 4.6.2
+ @since 4.8.2
  */
-- (NSString *)endpointNameForOperation:(PNOperationType)operationType;
+@property (nonatomic, strong) NSMutableDictionary<NSString *, NSNumber *> *reportedMetrics;
 
 
 #pragma mark - Handlers
@@ -126,6 +123,7 @@ NS_ASSUME_NONNULL_END
         _resourceAccessQueue = dispatch_queue_create("com.pubnub.telemetry", DISPATCH_QUEUE_CONCURRENT);
         _latencies = [NSMutableDictionary new];
         _trackedLatencies = [NSMutableDictionary new];
+        _reportedMetrics = [NSMutableDictionary new];
         _cleanUpTimer = [NSTimer scheduledTimerWithTimeInterval:1.0f
                                                          target:self
                                                        selector:@selector(handleCleanUpTimer:)
@@ -157,6 +155,24 @@ NS_ASSUME_NONNULL_END
     return [latenciesForRequest copy];
 }
 
+- (NSTimeInterval)latencyPercentile:(double)percentile forOperation:(PNOperationType)operationType {
+    
+    __block NSTimeInterval latency = -1.f;
+    NSString *endpointName = [self endpointNameForOperation:operationType];
+    pn_safe_property_read(self.resourceAccessQueue, ^{
+        NSArray<NSNumber *> *latencies = [self.latencies[endpointName] valueForKey:kPNOperationLatencyKey];
+
+        if (latencies.count >= kPNLatencyPercentileMinimumSamples) {
+            NSArray<NSNumber *> *sortedLatencies = [latencies sortedArrayUsingSelector:@selector(compare:)];
+            NSUInteger index = (NSUInteger)ceil(MIN(MAX(percentile, 0.f), 100.f) / 100.f * sortedLatencies.count);
+
+            latency = sortedLatencies[(index > 0 ? index - 1 : 0)].doubleValue;
+        }
+    });
+    
+    return latency;
+}
+
 
 
 #pragma mark - Telemetry information tracking
@@ -221,6 +237,52 @@ NS_ASSUME_NONNULL_END
 }
 
 
+#pragma mark - Metrics
+
+- (NSDictionary<NSString *, NSNumber *> *)metrics {
+    
+    __block NSDictionary *metrics = nil;
+    pn_safe_property_read(self.resourceAccessQueue, ^{
+        metrics = [self.reportedMetrics copy];
+    });
+    
+    return metrics;
+}
+
+- (void)incrementMetric:(NSString *)metric by:(NSInteger)value {
+    
+    pn_safe_property_write(self.resourceAccessQueue, ^{
+        self.reportedMetrics[metric] = @(self.reportedMetrics[metric].integerValue + value);
+    });
+}
+
+- (void)setValue:(NSNumber *)value forMetric:(NSString *)metric {
+    
+    pn_safe_property_write(self.resourceAccessQueue, ^{
+        self.reportedMetrics[metric] = value;
+    });
+}
+
+- (void)trackCompressedResponseLength:(NSUInteger)length inflatedLength:(NSUInteger)inflatedLength
+                          forEndpoint:(NSString *)endpoint {
+    
+    NSString *prefix = [@"compression." stringByAppendingString:endpoint];
+    NSString *receivedMetric = [prefix stringByAppendingString:@".receivedBytes"];
+    NSString *inflatedMetric = [prefix stringByAppendingString:@".inflatedBytes"];
+    
+    pn_safe_property_write(self.resourceAccessQueue, ^{
+        NSInteger received = self.reportedMetrics[receivedMetric].integerValue + (NSInteger)length;
+        NSInteger inflated = self.reportedMetrics[inflatedMetric].integerValue + (NSInteger)inflatedLength;
+        
+        self.reportedMetrics[receivedMetric] = @(received);
+        self.reportedMetrics[inflatedMetric] = @(inflated);
+        if (received > 0) {
+            self.reportedMetrics[[prefix stringByAppendingString:@".ratio"]] = @((double)inflated / received);
+        }
+    });
+}
+
+
 #pragma mark - Operation information
 
 - (NSString *)endpointNameForOperation:(PNOperationType)operationType {
@@ -270,6 +270,358 @@ NS_ASSUME_NONNULL_BEGIN
  */
 @property (nonatomic, assign) NSUInteger maximumMessagesCacheSize NS_SWIFT_NAME(maximumMessagesCacheSize);
 
+/**
+ @brief      Stores whether client should send next subscribe request as soon as time token from previous one
+             has been processed.
+ @discussion By default, next long-poll request is sent only after received events has been de-duplicated
+             and scheduled for delivery on listeners queue. This mean what slow listeners delay next
+             subscribe request and increase latency for all messages which follow.
+             When this property is set to \c YES, received events will be processed and delivered to
+             listeners on separate stage, while client already waits for next events from \b PubNub
+             network. Number of responses which can wait for processing is limited and when limit is
+             reached, client will hold next subscribe request till listeners catch up.
+
+ @default    By default client use \b NO and send next subscribe request after events has been scheduled for
+             delivery.
+
+ @since 4.8.2
+ */
+@property (nonatomic, assign, getter = shouldPipelineSubscribeRequests) BOOL pipelineSubscribeRequests NS_SWIFT_NAME(pipelineSubscribeRequests);
+
+/**
+ @brief      Stores maximum length of subscribe request URL.
+ @discussion When list of channels and groups (along with client state and filter expression) doesn't fit
+             into single subscribe request, client will split them between few concurrent long-poll requests
+             (up to \b 8). Each of them track own time token and region, but all received events delivered
+             through same listeners.
+             Each subscribe request require separate long-poll connection, so client may open up to \b 8
+             connections for subscription when split is enabled.
+
+ @default    By default client doesn't split subscription (\b 0) and use single long-poll connection.
+
+ @since 4.8.2
+ */
+@property (nonatomic, assign) NSUInteger maximumSubscribeRequestURLLength NS_SWIFT_NAME(maximumSubscribeRequestURLLength);
+
+/**
+ @brief      Stores maximum number of real-time events which can wait for delivery to listeners.
+ @discussion Received messages, presence events and subscription statuses are placed into queue from which
+             they are delivered on \c callbackQueue. When listeners can't keep up with events and queue size
+             reach this value, \c eventsOverflowPolicy will be used to keep memory usage predictable.
+             Each message from messages batch counted separately.
+             Limit can be enabled by passing any value larger than \b 0 (for example \b 1000).
+ 
+ @default    By default limit is disabled (\b 0) and any number of events can wait for delivery.
+ 
+ @since 4.8.2
+ */
+@property (nonatomic, assign) NSUInteger maximumPendingEvents NS_SWIFT_NAME(maximumPendingEvents);
+
+/**
+ @brief      Stores policy which should be used when number of pending events reach \c maximumPendingEvents.
+ @discussion Subscription statuses never dropped or coalesced. With \b PNEventsOverflowBlockPolicy events
+             from long-poll response which is already received still placed into queue, so queue may exceed
+             limit by size of single response.
+             Policy is used only when \c maximumPendingEvents is larger than \b 0.
+ 
+ @default    By default client use \b PNEventsOverflowBlockPolicy and hold next subscribe request till
+             listeners will catch up.
+ 
+ @since 4.8.2
+ */
+@property (nonatomic, assign) PNEventsOverflowPolicy eventsOverflowPolicy NS_SWIFT_NAME(eventsOverflowPolicy);
+
+/**
+ @brief      Stores for how long messages from consecutive subscribe responses should be collected into single
+             batch for listeners which implement \c -client:didReceiveMessages:.
+ @discussion Bigger window reduce number of listener calls during messages burst, but delay delivery of first
+             message in batch by up to this interval.
+ 
+ @default    By default client deliver separate batch for each subscribe response (\b 0 seconds window).
+ 
+ @since 4.8.2
+ */
+@property (nonatomic, assign) NSTimeInterval messagesAggregationWindow NS_SWIFT_NAME(messagesAggregationWindow);
+
+/**
+ @brief      Stores minimum delay before subscription retry or network reachability check.
+ @discussion Client use exponential backoff with random jitter between attempts, so clients which lost
+             connection at same time won't try to reconnect at same time.
+ 
+ @default    By default client wait at least \b 1 second before next attempt.
+ 
+ @since 4.8.2
+ */
+@property (nonatomic, assign) NSTimeInterval retryInitialDelay NS_SWIFT_NAME(retryInitialDelay);
+
+/**
+ @brief  Stores maximum delay before subscription retry or network reachability check.
+ 
+ @default By default client wait no more than \b 32 seconds before next attempt.
+ 
+ @since 4.8.2
+ */
+@property (nonatomic, assign) NSTimeInterval retryMaximumDelay NS_SWIFT_NAME(retryMaximumDelay);
+
+/**
+ @brief      Stores maximum number of subscription retry attempts after which client will stop automatic
+             retry.
+ @discussion Network reachability check (and subscribe requests of subscription shards) continue with
+             \c retryMaximumDelay interval after budget exhausted, so client will be able to restore
+             subscription when network will be available.
+             It is possible to disable limit by passing \b 0 to this property.
+ 
+ @default    By default client doesn't limit number of retry attempts.
+ 
+ @since 4.8.2
+ */
+@property (nonatomic, assign) NSUInteger retryBudget NS_SWIFT_NAME(retryBudget);
+
+/**
+ @brief      Stores whether client should send requests using connections which is shared with other clients
+             in same process or not.
+ @discussion Shared transport allow to host many clients in single process (bridge services or load
+             generators) without separate session, delegate queue and connections pool for each of them. 
+             Keep-alive connections reused by all clients and completion blocks processed by small shared
+             pool of workers.
+ 
+ @default    By default each client use own connections.
+ 
+ @note       This property ignored when client used in application extension context.
+ 
+ @since 4.8.2
+ */
+@property (nonatomic, assign, getter = shouldUseSharedTransport) BOOL useSharedTransport NS_SWIFT_NAME(useSharedTransport);
+
+/**
+ @brief      Stores whether client should parse subscribe response while it is received or not.
+ @discussion Events parsed one-by-one as soon as they arrive, so big catch up responses doesn't require
+             to keep whole response body and it's de-serialized copy in memory at the same time and parsing
+             doesn't start only after last byte has been received.
+ 
+ @default    By default client parse subscribe response after it has been completelly received.
+ 
+ @note       This property ignored when client use shared transport or used in application extension context.
+ 
+ @since 4.8.2
+ */
+@property (nonatomic, assign, getter = shouldStreamSubscribeResponses) BOOL streamSubscribeResponses NS_SWIFT_NAME(streamSubscribeResponses);
+
+/**
+ @brief      Stores maximum number of concurrent non-subscribe requests for each priority class.
+ @discussion Map of \b PNRequestPriority enum fields to maximum number of requests from this class which can
+             be sent at the same time. Requests from class with higher priority sent first when there is free
+             connection, so burst of history or presence audit requests won't delay publish and heartbeat
+             requests. Classes which is not specified in map use default limit.
+ 
+ @default    By default client allow up to \b 3 publish, \b 1 heartbeat, \b 2 state and \b 2 audit requests
+             (but no more than \b 3 requests from all classes).
+ 
+ @note       This property ignored when client used in application extension context.
+ 
+ @since 4.8.2
+ */
+@property (nonatomic, copy) NSDictionary<NSNumber *, NSNumber *> *concurrentRequestsLimits NS_SWIFT_NAME(concurrentRequestsLimits);
+
+/**
+ @brief      Stores for how long results of idempotent read operations can be reused.
+ @discussion Map of \b PNOperationType enum fields to time-to-live (in seconds) of their results. Same API
+             call with same arguments will be completed with cached result without request to \b PubNub
+             network. Results can be cached for presence (\c hereNow, \c whereNow), client state, channel
+             groups and push notifications audit and time operations. Modification operations invalidate
+             results which they can affect (for example, \c setState invalidate client state audit). Presence
+             audit results doesn't track subscription changes and rely only on time-to-live.
+ 
+ @default    By default client doesn't cache results.
+ 
+ @since 4.8.2
+ */
+@property (nonatomic, copy) NSDictionary<NSNumber *, NSNumber *> *responseCacheTimeToLive NS_SWIFT_NAME(responseCacheTimeToLive);
+
+/**
+ @brief      Stores maximum number of results which can be stored in response cache.
+ @discussion Least recently used result removed when limit is reached.
+ 
+ @default    By default client store up to \b 100 results.
+ 
+ @since 4.8.2
+ */
+@property (nonatomic, assign) NSUInteger maximumResponseCacheSize NS_SWIFT_NAME(maximumResponseCacheSize);
+
+/**
+ @brief      Stores whether client should open connections to \c origin right after it has been created.
+ @discussion Client send lightweight requests to open up to \b 3 connections for non-subscribe requests and
+             single connection for subscribe requests, so first API call won't wait for DNS lookup, TCP and
+             TLS handshakes. Opened connections kept alive by system for reuse. Client created with
+             \c -copyWithConfiguration:completion: also warm up it's connections while previous client still
+             alive (TLS session resumption handled by system TLS stack).
+ 
+ @default    By default client open connections with first API call.
+ 
+ @note       This property ignored when client used in application extension context.
+ 
+ @since 4.8.2
+ */
+@property (nonatomic, assign, getter = shouldWarmUpConnections) BOOL warmUpConnections NS_SWIFT_NAME(warmUpConnections);
+
+/**
+ @brief      Stores maximum number of automatic retry attempts for failed non-subscribe requests.
+ @discussion Map of \b PNOperationType enum fields to number of attempts which client can do after request
+             failed because of timeout, network issues or \b PubNub service error (\b 5xx or \b 429 status
+             codes). Retry delays grow exponentially with random jitter. Only idempotent operations (audit,
+             history, heartbeat, state, channel groups and push notifications modification) and publish
+             (which is sent again with same \c seqn value) can be retried. Completion block called only once
+             with status of last attempt.
+
+ @default    By default client doesn't retry failed requests.
+
+ @since 4.8.2
+ */
+@property (nonatomic, copy) NSDictionary<NSNumber *, NSNumber *> *requestRetryAttempts NS_SWIFT_NAME(requestRetryAttempts);
+
+/**
+ @brief      Stores maximum number of automatic retry attempts which can be done by client in a row.
+ @discussion Each retry attempt (for any operation) consume budget and each successful request restore
+             \b 0.1 of attempt (only operations listed in \c requestRetryAttempts tracked), so during outage
+             client won't multiply load with retries.
+
+ @default    By default client can do up to \b 10 retry attempts in a row.
+
+ @since 4.8.2
+ */
+@property (nonatomic, assign) NSUInteger requestRetryBudget NS_SWIFT_NAME(requestRetryBudget);
+
+/**
+ @brief      Stores maximum time (in seconds) since API call during which failed request can be retried.
+ @discussion Retry attempt won't be scheduled if it's delay end after this deadline.
+
+ @default    By default requests can be retried during \b 30 seconds.
+
+ @since 4.8.2
+ */
+@property (nonatomic, assign) NSTimeInterval requestRetryDeadline NS_SWIFT_NAME(requestRetryDeadline);
+
+/**
+ @brief      Stores whether client should send duplicate of slow idempotent read request or not.
+ @discussion If history, presence, state, channel groups or push notifications audit request doesn't receive
+             response during \b 95th percentile of latencies observed for it's endpoint during last minute,
+             client send same request once more. First successful response delivered to completion block and
+             other request cancelled. This cut tail latency when single connection or server is slow.
+
+ @default    By default client doesn't hedge requests.
+
+ @since 4.8.2
+ */
+@property (nonatomic, assign, getter = shouldHedgeReadRequests) BOOL hedgeReadRequests NS_SWIFT_NAME(hedgeReadRequests);
+
+/**
+ @brief      Stores maximum number of hedge requests as percentage of read requests which can be hedged.
+ @discussion Limit protect \b PubNub network from load growth when all requests become slow.
+
+ @default    By default client can send duplicates for up to \b 5% of read requests.
+
+ @since 4.8.2
+ */
+@property (nonatomic, assign) NSUInteger hedgeBudgetPercentage NS_SWIFT_NAME(hedgeBudgetPercentage);
+
+/**
+ @brief      Stores whether timeout of non-subscribe requests should be calculated from observed latency or not.
+ @discussion Timeout for each request calculated as \b 99th percentile of latencies observed for it's endpoint
+             during last minute multiplied by \c adaptiveRequestTimeoutFactor and limited by
+             \c minimumRequestTimeout and \c maximumRequestTimeout. Dead connection detected faster for fast
+             endpoints while slow endpoints (like history) have enough time to respond.
+             \c nonSubscribeRequestTimeout used until there is enough latency information for endpoint.
+
+ @default    By default client use fixed \c nonSubscribeRequestTimeout for all requests.
+
+ @since 4.8.2
+ */
+@property (nonatomic, assign, getter = shouldAdaptRequestTimeout) BOOL adaptRequestTimeout NS_SWIFT_NAME(adaptRequestTimeout);
+
+/**
+ @brief  Stores multiplier which is applied to observed latency percentile to get request timeout.
+
+ @default By default client allow request to take up to \b 3 times longer than \b 99th latency percentile.
+
+ @since 4.8.2
+ */
+@property (nonatomic, assign) double adaptiveRequestTimeoutFactor NS_SWIFT_NAME(adaptiveRequestTimeoutFactor);
+
+/**
+ @brief  Stores minimum timeout which can be calculated for non-subscribe request.
+
+ @default By default request timeout can't be shorter than \b 2 seconds.
+
+ @since 4.8.2
+ */
+@property (nonatomic, assign) NSTimeInterval minimumRequestTimeout NS_SWIFT_NAME(minimumRequestTimeout);
+
+/**
+ @brief  Stores maximum timeout which can be calculated for non-subscribe request.
+
+ @default By default request timeout can't be longer than \b 30 seconds.
+
+ @since 4.8.2
+ */
+@property (nonatomic, assign) NSTimeInterval maximumRequestTimeout NS_SWIFT_NAME(maximumRequestTimeout);
+
+/**
+ @brief      Stores percentage of failed recent requests to API endpoint after which client should stop to
+             send requests to it for some time.
+ @discussion Requests outcome tracked separately for publish, history, presence, channel groups, push
+             notifications and time endpoints. Only timeout, network issues and server errors treated as
+             failures. While endpoint is degraded API calls complete right away with
+             \c PNServiceDegradedCategory status instead of waiting for request timeout. After
+             \c circuitBreakerOpenInterval single request allowed to check whether endpoint recovered.
+
+ @default    By default client doesn't stop to send requests (\b 0 disable circuit breaker).
+
+ @since 4.8.2
+ */
+@property (nonatomic, assign) NSUInteger circuitBreakerFailureRateThreshold NS_SWIFT_NAME(circuitBreakerFailureRateThreshold);
+
+/**
+ @brief  Stores minimum number of recent requests to API endpoint which is required to treat it as degraded.
+
+ @default By default client check failure rate after \b 10 requests (up to \b 20 recent requests used).
+
+ @since 4.8.2
+ */
+@property (nonatomic, assign) NSUInteger circuitBreakerMinimumRequests NS_SWIFT_NAME(circuitBreakerMinimumRequests);
+
+/**
+ @brief  Stores for how long client shouldn't send requests to degraded API endpoint.
+
+ @default By default client check whether endpoint recovered after \b 5 seconds.
+
+ @since 4.8.2
+ */
+@property (nonatomic, assign) NSTimeInterval circuitBreakerOpenInterval NS_SWIFT_NAME(circuitBreakerOpenInterval);
+
+/**
+ @brief      Stores for how long subscribe request may not receive any data before client will restart it.
+ @discussion Lost network path (for example after network interface change) or silently dropped long-poll
+             connection (for example by NAT or half-open socket) otherwise noticed only after
+             \c subscribeMaximumIdleTime. When long-poll request doesn't receive data for this interval,
+             client send lightweight probe request (with same timeout) through subscription transport. Probe
+             sent over separate connection, so it can't prove that long-poll connection is alive: if there
+             is still no data when probe completes, subscribe request restarted in same way as after
+             \c PNUnexpectedDisconnectCategory (with catch up if \c tryCatchUpOnSubscriptionRestore is set).
+             Failed probe only reported as network path loss.
+ 
+ @default    By default client doesn't check subscribe request connection (\b 0).
+ 
+ @warning    Healthy long-poll request usually doesn't receive any data till service respond to it (up to
+             \b 280 seconds when there is no real-time events), so short interval will restart idle
+             subscribe requests and send probe request each interval.
+ 
+ @note       Data received from streamed subscribe responses (\c streamSubscribeResponses) treated as read
+             activity.
+ 
+ @since 4.8.2
+ */
+@property (nonatomic, assign) NSTimeInterval subscribeWatchdogInterval NS_SWIFT_NAME(subscribeWatchdogInterval);
+
 #if TARGET_OS_IOS
 /**
  @brief  Stores whether client should try complete all API call which is done before application will be 
@@ -164,6 +164,36 @@ NS_ASSUME_NONNULL_END
         _catchUpOnSubscriptionRestore = kPNDefaultShouldTryCatchUpOnSubscriptionRestore;
         _requestMessageCountThreshold = kPNDefaultRequestMessageCountThreshold;
         _maximumMessagesCacheSize = kPNDefaultMaximumMessagesCacheSize;
+        _pipelineSubscribeRequests = kPNDefaultShouldPipelineSubscribeRequests;
+        _maximumSubscribeRequestURLLength = kPNDefaultMaximumSubscribeRequestURLLength;
+        _maximumPendingEvents = kPNDefaultMaximumPendingEvents;
+        _eventsOverflowPolicy = kPNDefaultEventsOverflowPolicy;
+        _messagesAggregationWindow = kPNDefaultMessagesAggregationWindow;
+        _retryInitialDelay = kPNDefaultRetryInitialDelay;
+        _retryMaximumDelay = kPNDefaultRetryMaximumDelay;
+        _retryBudget = kPNDefaultRetryBudget;
+        _useSharedTransport = kPNDefaultShouldUseSharedTransport;
+        _streamSubscribeResponses = kPNDefaultShouldStreamSubscribeResponses;
+        _concurrentRequestsLimits = @{@(PNPublishRequestPriority): @(kPNDefaultPublishRequestsLimit),
+                                      @(PNHeartbeatRequestPriority): @(kPNDefaultHeartbeatRequestsLimit),
+                                      @(PNStateRequestPriority): @(kPNDefaultStateRequestsLimit),
+                                      @(PNAuditRequestPriority): @(kPNDefaultAuditRequestsLimit)};
+        _responseCacheTimeToLive = @{};
+        _maximumResponseCacheSize = kPNDefaultMaximumResponseCacheSize;
+        _warmUpConnections = kPNDefaultShouldWarmUpConnections;
+        _requestRetryAttempts = @{};
+        _requestRetryBudget = kPNDefaultRequestRetryBudget;
+        _requestRetryDeadline = kPNDefaultRequestRetryDeadline;
+        _hedgeReadRequests = kPNDefaultShouldHedgeReadRequests;
+        _hedgeBudgetPercentage = kPNDefaultHedgeBudgetPercentage;
+        _adaptRequestTimeout = kPNDefaultShouldAdaptRequestTimeout;
+        _adaptiveRequestTimeoutFactor = kPNDefaultAdaptiveRequestTimeoutFactor;
+        _minimumRequestTimeout = kPNDefaultMinimumRequestTimeout;
+        _maximumRequestTimeout = kPNDefaultMaximumRequestTimeout;
+        _circuitBreakerFailureRateThreshold = kPNDefaultCircuitBreakerFailureRateThreshold;
+        _circuitBreakerMinimumRequests = kPNDefaultCircuitBreakerMinimumRequests;
+        _circuitBreakerOpenInterval = kPNDefaultCircuitBreakerOpenInterval;
+        _subscribeWatchdogInterval = kPNDefaultSubscribeWatchdogInterval;
 #if TARGET_OS_IOS
         _completeRequestsBeforeSuspension = kPNDefaultShouldCompleteRequestsBeforeSuspension;
 #endif // TARGET_OS_IOS
@@ -198,6 +228,33 @@ NS_ASSUME_NONNULL_END
     }
     configuration.requestMessageCountThreshold = self.requestMessageCountThreshold;
     configuration.maximumMessagesCacheSize = self.maximumMessagesCacheSize;
+    configuration.pipelineSubscribeRequests = self.shouldPipelineSubscribeRequests;
+    configuration.maximumSubscribeRequestURLLength = self.maximumSubscribeRequestURLLength;
+    configuration.maximumPendingEvents = self.maximumPendingEvents;
+    configuration.eventsOverflowPolicy = self.eventsOverflowPolicy;
+    configuration.messagesAggregationWindow = self.messagesAggregationWindow;
+    configuration.retryInitialDelay = self.retryInitialDelay;
+    configuration.retryMaximumDelay = self.retryMaximumDelay;
+    configuration.retryBudget = self.retryBudget;
+    configuration.useSharedTransport = self.shouldUseSharedTransport;
+    configuration.streamSubscribeResponses = self.shouldStreamSubscribeResponses;
+    configuration.concurrentRequestsLimits = self.concurrentRequestsLimits;
+    configuration.responseCacheTimeToLive = self.responseCacheTimeToLive;
+    configuration.maximumResponseCacheSize = self.maximumResponseCacheSize;
+    configuration.warmUpConnections = self.shouldWarmUpConnections;
+    configuration.requestRetryAttempts = self.requestRetryAttempts;
+    configuration.requestRetryBudget = self.requestRetryBudget;
+    configuration.requestRetryDeadline = self.requestRetryDeadline;
+    configuration.hedgeReadRequests = self.shouldHedgeReadRequests;
+    configuration.hedgeBudgetPercentage = self.hedgeBudgetPercentage;
+    configuration.adaptRequestTimeout = self.shouldAdaptRequestTimeout;
+    configuration.adaptiveRequestTimeoutFactor = self.adaptiveRequestTimeoutFactor;
+    configuration.minimumRequestTimeout = self.minimumRequestTimeout;
+    configuration.maximumRequestTimeout = self.maximumRequestTimeout;
+    configuration.circuitBreakerFailureRateThreshold = self.circuitBreakerFailureRateThreshold;
+    configuration.circuitBreakerMinimumRequests = self.circuitBreakerMinimumRequests;
+    configuration.circuitBreakerOpenInterval = self.circuitBreakerOpenInterval;
+    configuration.subscribeWatchdogInterval = self.subscribeWatchdogInterval;
 #if TARGET_OS_IOS
     configuration.completeRequestsBeforeSuspension = self.shouldCompleteRequestsBeforeSuspension;
 #endif // TARGET_OS_IOS
@@ -0,0 +1,115 @@
+/**
+ @author Sergey Mamontov
+ @since 4.8.2
+ @copyright © 2009-2017 PubNub, Inc.
+ */
+#import "PNRequestHandle.h"
+#import "PNTransport.h"
+
+
+#pragma mark Externs
+
+/**
+ @brief  Key used to mark errors of requests which has been abandoned by API caller (cancelled or
+         \c deadline passed).
+ 
+ @since 4.8.2
+ */
+extern NSString * _Nonnull const kPNRequestAbandonedErrorKey;
+
+
+NS_ASSUME_NONNULL_BEGIN
+
+#pragma mark - Private interface declaration
+
+@interface PNRequestHandle ()
+
+
+#pragma mark - Information
+
+/**
+ @brief  One of \b PNOperationType enum fields which describe type of operation for which request has been
+         sent.
+
+ @since 4.8.2
+ */
+@property (nonatomic, assign) PNOperationType operation;
+
+/**
+ @brief  Whether API call has been cancelled by user or its \c deadline already passed.
+
+ @since 4.8.2
+ */
+@property (nonatomic, readonly, assign, getter = isAbandoned) BOOL abandoned;
+
+/**
+ @brief  Stores reference on error which describe why API call has been abandoned.
+
+ @return \a NSURLErrorCancelled for cancelled API call and \a NSURLErrorTimedOut if \c deadline passed.
+         Error marked with \c kPNRequestAbandonedErrorKey.
+
+ @since 4.8.2
+ */
+@property (nonatomic, readonly, strong) NSError *abandonmentError;
+
+
+#pragma mark - Initialization and Configuration
+
+/**
+ @brief      Construct handle for scheduled request.
+ @discussion Handle doesn't retain task, so it won't extend task's life after request processing completion.
+
+ @param operation One of \b PNOperationType enum fields which describe type of operation for which request
+                  has been sent.
+ @param task      Reference on task which is used to send request.
+
+ @return Configured and ready to use handle.
+
+ @since 4.8.2
+ */
++ (instancetype)handleForOperation:(PNOperationType)operation task:(id <PNTransportTask>)task;
+
+/**
+ @brief  Construct handle for API call which should be completed within specified time.
+
+ @param timeout For how long (in seconds) API call result is expected. Handle won't have \c deadline if
+                \b 0 passed.
+
+ @return Configured and ready to use handle.
+
+ @since 4.8.2
+ */
++ (instancetype)handleWithTimeout:(NSTimeInterval)timeout;
+
+
+#pragma mark - Tasks
+
+/**
+ @brief      Store reference on task which is used to send request for API call.
+ @discussion Task cancelled right away if API call has been abandoned while task has been created.
+
+ @param task Reference on task which should be started.
+
+ @return \c NO in case if task has been cancelled and shouldn't be started.
+
+ @since 4.8.2
+ */
+- (BOOL)attachTask:(id <PNTransportTask>)task;
+
+/**
+ @brief      Store reference on block which should be called when user cancel API call.
+ @discussion Used for API calls which share request with other API calls or hedged attempts, so request task
+             can't be attached to handle. Block called right away if API call already cancelled.
+
+ @param block Reference on block which should complete API call and release request's resources.
+
+ @since 4.8.2
+ */
+- (void)setCancellationHandler:(nullable dispatch_block_t)block;
+
+#pragma mark -
+
+
+@end
+
+NS_ASSUME_NONNULL_END
@@ -0,0 +1,76 @@
+#import <Foundation/Foundation.h>
+#import "PNStructures.h"
+
+
+NS_ASSUME_NONNULL_BEGIN
+
+/**
+ @brief      Class which represent API call scheduled by client.
+ @discussion Handle allow to cancel particular API call at any stage of its processing (before request
+             sending, while response is loading or parsing) and allow to limit time during which API call
+             result is expected (\c deadline). Abandoned API call complete with \b PNCancelledCategory or
+             \b PNTimeoutCategory status and won't be retried.
+
+ @author Sergey Mamontov
+ @since 4.8.2
+ @copyright © 2009-2017 PubNub, Inc.
+ */
+@interface PNRequestHandle : NSObject
+
+
+///------------------------------------------------
+/// @name Information
+///------------------------------------------------
+
+/**
+ @brief  One of \b PNOperationType enum fields which describe type of operation for which request has been
+         sent.
+
+ @since 4.8.2
+ */
+@property (nonatomic, readonly, assign) PNOperationType operation;
+
+/**
+ @brief  Stores reference on date after which API call result won't be delivered (API call will complete
+         with \b PNTimeoutCategory status).
+
+ @since 4.8.2
+ */
+@property (nonatomic, nullable, readonly, strong) NSDate *deadline;
+
+/**
+ @brief  Whether API call's \c deadline already passed or not.
+
+ @since 4.8.2
+ */
+@property (nonatomic, readonly, assign, getter = isExpired) BOOL expired;
+
+/**
+ @brief  Whether request cancellation has been requested through handle or not.
+
+ @since 4.8.2
+ */
+@property (nonatomic, readonly, assign, getter = isCancelled) BOOL cancelled;
+
+
+///------------------------------------------------
+/// @name Cancellation
+///------------------------------------------------
+
+/**
+ @brief      Cancel request processing.
+ @discussion Operation's completion block will be called with \b PNCancelledCategory status. Call has no
+             effect if request processing already completed.
+             If request without \c deadline is shared with identical API calls, it will be cancelled only
+             when all of them will be cancelled.
+
+ @since 4.8.2
+ */
+- (void)cancel;
+
+#pragma mark -
+
+
+@end
+
+NS_ASSUME_NONNULL_END
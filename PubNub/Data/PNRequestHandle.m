@@ -0,0 +1,193 @@
+/**
+ @author Sergey Mamontov
+ @since 4.8.2
+ @copyright © 2009-2017 PubNub, Inc.
+ */
+#import "PNRequestHandle+Private.h"
+#import "PNLockSupport.h"
+
+
+#pragma mark Externs
+
+NSString * const kPNRequestAbandonedErrorKey = @"PNRequestAbandonedErrorKey";
+
+
+NS_ASSUME_NONNULL_BEGIN
+
+#pragma mark - Protected interface declaration
+
+@interface PNRequestHandle ()
+
+
+#pragma mark - Information
+
+@property (nonatomic, nullable, strong) NSDate *deadline;
+@property (nonatomic, assign, getter = isCancelled) BOOL cancelled;
+
+/**
+ @brief  Stores reference on task which is used to send request.
+
+ @since 4.8.2
+ */
+@property (nonatomic, nullable, weak) id <PNTransportTask> task;
+
+/**
+ @brief  Stores reference on block which should be called when user cancel API call.
+
+ @since 4.8.2
+ */
+@property (nonatomic, nullable, copy) dispatch_block_t cancellationHandler;
+
+/**
+ @brief  Stores reference on lock which is used to protect task and cancellation state.
+
+ @since 4.8.2
+ */
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wpartial-availability"
+@property (nonatomic, assign) os_unfair_lock lock;
+#pragma clang diagnostic pop
+
+
+#pragma mark - Initialization and Configuration
+
+/**
+ @brief  Initialize handle for scheduled request.
+
+ @param operation One of \b PNOperationType enum fields which describe type of operation for which request
+                  has been sent.
+ @param task      Reference on task which is used to send request.
+ @param deadline  Reference on date after which API call result won't be delivered.
+
+ @return Initialized and ready to use handle.
+
+ @since 4.8.2
+ */
+- (instancetype)initForOperation:(PNOperationType)operation task:(nullable id <PNTransportTask>)task
+                        deadline:(nullable NSDate *)deadline;
+
+#pragma mark -
+
+
+@end
+
+NS_ASSUME_NONNULL_END
+
+
+#pragma mark - Interface implementation
+
+@implementation PNRequestHandle
+
+
+#pragma mark - Information
+
+- (BOOL)isExpired {
+
+    return (self.deadline && [self.deadline timeIntervalSinceNow] <= 0.f);
+}
+
+- (BOOL)isCancelled {
+
+    __block BOOL cancelled = NO;
+    pn_lock(&_lock, ^{ cancelled = self->_cancelled; });
+
+    return cancelled;
+}
+
+- (BOOL)isAbandoned {
+
+    return (self.isCancelled || self.isExpired);
+}
+
+- (NSError *)abandonmentError {
+
+    NSInteger code = (self.isCancelled ? NSURLErrorCancelled : NSURLErrorTimedOut);
+
+    return [NSError errorWithDomain:NSURLErrorDomain code:code userInfo:@{kPNRequestAbandonedErrorKey: @YES}];
+}
+
+
+#pragma mark - Initialization and Configuration
+
++ (instancetype)handleForOperation:(PNOperationType)operation task:(id <PNTransportTask>)task {
+
+    return [[self alloc] initForOperation:operation task:task deadline:nil];
+}
+
++ (instancetype)handleWithTimeout:(NSTimeInterval)timeout {
+
+    NSDate *deadline = (timeout > 0.f ? [NSDate dateWithTimeIntervalSinceNow:timeout] : nil);
+
+    return [[self alloc] initForOperation:PNTimeOperation task:nil deadline:deadline];
+}
+
+- (instancetype)initForOperation:(PNOperationType)operation task:(id <PNTransportTask>)task
+                        deadline:(NSDate *)deadline {
+
+    // Check whether initialization was successful or not.
+    if ((self = [super init])) {
+
+        _operation = operation;
+        _task = task;
+        _deadline = deadline;
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wpartial-availability"
+        _lock = OS_UNFAIR_LOCK_INIT;
+#pragma clang diagnostic pop
+    }
+
+    return self;
+}
+
+
+#pragma mark - Tasks
+
+- (BOOL)attachTask:(id <PNTransportTask>)task {
+
+    __block BOOL attached = NO;
+    pn_lock(&_lock, ^{
+
+        attached = !self->_cancelled;
+        if (attached) { self->_task = task; }
+    });
+
+    if (!attached) { [task cancel]; }
+
+    return attached;
+}
+
+- (void)setCancellationHandler:(dispatch_block_t)block {
+
+    __block BOOL cancelled = NO;
+    pn_lock(&_lock, ^{
+
+        cancelled = self->_cancelled;
+        if (!cancelled) { self->_cancellationHandler = [block copy]; }
+    });
+
+    if (cancelled && block) { block(); }
+}
+
+
+#pragma mark - Cancellation
+
+- (void)cancel {
+
+    __block id <PNTransportTask> task = nil;
+    __block dispatch_block_t cancellationHandler = nil;
+    pn_lock(&_lock, ^{
+
+        self->_cancelled = YES;
+        task = self->_task;
+        cancellationHandler = self->_cancellationHandler;
+        self->_cancellationHandler = nil;
+    });
+
+    [task cancel];
+    if (cancellationHandler) { cancellationHandler(); }
+}
+
+#pragma mark -
+
+
+@end
@@ -5,6 +5,7 @@
  */
 #import "PNResult.h"
 #import "PNStructures.h"
+#import "PNTransport.h"
 
 
 NS_ASSUME_NONNULL_BEGIN
@@ -59,7 +60,7 @@ NS_ASSUME_NONNULL_BEGIN
  @since 4.0
  */
 + (instancetype)objectForOperation:(PNOperationType)operation
-                 completedWithTask:(nullable NSURLSessionDataTask *)task
+                 completedWithTask:(nullable id <PNTransportTask>)task
                      processedData:(nullable NSDictionary<NSString *, id> *)processedData
                    processingError:(nullable NSError *)error;
 
@@ -77,7 +78,7 @@ NS_ASSUME_NONNULL_BEGIN
  @since 4.0
  */
 - (instancetype)initForOperation:(PNOperationType)operation
-               completedWithTask:(nullable NSURLSessionDataTask *)task
+               completedWithTask:(nullable id <PNTransportTask>)task
                    processedData:(nullable NSDictionary<NSString *, id> *)processedData
                  processingError:(nullable NSError *)error;
 
@@ -93,6 +94,22 @@ NS_ASSUME_NONNULL_BEGIN
  */
 - (instancetype)copyWithMutatedData:(nullable id)data;
 
+/**
+ @brief      Construct lightweight result instance for single real-time event.
+ @discussion Request and response information (status code, operation, TLS, UUID, auth key, origin and client
+             request) won't be copied. Instead, constructed instance will read it from \c result by reference,
+             so single response information can be shared by all events which has been received with it.
+             Passed \c data should be dictionary and it will be stored as-is.
+ 
+ @param data   Reference on pre-processed event data which should be stored within new instance.
+ @param result Reference on result object which has been created for service response with event.
+ 
+ @return Constructed and ready to use result instance.
+ 
+ @since 4.8.2
+ */
++ (instancetype)objectWithServiceData:(NSDictionary<NSString *, id> *)data sharingMetadataWith:(PNResult *)result;
+
 /**
  @brief  Update data stored for result object.
  
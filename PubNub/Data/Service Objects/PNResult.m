@@ -28,6 +28,13 @@ NS_ASSUME_NONNULL_BEGIN
 @property (nonatomic, nullable, copy) NSURLRequest *clientRequest;
 @property (nonatomic, nullable, copy) NSDictionary<NSString *, id> *serviceData;
 
+/**
+ @brief  Stores reference on result object from which request and response information should be read.
+ 
+ @since 4.8.2
+ */
+@property (nonatomic, nullable, strong) PNResult *metadata;
+
 
 #pragma mark - Misc
 
@@ -68,6 +75,41 @@ NS_ASSUME_NONNULL_END
 
 #pragma mark - Information
 
+- (NSInteger)statusCode {
+    
+    return (_metadata ? _metadata.statusCode : _statusCode);
+}
+
+- (PNOperationType)operation {
+    
+    return (_metadata ? _metadata.operation : _operation);
+}
+
+- (BOOL)isTLSEnabled {
+    
+    return (_metadata ? _metadata.isTLSEnabled : _TLSEnabled);
+}
+
+- (NSString *)uuid {
+    
+    return (_metadata ? _metadata.uuid : _uuid);
+}
+
+- (NSString *)authKey {
+    
+    return (_metadata ? _metadata.authKey : _authKey);
+}
+
+- (NSString *)origin {
+    
+    return (_metadata ? _metadata.origin : _origin);
+}
+
+- (NSURLRequest *)clientRequest {
+    
+    return (_metadata ? _metadata.clientRequest : _clientRequest);
+}
+
 - (NSString *)stringifiedOperation {
     
     return (self.operation >= PNSubscribeOperation ? PNOperationTypeStrings[self.operation] : @"Unknown");
@@ -76,7 +118,7 @@ NS_ASSUME_NONNULL_END
 
 #pragma mark - Initialization and Configuration
 
-+ (instancetype)objectForOperation:(PNOperationType)operation completedWithTask:(NSURLSessionDataTask *)task
++ (instancetype)objectForOperation:(PNOperationType)operation completedWithTask:(id <PNTransportTask>)task
                      processedData:(NSDictionary<NSString *, id> *)processedData 
                    processingError:(NSError *)error {
     
@@ -84,7 +126,7 @@ NS_ASSUME_NONNULL_END
                             processedData:processedData processingError:error];
 }
 
-- (instancetype)initForOperation:(PNOperationType)operation completedWithTask:(NSURLSessionDataTask *)task
+- (instancetype)initForOperation:(PNOperationType)operation completedWithTask:(id <PNTransportTask>)task
                    processedData:(NSDictionary<NSString *, id> *)processedData 
                  processingError:(NSError *)__unused error {
     
@@ -114,6 +156,15 @@ NS_ASSUME_NONNULL_END
     return self;
 }
 
++ (instancetype)objectWithServiceData:(NSDictionary<NSString *, id> *)data sharingMetadataWith:(PNResult *)result {
+    
+    PNResult *object = [self new];
+    object->_metadata = (result.metadata ?: result);
+    object->_serviceData = data;
+    
+    return object;
+}
+
 - (id)copyWithZone:(NSZone *)zone {
     
     return [self copyWithServiceData:YES];
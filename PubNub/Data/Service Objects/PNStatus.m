@@ -45,7 +45,7 @@
  
  @since 4.0
  */
-- (instancetype)initForOperation:(PNOperationType)operation completedWithTask:(NSURLSessionDataTask *)task
+- (instancetype)initForOperation:(PNOperationType)operation completedWithTask:(id <PNTransportTask>)task
                    processedData:(NSDictionary<NSString *, id> *)processedData 
                  processingError:(NSError *)error;
 
@@ -147,7 +147,7 @@
     return self;
 }
 
-- (instancetype)initForOperation:(PNOperationType)operation completedWithTask:(NSURLSessionDataTask *)task
+- (instancetype)initForOperation:(PNOperationType)operation completedWithTask:(id <PNTransportTask>)task
                    processedData:(NSDictionary<NSString *, id> *)processedData 
                  processingError:(NSError *)error {
     
@@ -4,7 +4,9 @@
 NS_ASSUME_NONNULL_BEGIN
 
 /**
- @brief  Useful methods collection to work with data compression/uncompression.
+ @brief      Useful methods collection to work with data compression/uncompression.
+ @discussion Instance can be used as streaming inflater for data which arrive in chunks: GZIP stream detected
+             by it's magic number (\c 1f8b) and any other data passed through as-is.
  
  @author Sergey Mamontov
  @since 4.0
@@ -28,6 +30,92 @@ NS_ASSUME_NONNULL_BEGIN
  */
 + (nullable NSData *)GZIPDeflatedData:(NSData *)data;
 
+
+///------------------------------------------------
+/// @name Uncompression
+///------------------------------------------------
+
+/**
+ @brief  Check whether passed \c data starts with GZIP magic number.
+ 
+ @param data Data which should be checked.
+ 
+ @return \c YES in case if \c data is GZIP stream.
+ 
+ @since 4.8.2
+ */
++ (BOOL)isGZIPCompressedData:(NSData *)data;
+
+/**
+ @brief  Allow to uncompress passed \c data.
+ 
+ @param data Data which has been compressed with GZIP deflate algorithm.
+ 
+ @return Uncompressed \a NSData instance or \c nil in case if \c data isn't complete GZIP stream.
+ 
+ @since 4.8.2
+ */
++ (nullable NSData *)GZIPInflatedData:(NSData *)data;
+
+
+///------------------------------------------------
+/// @name Streaming uncompression
+///------------------------------------------------
+
+/**
+ @brief  Whether inflater received GZIP stream or not.
+ @note   Value is valid only after first two bytes has been passed to inflater.
+ 
+ @since 4.8.2
+ */
+@property (nonatomic, readonly, assign, getter = isCompressed) BOOL compressed;
+
+/**
+ @brief  Number of compressed bytes which has been passed to inflater.
+ 
+ @since 4.8.2
+ */
+@property (nonatomic, readonly, assign) NSUInteger compressedLength;
+
+/**
+ @brief  Number of bytes which has been produced by inflater from compressed data.
+ 
+ @since 4.8.2
+ */
+@property (nonatomic, readonly, assign) NSUInteger inflatedLength;
+
+/**
+ @brief  Construct streaming inflater.
+ 
+ @return Configured and ready to use inflater.
+ 
+ @since 4.8.2
+ */
++ (instancetype)inflater;
+
+/**
+ @brief      Uncompress next chunk of data.
+ @discussion Chunk passed as-is if stream isn't compressed. Data may be kept by inflater till it will be
+             able to detect whether stream is compressed or not.
+ 
+ @param data Next chunk of received data.
+ 
+ @return Uncompressed data (may be empty) or \c nil in case if uncompression error occurred.
+ 
+ @since 4.8.2
+ */
+- (nullable NSData *)inflateData:(NSData *)data;
+
+/**
+ @brief  Complete data stream processing.
+ 
+ @return Data which has been kept by inflater (may be empty) or \c nil in case if uncompression error
+         occurred or GZIP stream is incomplete.
+ 
+ @since 4.8.2
+ */
+- (nullable NSData *)finish;
+
 #pragma mark -
 
 
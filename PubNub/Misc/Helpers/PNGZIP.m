@@ -7,7 +7,83 @@
 #import <zlib.h>
 
 
-#pragma mark Interface implementation
+#pragma mark Static
+
+/**
+ @brief  Size of chunk by which inflated data storage grows.
+ 
+ @since 4.8.2
+ */
+static NSUInteger const kPNGZIPInflateChunkSize = 16384;
+
+
+NS_ASSUME_NONNULL_BEGIN
+
+#pragma mark - Private interface declaration
+
+@interface PNGZIP ()
+
+
+#pragma mark - Information
+
+@property (nonatomic, assign, getter = isCompressed) BOOL compressed;
+@property (nonatomic, assign) NSUInteger compressedLength;
+@property (nonatomic, assign) NSUInteger inflatedLength;
+
+/**
+ @brief  Stores reference on data which has been received before stream type has been detected.
+ 
+ @since 4.8.2
+ */
+@property (nonatomic, nullable, strong) NSMutableData *pendingData;
+
+/**
+ @brief  Stores reference on zlib stream which is used to uncompress received data.
+ 
+ @since 4.8.2
+ */
+@property (nonatomic, assign) z_stream stream;
+
+/**
+ @brief  Whether zlib stream has been initialized and should be released.
+ 
+ @since 4.8.2
+ */
+@property (nonatomic, assign, getter = isStreamActive) BOOL streamActive;
+
+/**
+ @brief  Whether end of GZIP stream has been reached.
+ 
+ @since 4.8.2
+ */
+@property (nonatomic, assign, getter = isCompleted) BOOL completed;
+
+/**
+ @brief  Whether uncompression error occurred.
+ 
+ @since 4.8.2
+ */
+@property (nonatomic, assign, getter = isFailed) BOOL failed;
+
+
+#pragma mark - Misc
+
+/**
+ @brief  Release zlib stream resources.
+ 
+ @since 4.8.2
+ */
+- (void)endStream;
+
+#pragma mark -
+
+
+@end
+
+NS_ASSUME_NONNULL_END
+
+
+#pragma mark - Interface implementation
 
 @implementation PNGZIP
 
@@ -67,6 +143,141 @@
 }
 
 
+#pragma mark - Uncompression
+
++ (BOOL)isGZIPCompressedData:(NSData *)data {
+    
+    const uint8_t *bytes = data.bytes;
+    
+    return (data.length >= 2 && bytes[0] == 0x1f && bytes[1] == 0x8b);
+}
+
++ (NSData *)GZIPInflatedData:(NSData *)data {
+    
+    if (![self isGZIPCompressedData:data]) { return nil; }
+    
+    PNGZIP *inflater = [self inflater];
+    NSMutableData *inflatedData = [[inflater inflateData:data] mutableCopy];
+    NSData *tail = [inflater finish];
+    if (!inflatedData || !tail) { return nil; }
+    [inflatedData appendData:tail];
+    
+    return inflatedData;
+}
+
+
+#pragma mark - Streaming uncompression
+
++ (instancetype)inflater {
+    
+    return [self new];
+}
+
+- (instancetype)init {
+    
+    // Check whether initialization was successful or not.
+    if ((self = [super init])) {
+        
+        _pendingData = [NSMutableData new];
+    }
+    
+    return self;
+}
+
+- (NSData *)inflateData:(NSData *)data {
+    
+    if (self.isFailed) { return nil; }
+    if (self.pendingData) {
+        
+        // Wait for magic number to decide whether stream should be uncompressed or not.
+        [self.pendingData appendData:data];
+        if (self.pendingData.length < 2) { return [NSData data]; }
+        
+        data = self.pendingData;
+        self.pendingData = nil;
+        self.compressed = [PNGZIP isGZIPCompressedData:data];
+        if (self.isCompressed) {
+            
+            bzero(&_stream, sizeof(_stream));
+            self.failed = (inflateInit2(&_stream, 31) != Z_OK);
+            self.streamActive = !self.isFailed;
+            if (self.isFailed) { return nil; }
+        }
+    }
+    
+    // Uncompressed stream passed as-is and data which follow completed GZIP stream ignored.
+    if (!self.isCompressed) { return data; }
+    if (self.isCompleted) { return [NSData data]; }
+    
+    NSMutableData *inflatedData = [NSMutableData dataWithLength:kPNGZIPInflateChunkSize];
+    NSUInteger inflatedLength = 0;
+    int status = Z_OK;
+    _stream.next_in = (Bytef *)data.bytes;
+    _stream.avail_in = (uInt)data.length;
+    self.compressedLength += data.length;
+    do {
+        
+        if (inflatedLength == inflatedData.length) { [inflatedData increaseLengthBy:kPNGZIPInflateChunkSize]; }
+        _stream.next_out = (Bytef *)inflatedData.mutableBytes + inflatedLength;
+        _stream.avail_out = (uInt)(inflatedData.length - inflatedLength);
+        status = inflate(&_stream, Z_NO_FLUSH);
+        inflatedLength = inflatedData.length - _stream.avail_out;
+    } while (status == Z_OK && (_stream.avail_in > 0 || _stream.avail_out == 0));
+    
+    if (status == Z_STREAM_END) {
+        
+        self.compressedLength -= _stream.avail_in;
+        self.completed = YES;
+        [self endStream];
+    }
+    else if (status != Z_OK && status != Z_BUF_ERROR) {
+        
+        self.failed = YES;
+        [self endStream];
+        
+        return nil;
+    }
+    inflatedData.length = inflatedLength;
+    self.inflatedLength += inflatedLength;
+    
+    return inflatedData;
+}
+
+- (NSData *)finish {
+    
+    NSData *data = [NSData data];
+    if (self.pendingData) {
+        
+        data = [self.pendingData copy];
+        self.pendingData = nil;
+    }
+    else if (self.isCompressed && !self.isCompleted) {
+        
+        self.failed = YES;
+        [self endStream];
+    }
+    
+    return (!self.isFailed ? data : nil);
+}
+
+
+#pragma mark - Misc
+
+- (void)endStream {
+    
+    if (self.isStreamActive) {
+        
+        inflateEnd(&_stream);
+        self.streamActive = NO;
+    }
+}
+
+- (void)dealloc {
+    
+    [self endStream];
+}
+
+
 #pragma mark -
 
 
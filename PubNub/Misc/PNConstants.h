@@ -54,9 +54,65 @@ static BOOL const kPNDefaultShouldKeepTimeTokenOnListChange = YES;
 static BOOL const kPNDefaultShouldTryCatchUpOnSubscriptionRestore = YES;
 static BOOL const kPNDefaultRequestMessageCountThreshold = 0;
 static NSUInteger const kPNDefaultMaximumMessagesCacheSize = 100;
+static BOOL const kPNDefaultShouldPipelineSubscribeRequests = NO;
+static NSUInteger const kPNDefaultMaximumSubscribeRequestURLLength = 0;
+static NSUInteger const kPNDefaultMaximumPendingEvents = 0;
+static PNEventsOverflowPolicy const kPNDefaultEventsOverflowPolicy = PNEventsOverflowBlockPolicy;
+static NSTimeInterval const kPNDefaultMessagesAggregationWindow = 0.0f;
+static NSTimeInterval const kPNDefaultRetryInitialDelay = 1.0f;
+static NSTimeInterval const kPNDefaultRetryMaximumDelay = 32.0f;
+static NSUInteger const kPNDefaultRetryBudget = 0;
+static BOOL const kPNDefaultShouldUseSharedTransport = NO;
+static BOOL const kPNDefaultShouldStreamSubscribeResponses = NO;
+static NSUInteger const kPNDefaultPublishRequestsLimit = 3;
+static NSUInteger const kPNDefaultHeartbeatRequestsLimit = 1;
+static NSUInteger const kPNDefaultStateRequestsLimit = 2;
+static NSUInteger const kPNDefaultAuditRequestsLimit = 2;
+static NSUInteger const kPNDefaultMaximumResponseCacheSize = 100;
+static BOOL const kPNDefaultShouldWarmUpConnections = NO;
+static NSUInteger const kPNDefaultRequestRetryBudget = 10;
+static NSTimeInterval const kPNDefaultRequestRetryDeadline = 30.0f;
+static BOOL const kPNDefaultShouldHedgeReadRequests = NO;
+static NSUInteger const kPNDefaultHedgeBudgetPercentage = 5;
+static BOOL const kPNDefaultShouldAdaptRequestTimeout = NO;
+static double const kPNDefaultAdaptiveRequestTimeoutFactor = 3.0f;
+static NSTimeInterval const kPNDefaultMinimumRequestTimeout = 2.0f;
+static NSTimeInterval const kPNDefaultMaximumRequestTimeout = 30.0f;
+static NSUInteger const kPNDefaultCircuitBreakerFailureRateThreshold = 0;
+static NSUInteger const kPNDefaultCircuitBreakerMinimumRequests = 10;
+static NSTimeInterval const kPNDefaultCircuitBreakerOpenInterval = 5.0f;
+static NSTimeInterval const kPNDefaultSubscribeWatchdogInterval = 0.0f;
 #if TARGET_OS_IOS
 static BOOL const kPNDefaultShouldCompleteRequestsBeforeSuspension = YES;
 #endif // TARGET_OS_IOS
 static BOOL const kPNDefaultShouldStripMobilePayload = YES;
 
+
+#pragma mark - Subscription constants
+
+/**
+ @brief  Maximum number of concurrent long-poll requests which can be used to subscribe on channels and groups
+         which doesn't fit into single subscribe request.
+ */
+static NSUInteger const kPNMaximumSubscribeShardsCount = 8;
+
+/**
+ @brief  Maximum size of single real-time event (in bytes) which can be buffered by incremental subscribe
+         response parser.
+ */
+static NSUInteger const kPNMaximumStreamedEventSize = 1024 * 1024;
+
+
+#pragma mark - Request retry constants
+
+/**
+ @brief  Minimum delay before automatic non-subscribe request retry attempt.
+ */
+static NSTimeInterval const kPNRequestRetryInitialDelay = 0.5f;
+
+/**
+ @brief  Maximum delay before automatic non-subscribe request retry attempt.
+ */
+static NSTimeInterval const kPNRequestRetryMaximumDelay = 5.0f;
+
 #endif // PNConstants_h
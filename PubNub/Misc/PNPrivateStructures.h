@@ -95,7 +95,7 @@ static NSString * const PNOperationStatusClasses[24] = {
 
  @since 4.0
  */
-static NSString * const PNStatusCategoryStrings[18] = {
+static NSString * const PNStatusCategoryStrings[19] = {
     [PNUnknownCategory] = @"Unknown",
     [PNAcknowledgmentCategory] = @"Acknowledgment",
     [PNAccessDeniedCategory] = @"Access Denied",
@@ -113,7 +113,8 @@ static NSString * const PNStatusCategoryStrings[18] = {
     [PNMalformedResponseCategory] = @"Malformed Response",
     [PNDecryptionErrorCategory] = @"Decryption Error",
     [PNTLSConnectionFailedCategory] = @"TLS Connection Failed",
-    [PNTLSUntrustedCertificateCategory] = @"Untrusted TLS Certificate"
+    [PNTLSUntrustedCertificateCategory] = @"Untrusted TLS Certificate",
+    [PNServiceDegradedCategory] = @"Service Degraded"
 };
 
 /**
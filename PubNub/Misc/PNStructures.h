@@ -311,6 +311,61 @@ typedef NS_OPTIONS(NSUInteger, PNHeartbeatNotificationOptions) {
 };
 
 
+/**
+ @brief  Possible ways to handle real-time events when listeners can't keep up with their delivery.
+ 
+ @since 4.8.2
+ */
+typedef NS_ENUM(NSInteger, PNEventsOverflowPolicy) {
+    
+    /**
+     @brief  Client will hold next subscribe request till listeners will process pending events.
+     */
+    PNEventsOverflowBlockPolicy,
+    
+    /**
+     @brief  Client will drop oldest pending message or presence event to free space for new one.
+     */
+    PNEventsOverflowDropOldestPolicy,
+    
+    /**
+     @brief  Client will replace pending event from same channel with new one (listeners will receive only
+             latest event for channel). If there is no pending events from same channel, oldest event will be
+             dropped.
+     */
+    PNEventsOverflowCoalescePolicy
+};
+
+/**
+ @brief      Priority classes which is used to schedule non-subscribe requests.
+ @discussion Requests from class with higher priority sent first when there is free connection.
+ 
+ @since 4.8.2
+ */
+typedef NS_ENUM(NSInteger, PNRequestPriority) {
+    
+    /**
+     @brief  Message publish requests.
+     */
+    PNPublishRequestPriority,
+    
+    /**
+     @brief  Presence heartbeat and leave requests.
+     */
+    PNHeartbeatRequestPriority,
+    
+    /**
+     @brief  Client state, channel groups, push notifications and messages modification requests.
+     */
+    PNStateRequestPriority,
+    
+    /**
+     @brief  History, presence and channel groups audit requests.
+     */
+    PNAuditRequestPriority
+};
+
+
 /**
  @brief  \b PubNub client logging levels available for manipulations.
  
@@ -614,7 +669,16 @@ typedef NS_ENUM(NSInteger, PNStatusCategory) {
                  "nslookup pubsub.pubnub.com" status object debug description and mail to
                  support@pubnub.com
     */
-    PNTLSUntrustedCertificateCategory
+    PNTLSUntrustedCertificateCategory,
+
+    /**
+     @brief      Status is sent in case if request hasn't been sent because API endpoint is degraded.
+     @discussion Client stop to send requests to endpoint for some time after too many of them failed
+                 with timeout, network issues or server error. Request can be retried later.
+
+     @since 4.8.2
+     */
+    PNServiceDegradedCategory
 };
 
 /**
@@ -27,8 +27,10 @@ NS_ASSUME_NONNULL_BEGIN
 ///------------------------------------------------
 
 /**
- @brief  Notify listener about new message which arrived from one of remote data object's live feed
-         on which client subscribed at this moment.
+ @brief   Notify listener about new message which arrived from one of remote data object's live feed
+          on which client subscribed at this moment.
+ @warning Method won't be called if listener also implement \c -client:didReceiveMessages: (since 4.8.2).
+          Same messages will be delivered to it in batches instead.
  
  @param client  Reference on \b PubNub client which triggered this callback method call.
  @param message Reference on \b PNResult instance which store message information in \c data 
@@ -38,6 +40,22 @@ NS_ASSUME_NONNULL_BEGIN
  */
 - (void)client:(PubNub *)client didReceiveMessage:(PNMessageResult *)message;
 
+/**
+ @brief      Notify listener about batch of new messages which arrived from remote data objects' live feed
+             on which client subscribed at this moment.
+ @discussion Batch contain all messages from single subscribe response (or from multiple consecutive
+             responses if \c messagesAggregationWindow is set in client configuration).
+ @warning    Listener which implement this method won't receive \c -client:didReceiveMessage: calls, so
+             each message delivered to it only once.
+ 
+ @param client   Reference on \b PubNub client which triggered this callback method call.
+ @param messages List of \b PNResult instances which store message information in \c data property. Messages
+                 ordered in same way as they has been received.
+ 
+ @since 4.8.2
+ */
+- (void)client:(PubNub *)client didReceiveMessages:(NSArray<PNMessageResult *> *)messages;
+
 /**
  @brief  Notify listener about new presence events which arrived from one of remote data object's 
          presence live feed on which client subscribed at this moment.
@@ -0,0 +1,206 @@
+#import <Foundation/Foundation.h>
+
+
+#pragma mark Types
+
+/**
+ @brief  Definition for block which is called by transport when request processing has been completed.
+ 
+ @param data     Reference on data which has been received in response on request.
+ @param response Reference on HTTP response which has been received from remote service.
+ @param error    Reference on request processing error (if any).
+ 
+ @since 4.8.2
+ */
+typedef void(^PNTransportTaskCompletion)(NSData * _Nullable data, NSURLResponse * _Nullable response,
+                                         NSError * _Nullable error);
+
+/**
+ @brief  Definition for block which is called by transport each time when new portion of response body has
+         been received.
+ 
+ @param data Reference on received portion of response body.
+ 
+ @since 4.8.2
+ */
+typedef void(^PNTransportTaskDataHandler)(NSData * _Nonnull data);
+
+
+NS_ASSUME_NONNULL_BEGIN
+
+/**
+ @brief      Interface declaration for single request which has been scheduled with transport.
+ @discussion \c NSURLSessionDataTask conform to this protocol, so tasks created by \c NSURLSession can be
+             returned by transport as-is.
+ 
+ @author Sergey Mamontov
+ @since 4.8.2
+ @copyright © 2009-2017 PubNub, Inc.
+ */
+@protocol PNTransportTask <NSObject>
+
+
+@required
+
+///------------------------------------------------
+/// @name Information
+///------------------------------------------------
+
+/**
+ @brief  Unique task identifier within transport which created it.
+ 
+ @since 4.8.2
+ */
+@property (readonly) NSUInteger taskIdentifier;
+
+/**
+ @brief  Reference on request which has been used to create task.
+ 
+ @since 4.8.2
+ */
+@property (nullable, readonly, copy) NSURLRequest *originalRequest;
+
+/**
+ @brief  Reference on request which is processed by task at this moment.
+ 
+ @since 4.8.2
+ */
+@property (nullable, readonly, copy) NSURLRequest *currentRequest;
+
+/**
+ @brief  Reference on response which has been received for request (\c nil till response will be received).
+ 
+ @since 4.8.2
+ */
+@property (nullable, readonly, copy) NSURLResponse *response;
+
+/**
+ @brief  Reference on error which has been reported during request processing.
+ 
+ @since 4.8.2
+ */
+@property (nullable, readonly, copy) NSError *error;
+
+
+///------------------------------------------------
+/// @name Processing
+///------------------------------------------------
+
+/**
+ @brief  Start request processing.
+ 
+ @since 4.8.2
+ */
+- (void)resume;
+
+/**
+ @brief      Cancel request processing.
+ @discussion Task completion block will be called with \c NSURLErrorCancelled error.
+ 
+ @since 4.8.2
+ */
+- (void)cancel;
+
+#pragma mark -
+
+
+@end
+
+
+/**
+ @brief      Interface declaration for classes which is able to deliver requests to \b PubNub network and
+             receive responses.
+ @discussion \b PNNetwork use transport to send prepared requests, so it is possible to replace HTTP stack
+             without changes in operations processing and response parsing.
+ 
+ @author Sergey Mamontov
+ @since 4.8.2
+ @copyright © 2009-2017 PubNub, Inc.
+ */
+@protocol PNTransport <NSObject>
+
+
+@required
+
+///------------------------------------------------
+/// @name Request processing
+///------------------------------------------------
+
+/**
+ @brief  Update request with transport-wide options (like cache policy or additional HTTP headers).
+ 
+ @param request Reference on request which is going to be passed to \c -taskWithRequest:completion:.
+ 
+ @since 4.8.2
+ */
+- (void)prepareRequest:(NSMutableURLRequest *)request;
+
+/**
+ @brief      Create task which will process passed \c request.
+ @discussion Task processing won't start till \c -resume will be called on it.
+ 
+ @param request Reference on request which should be sent.
+ @param block   Reference on block which should be called when request processing will be completed. If
+                \c nil is passed, transport will report request processing progress only to it's delegate (if
+                transport support this).
+ 
+ @return Task which will process request.
+ 
+ @since 4.8.2
+ */
+- (id <PNTransportTask>)taskWithRequest:(NSURLRequest *)request
+                             completion:(nullable PNTransportTaskCompletion)block;
+
+/**
+ @brief  Retrieve list of tasks which has been created by transport and not completed yet.
+ 
+ @param block Reference on block which will be called with list of active tasks.
+ 
+ @since 4.8.2
+ */
+- (void)getTasksWithCompletion:(void(^)(NSArray<id <PNTransportTask>> *tasks))block;
+
+/**
+ @brief      Invalidate transport.
+ @discussion All active tasks will be cancelled and transport can't be used to send requests after this call.
+ 
+ @since 4.8.2
+ */
+- (void)invalidate;
+
+
+@optional
+
+/**
+ @brief      Create task which will report response body in portions as they arrive.
+ @discussion Response body won't be accumulated by transport, so \c block will be called with \c nil data
+             when request processing will be completed.
+ 
+ @param request     Reference on request which should be sent.
+ @param dataHandler Reference on block which should be called with each received portion of response body.
+ @param block       Reference on block which should be called when request processing will be completed.
+ 
+ @return Task which will process request.
+ 
+ @since 4.8.2
+ */
+- (id <PNTransportTask>)taskWithRequest:(NSURLRequest *)request dataHandler:(PNTransportTaskDataHandler)dataHandler
+                             completion:(PNTransportTaskCompletion)block;
+
+#pragma mark -
+
+
+@end
+
+
+#pragma mark - Category interface declaration
+
+/**
+ @brief  \c NSURLSession data task already provide \b PNTransportTask interface.
+ 
+ @since 4.8.2
+ */
+@interface NSURLSessionDataTask (PNTransportTask) <PNTransportTask>
+@end
+
+NS_ASSUME_NONNULL_END
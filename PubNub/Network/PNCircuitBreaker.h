@@ -0,0 +1,96 @@
+#import <Foundation/Foundation.h>
+
+
+NS_ASSUME_NONNULL_BEGIN
+
+/**
+ @brief      Class which is used to stop requests to degraded API endpoints.
+ @discussion Breaker track outcome of recent requests for each endpoint family. Circuit opens when share of
+             failed requests reach threshold and requests to this endpoint fail fast without waiting for
+             timeout. After open interval single probe request allowed (half-open state): circuit closes if
+             probe succeed and opens again if it failed.
+
+ @author Sergey Mamontov
+ @since 4.8.2
+ @copyright © 2009-2017 PubNub, Inc.
+ */
+@interface PNCircuitBreaker : NSObject
+
+
+///------------------------------------------------
+/// @name Initialization and Configuration
+///------------------------------------------------
+
+/**
+ @brief  Construct circuit breaker.
+
+ @param threshold       Percentage of failed requests among recent requests after which circuit should open.
+ @param minimumRequests Minimum number of recent requests which is required to open circuit.
+ @param interval        For how long circuit should stay open before probe request will be allowed.
+
+ @return Configured and ready to use circuit breaker.
+
+ @since 4.8.2
+ */
++ (instancetype)breakerWithFailureRateThreshold:(NSUInteger)threshold minimumRequests:(NSUInteger)minimumRequests
+                                   openInterval:(NSTimeInterval)interval;
+
+
+///------------------------------------------------
+/// @name Requests
+///------------------------------------------------
+
+/**
+ @brief      Check whether request to endpoint can be sent.
+ @discussion Positive answer for endpoint with open circuit reserve probe request, so outcome should be
+             reported with \c -recordResponseForEndpoint:failed: or \c -recordCancellationForEndpoint:.
+
+ @param endpoint Reference on endpoint family name.
+
+ @return \c NO in case if circuit is open and request should fail right away.
+
+ @since 4.8.2
+ */
+- (BOOL)allowRequestForEndpoint:(NSString *)endpoint;
+
+/**
+ @brief  Store outcome of request to endpoint.
+
+ @param endpoint Reference on endpoint family name.
+ @param failed   Whether request failed because of endpoint degradation (timeout, network issues or server
+                 error).
+
+ @since 4.8.2
+ */
+- (void)recordResponseForEndpoint:(NSString *)endpoint failed:(BOOL)failed;
+
+/**
+ @brief  Handle cancellation of request which may be probe request.
+
+ @param endpoint Reference on endpoint family name.
+
+ @since 4.8.2
+ */
+- (void)recordCancellationForEndpoint:(NSString *)endpoint;
+
+
+///------------------------------------------------
+/// @name Metrics
+///------------------------------------------------
+
+/**
+ @brief  Retrieve circuits state gauges.
+
+ @return Dictionary with state of circuit (\c circuit.<endpoint>.state) for each endpoint family which has
+         been used: \b 0 for closed, \b 1 for open and \b 2 for half-open circuit.
+
+ @since 4.8.2
+ */
+- (NSDictionary<NSString *, NSNumber *> *)metrics;
+
+#pragma mark -
+
+
+@end
+
+NS_ASSUME_NONNULL_END
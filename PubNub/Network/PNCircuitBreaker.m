@@ -0,0 +1,261 @@
+/**
+ @author Sergey Mamontov
+ @since 4.8.2
+ @copyright © 2009-2017 PubNub, Inc.
+ */
+#import "PNCircuitBreaker.h"
+#import "PNLockSupport.h"
+
+
+#pragma mark Types
+
+/**
+ @brief  Endpoint circuit states.
+
+ @since 4.8.2
+ */
+typedef NS_ENUM(NSUInteger, PNCircuitState) {
+    PNCircuitClosedState,
+    PNCircuitOpenState,
+    PNCircuitHalfOpenState
+};
+
+
+#pragma mark - Static
+
+/**
+ @brief  Maximum number of recent requests outcomes which is used to calculate failure rate.
+
+ @since 4.8.2
+ */
+static NSUInteger const kPNCircuitBreakerWindowSize = 20;
+
+
+NS_ASSUME_NONNULL_BEGIN
+
+#pragma mark - Protected interface declaration
+
+@interface PNCircuitBreaker ()
+
+
+#pragma mark - Information
+
+/**
+ @brief  Stores percentage of failed requests after which circuit should open.
+
+ @since 4.8.2
+ */
+@property (nonatomic, assign) NSUInteger threshold;
+
+/**
+ @brief  Stores minimum number of recent requests which is required to open circuit.
+
+ @since 4.8.2
+ */
+@property (nonatomic, assign) NSUInteger minimumRequests;
+
+/**
+ @brief  Stores for how long circuit should stay open before probe request will be allowed.
+
+ @since 4.8.2
+ */
+@property (nonatomic, assign) NSTimeInterval openInterval;
+
+/**
+ @brief  Stores reference on map of endpoint family names to \b PNCircuitState enum fields.
+
+ @since 4.8.2
+ */
+@property (nonatomic, strong) NSMutableDictionary<NSString *, NSNumber *> *states;
+
+/**
+ @brief  Stores reference on map of endpoint family names to list of recent requests outcomes (\c YES for
+         failed request).
+
+ @since 4.8.2
+ */
+@property (nonatomic, strong) NSMutableDictionary<NSString *, NSMutableArray<NSNumber *> *> *outcomes;
+
+/**
+ @brief  Stores reference on map of endpoint family names to date when circuit has been opened.
+
+ @since 4.8.2
+ */
+@property (nonatomic, strong) NSMutableDictionary<NSString *, NSDate *> *openDates;
+
+/**
+ @brief  Stores reference on lock which is used to protect circuits state.
+
+ @since 4.8.2
+ */
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wpartial-availability"
+@property (nonatomic, assign) os_unfair_lock lock;
+#pragma clang diagnostic pop
+
+
+#pragma mark - Initialization and Configuration
+
+/**
+ @brief  Initialize circuit breaker.
+
+ @param threshold       Percentage of failed requests among recent requests after which circuit should open.
+ @param minimumRequests Minimum number of recent requests which is required to open circuit.
+ @param interval        For how long circuit should stay open before probe request will be allowed.
+
+ @return Initialized and ready to use circuit breaker.
+
+ @since 4.8.2
+ */
+- (instancetype)initWithFailureRateThreshold:(NSUInteger)threshold minimumRequests:(NSUInteger)minimumRequests
+                                openInterval:(NSTimeInterval)interval;
+
+
+#pragma mark - Misc
+
+/**
+ @brief      Open circuit for endpoint.
+ @discussion This method should be called only from within lock.
+
+ @param endpoint Reference on endpoint family name.
+ @param date     Reference on date from which open interval should be counted.
+
+ @since 4.8.2
+ */
+- (void)openCircuitForEndpoint:(NSString *)endpoint sinceDate:(NSDate *)date;
+
+#pragma mark -
+
+
+@end
+
+NS_ASSUME_NONNULL_END
+
+
+#pragma mark - Interface implementation
+
+@implementation PNCircuitBreaker
+
+
+#pragma mark - Initialization and Configuration
+
++ (instancetype)breakerWithFailureRateThreshold:(NSUInteger)threshold minimumRequests:(NSUInteger)minimumRequests
+                                   openInterval:(NSTimeInterval)interval {
+
+    return [[self alloc] initWithFailureRateThreshold:threshold minimumRequests:minimumRequests
+                                         openInterval:interval];
+}
+
+- (instancetype)initWithFailureRateThreshold:(NSUInteger)threshold minimumRequests:(NSUInteger)minimumRequests
+                                openInterval:(NSTimeInterval)interval {
+
+    // Check whether initialization was successful or not.
+    if ((self = [super init])) {
+
+        _threshold = MIN(MAX(threshold, 1), 100);
+        _minimumRequests = MIN(MAX(minimumRequests, 1), kPNCircuitBreakerWindowSize);
+        _openInterval = interval;
+        _states = [NSMutableDictionary new];
+        _outcomes = [NSMutableDictionary new];
+        _openDates = [NSMutableDictionary new];
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wpartial-availability"
+        _lock = OS_UNFAIR_LOCK_INIT;
+#pragma clang diagnostic pop
+    }
+
+    return self;
+}
+
+
+#pragma mark - Requests
+
+- (BOOL)allowRequestForEndpoint:(NSString *)endpoint {
+
+    __block BOOL allowed = YES;
+    pn_lock(&_lock, ^{
+
+        PNCircuitState state = self->_states[endpoint].unsignedIntegerValue;
+        if (state == PNCircuitOpenState) {
+
+            allowed = ([[NSDate date] timeIntervalSinceDate:self->_openDates[endpoint]] >= self->_openInterval);
+            if (allowed) { self->_states[endpoint] = @(PNCircuitHalfOpenState); }
+        }
+        else if (state == PNCircuitHalfOpenState) { allowed = NO; }
+    });
+
+    return allowed;
+}
+
+- (void)recordResponseForEndpoint:(NSString *)endpoint failed:(BOOL)failed {
+
+    pn_lock(&_lock, ^{
+
+        PNCircuitState state = self->_states[endpoint].unsignedIntegerValue;
+        if (state == PNCircuitHalfOpenState) {
+
+            if (failed) { [self openCircuitForEndpoint:endpoint sinceDate:[NSDate date]]; }
+            else { self->_states[endpoint] = @(PNCircuitClosedState); }
+        }
+        else if (state == PNCircuitClosedState) {
+
+            NSMutableArray<NSNumber *> *outcomes = self->_outcomes[endpoint];
+            if (!outcomes) {
+
+                outcomes = [NSMutableArray new];
+                self->_outcomes[endpoint] = outcomes;
+            }
+            [outcomes addObject:@(failed)];
+            if (outcomes.count > kPNCircuitBreakerWindowSize) { [outcomes removeObjectAtIndex:0]; }
+
+            NSUInteger failures = [[outcomes valueForKeyPath:@"@sum.self"] unsignedIntegerValue];
+            if (outcomes.count >= self->_minimumRequests && failures * 100 >= self->_threshold * outcomes.count) {
+                [self openCircuitForEndpoint:endpoint sinceDate:[NSDate date]];
+            }
+        }
+    });
+}
+
+- (void)recordCancellationForEndpoint:(NSString *)endpoint {
+
+    pn_lock(&_lock, ^{
+
+        // Next request will be used as probe.
+        if (self->_states[endpoint].unsignedIntegerValue == PNCircuitHalfOpenState) {
+            [self openCircuitForEndpoint:endpoint sinceDate:[NSDate distantPast]];
+        }
+    });
+}
+
+
+#pragma mark - Metrics
+
+- (NSDictionary<NSString *, NSNumber *> *)metrics {
+
+    NSMutableDictionary<NSString *, NSNumber *> *metrics = [NSMutableDictionary new];
+    pn_lock(&_lock, ^{
+
+        for (NSString *endpoint in self->_outcomes) {
+            NSString *name = [NSString stringWithFormat:@"circuit.%@.state", endpoint];
+
+            metrics[name] = (self->_states[endpoint] ?: @(PNCircuitClosedState));
+        }
+    });
+
+    return [metrics copy];
+}
+
+
+#pragma mark - Misc
+
+- (void)openCircuitForEndpoint:(NSString *)endpoint sinceDate:(NSDate *)date {
+
+    _states[endpoint] = @(PNCircuitOpenState);
+    _openDates[endpoint] = date;
+    [_outcomes[endpoint] removeAllObjects];
+}
+
+#pragma mark -
+
+
+@end
@@ -0,0 +1,117 @@
+#import <Foundation/Foundation.h>
+#import "PNTransport.h"
+
+
+#pragma mark Types
+
+/**
+ @brief  Definition for block which should be used by responder to complete request processing.
+ 
+ @param statusCode HTTP status code which should be reported for request.
+ @param data       Reference on response body (JSON).
+ @param error      Reference on network error which should be reported instead of response.
+ 
+ @since 4.8.2
+ */
+typedef void(^PNLoopbackTransportRespondBlock)(NSInteger statusCode, NSData * _Nullable data,
+                                               NSError * _Nullable error);
+
+/**
+ @brief  Definition for block which is used to generate responses for requests.
+ 
+ @param request Reference on request for which response should be provided.
+ @param respond Reference on block which should be called (right away or later) with response information.
+ 
+ @since 4.8.2
+ */
+typedef void(^PNLoopbackTransportResponder)(NSURLRequest * _Nonnull request,
+                                            PNLoopbackTransportRespondBlock _Nonnull respond);
+
+
+NS_ASSUME_NONNULL_BEGIN
+
+/**
+ @brief      In-memory transport which serve canned or scripted responses.
+ @discussion Transport doesn't open any connections, so it can be used to test and measure requests
+             processing, response parsing and results delivery without HTTP stack and remote service.
+             Requests which doesn't match any canned response passed to \c responder. If responder not set,
+             request completed with \b 404 status code.
+ 
+ @author Sergey Mamontov
+ @since 4.8.2
+ @copyright © 2009-2017 PubNub, Inc.
+ */
+@interface PNLoopbackTransport : NSObject <PNTransport>
+
+
+///------------------------------------------------
+/// @name Information
+///------------------------------------------------
+
+/**
+ @brief  Reference on block which is used to generate responses for requests without canned response.
+ 
+ @since 4.8.2
+ */
+@property (atomic, nullable, copy) PNLoopbackTransportResponder responder;
+
+/**
+ @brief  Number of requests which has been processed by transport.
+ 
+ @since 4.8.2
+ */
+@property (nonatomic, readonly, assign) NSUInteger requestsCount;
+
+/**
+ @brief      Size of portions in which response body is passed to tasks created with
+             \c -taskWithRequest:dataHandler:completion:.
+ @discussion If set to \b 0, whole response body will be passed at once.
+ 
+ @since 4.8.2
+ */
+@property (atomic, assign) NSUInteger streamChunkSize;
+
+
+///------------------------------------------------
+/// @name Initialization and Configuration
+///------------------------------------------------
+
+/**
+ @brief  Construct transport without any canned responses.
+ 
+ @return Configured and ready to use transport.
+ 
+ @since 4.8.2
+ */
++ (instancetype)transport;
+
+
+///------------------------------------------------
+/// @name Responses
+///------------------------------------------------
+
+/**
+ @brief      Store response which should be returned for all requests with specified path prefix.
+ @discussion If request path match few prefixes, response for longest of them will be used.
+ 
+ @param data       Reference on response body (JSON).
+ @param statusCode HTTP status code which should be reported for request.
+ @param prefix     Request URL path prefix for which response should be used.
+ 
+ @since 4.8.2
+ */
+- (void)setResponseData:(NSData *)data statusCode:(NSInteger)statusCode forPathPrefix:(NSString *)prefix;
+
+/**
+ @brief  Remove all canned responses.
+ 
+ @since 4.8.2
+ */
+- (void)removeAllResponses;
+
+#pragma mark -
+
+
+@end
+
+NS_ASSUME_NONNULL_END
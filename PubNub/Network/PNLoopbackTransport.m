@@ -0,0 +1,411 @@
+/**
+ @author Sergey Mamontov
+ @since 4.8.2
+ @copyright © 2009-2017 PubNub, Inc.
+ */
+#import "PNLoopbackTransport.h"
+#import "PNLockSupport.h"
+
+
+#pragma mark Static
+
+/**
+ @brief  Keys under which canned response information is stored.
+ 
+ @since 4.8.2
+ */
+static NSString * const kPNLoopbackResponseDataKey = @"data";
+static NSString * const kPNLoopbackResponseStatusCodeKey = @"status";
+
+
+#pragma mark - Class forward
+
+@class PNLoopbackTransportTask;
+
+
+NS_ASSUME_NONNULL_BEGIN
+
+#pragma mark - Protected interface declaration
+
+@interface PNLoopbackTransport ()
+
+
+#pragma mark - Information
+
+@property (nonatomic, assign) NSUInteger requestsCount;
+
+/**
+ @brief  Stores map of request path prefixes to canned responses.
+ 
+ @since 4.8.2
+ */
+@property (nonatomic, strong) NSMutableDictionary<NSString *, NSDictionary *> *responses;
+
+/**
+ @brief  Stores list of tasks which has been resumed and not completed yet.
+ 
+ @since 4.8.2
+ */
+@property (nonatomic, strong) NSMutableArray<PNLoopbackTransportTask *> *activeTasks;
+
+/**
+ @brief  Stores identifier which will be assigned to next created task.
+ 
+ @since 4.8.2
+ */
+@property (nonatomic, assign) NSUInteger nextTaskIdentifier;
+
+/**
+ @brief  Stores whether transport has been invalidated or not.
+ 
+ @since 4.8.2
+ */
+@property (nonatomic, assign, getter = isInvalidated) BOOL invalidated;
+
+/**
+ @brief  Stores reference on queue on which responders and completion blocks are called.
+ 
+ @since 4.8.2
+ */
+@property (nonatomic, strong) dispatch_queue_t processingQueue;
+
+/**
+ @brief  Stores reference on lock which is used to protect transport and tasks state.
+ 
+ @since 4.8.2
+ */
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wpartial-availability"
+@property (nonatomic, assign) os_unfair_lock lock;
+#pragma clang diagnostic pop
+
+
+#pragma mark - Request processing
+
+/**
+ @brief  Start processing of resumed task.
+ 
+ @param task Reference on task which should receive response.
+ 
+ @since 4.8.2
+ */
+- (void)processTask:(PNLoopbackTransportTask *)task;
+
+/**
+ @brief      Complete task processing.
+ @discussion Only first completion will be reported to task's completion block.
+ 
+ @param task       Reference on task which should be completed.
+ @param statusCode HTTP status code which should be reported for request.
+ @param data       Reference on response body.
+ @param error      Reference on request processing error.
+ 
+ @since 4.8.2
+ */
+- (void)completeTask:(PNLoopbackTransportTask *)task withStatusCode:(NSInteger)statusCode
+                data:(nullable NSData *)data error:(nullable NSError *)error;
+
+/**
+ @brief  Find canned response for passed request.
+ 
+ @param request Reference on request for which response should be found.
+ 
+ @return Dictionary with response data and status code or \c nil if there is no canned response for request.
+ 
+ @since 4.8.2
+ */
+- (nullable NSDictionary *)cannedResponseForRequest:(NSURLRequest *)request;
+
+#pragma mark -
+
+
+@end
+
+
+#pragma mark - Private interface declaration
+
+/**
+ @brief  Loopback transport task.
+ 
+ @since 4.8.2
+ */
+@interface PNLoopbackTransportTask : NSObject <PNTransportTask>
+
+
+#pragma mark - Information
+
+@property (assign) NSUInteger taskIdentifier;
+@property (nullable, copy) NSURLRequest *originalRequest;
+@property (nullable, copy) NSURLRequest *currentRequest;
+@property (nullable, copy) NSURLResponse *response;
+@property (nullable, copy) NSError *error;
+
+/**
+ @brief  Stores reference on transport which created task.
+ 
+ @since 4.8.2
+ */
+@property (nonatomic, weak) PNLoopbackTransport *transport;
+
+/**
+ @brief  Stores reference on block which should be called when task processing will be completed.
+ 
+ @since 4.8.2
+ */
+@property (nonatomic, nullable, copy) PNTransportTaskCompletion completion;
+
+/**
+ @brief  Stores reference on block which should receive response body portions (for streaming tasks).
+ 
+ @since 4.8.2
+ */
+@property (nonatomic, nullable, copy) PNTransportTaskDataHandler dataHandler;
+
+/**
+ @brief  Stores whether task processing has been started or not.
+ 
+ @since 4.8.2
+ */
+@property (nonatomic, assign, getter = isResumed) BOOL resumed;
+
+/**
+ @brief  Stores whether task processing has been completed or not.
+ 
+ @since 4.8.2
+ */
+@property (nonatomic, assign, getter = isCompleted) BOOL completed;
+
+#pragma mark -
+
+
+@end
+
+NS_ASSUME_NONNULL_END
+
+
+#pragma mark - Interface implementation
+
+@implementation PNLoopbackTransportTask
+
+
+#pragma mark - Processing
+
+- (void)resume {
+    
+    [self.transport processTask:self];
+}
+
+- (void)cancel {
+    
+    NSError *error = [NSError errorWithDomain:NSURLErrorDomain code:NSURLErrorCancelled
+                                     userInfo:@{NSURLErrorFailingURLErrorKey: self.originalRequest.URL}];
+    [self.transport completeTask:self withStatusCode:0 data:nil error:error];
+}
+
+#pragma mark -
+
+
+@end
+
+
+#pragma mark - Interface implementation
+
+@implementation PNLoopbackTransport
+
+
+#pragma mark - Initialization and Configuration
+
++ (instancetype)transport {
+    
+    return [self new];
+}
+
+- (instancetype)init {
+    
+    // Check whether initialization was successful or not.
+    if ((self = [super init])) {
+        
+        _responses = [NSMutableDictionary new];
+        _activeTasks = [NSMutableArray new];
+        _processingQueue = dispatch_queue_create("com.pubnub.transport.loopback", DISPATCH_QUEUE_CONCURRENT);
+        _lock = OS_UNFAIR_LOCK_INIT;
+    }
+    
+    return self;
+}
+
+
+#pragma mark - Responses
+
+- (void)setResponseData:(NSData *)data statusCode:(NSInteger)statusCode forPathPrefix:(NSString *)prefix {
+    
+    pn_lock(&_lock, ^{
+        
+        self->_responses[prefix] = @{ kPNLoopbackResponseDataKey: data,
+                                      kPNLoopbackResponseStatusCodeKey: @(statusCode) };
+    });
+}
+
+- (void)removeAllResponses {
+    
+    pn_lock(&_lock, ^{ [self->_responses removeAllObjects]; });
+}
+
+- (NSUInteger)requestsCount {
+    
+    __block NSUInteger requestsCount = 0;
+    pn_lock(&_lock, ^{ requestsCount = self->_requestsCount; });
+    
+    return requestsCount;
+}
+
+
+#pragma mark - Request processing
+
+- (void)prepareRequest:(NSMutableURLRequest *)__unused request {
+}
+
+- (id <PNTransportTask>)taskWithRequest:(NSURLRequest *)request completion:(PNTransportTaskCompletion)block {
+    
+    PNLoopbackTransportTask *task = [PNLoopbackTransportTask new];
+    task.originalRequest = request;
+    task.currentRequest = request;
+    task.transport = self;
+    task.completion = block;
+    pn_lock(&_lock, ^{ task.taskIdentifier = self->_nextTaskIdentifier++; });
+    
+    return task;
+}
+
+- (id <PNTransportTask>)taskWithRequest:(NSURLRequest *)request dataHandler:(PNTransportTaskDataHandler)dataHandler
+                             completion:(PNTransportTaskCompletion)block {
+    
+    PNLoopbackTransportTask *task = (PNLoopbackTransportTask *)[self taskWithRequest:request completion:block];
+    task.dataHandler = dataHandler;
+    
+    return task;
+}
+
+- (void)getTasksWithCompletion:(void(^)(NSArray<id <PNTransportTask>> *tasks))block {
+    
+    __block NSArray<PNLoopbackTransportTask *> *tasks = nil;
+    pn_lock(&_lock, ^{ tasks = [self->_activeTasks copy]; });
+    
+    dispatch_async(self.processingQueue, ^{ block(tasks); });
+}
+
+- (void)invalidate {
+    
+    __block NSArray<PNLoopbackTransportTask *> *tasks = nil;
+    pn_lock(&_lock, ^{
+        
+        self->_invalidated = YES;
+        tasks = [self->_activeTasks copy];
+    });
+    
+    [tasks makeObjectsPerformSelector:@selector(cancel)];
+}
+
+- (void)processTask:(PNLoopbackTransportTask *)task {
+    
+    __block BOOL shouldProcess = NO;
+    __block NSDictionary *cannedResponse = nil;
+    pn_lock(&_lock, ^{
+        
+        shouldProcess = (!task.isResumed && !task.isCompleted && !self->_invalidated);
+        if (shouldProcess) {
+            
+            task.resumed = YES;
+            self->_requestsCount++;
+            [self->_activeTasks addObject:task];
+            cannedResponse = [self cannedResponseForRequest:task.originalRequest];
+        }
+    });
+    
+    if (!shouldProcess) { return; }
+    
+    PNLoopbackTransportResponder responder = self.responder;
+    __weak __typeof(self) weakSelf = self;
+    dispatch_async(self.processingQueue, ^{
+        
+        if (cannedResponse) {
+            
+            NSInteger statusCode = ((NSNumber *)cannedResponse[kPNLoopbackResponseStatusCodeKey]).integerValue;
+            [weakSelf completeTask:task withStatusCode:statusCode data:cannedResponse[kPNLoopbackResponseDataKey]
+                             error:nil];
+        }
+        else if (responder) {
+            
+            responder(task.originalRequest, ^(NSInteger statusCode, NSData *data, NSError *error) {
+                
+                [weakSelf completeTask:task withStatusCode:statusCode data:data error:error];
+            });
+        }
+        else { [weakSelf completeTask:task withStatusCode:404 data:nil error:nil]; }
+    });
+}
+
+- (void)completeTask:(PNLoopbackTransportTask *)task withStatusCode:(NSInteger)statusCode
+                data:(NSData *)data error:(NSError *)error {
+    
+    __block BOOL shouldComplete = NO;
+    pn_lock(&_lock, ^{
+        
+        shouldComplete = !task.isCompleted;
+        task.completed = YES;
+        [self->_activeTasks removeObject:task];
+    });
+    
+    if (!shouldComplete) { return; }
+    
+    NSHTTPURLResponse *response = nil;
+    if (!error) {
+        
+        response = [[NSHTTPURLResponse alloc] initWithURL:task.originalRequest.URL statusCode:statusCode
+                                              HTTPVersion:@"HTTP/1.1"
+                                             headerFields:@{@"Content-Type": @"application/json",
+                                                            @"Content-Length": @(data.length).stringValue}];
+    }
+    task.response = response;
+    task.error = error;
+    PNTransportTaskCompletion completion = task.completion;
+    PNTransportTaskDataHandler dataHandler = task.dataHandler;
+    NSUInteger chunkSize = (self.streamChunkSize ?: data.length);
+    task.completion = nil;
+    task.dataHandler = nil;
+    
+    if (!completion) { return; }
+    dispatch_async(self.processingQueue, ^{
+        
+        if (!dataHandler) { completion(data, response, error); }
+        else {
+            
+            for (NSUInteger offset = 0; offset < data.length; offset += chunkSize) {
+                
+                NSRange range = NSMakeRange(offset, MIN(chunkSize, data.length - offset));
+                dataHandler([data subdataWithRange:range]);
+            }
+            completion(nil, response, error);
+        }
+    });
+}
+
+
+#pragma mark - Misc
+
+- (NSDictionary *)cannedResponseForRequest:(NSURLRequest *)request {
+    
+    NSString *path = request.URL.path;
+    NSString *matchedPrefix = nil;
+    for (NSString *prefix in self.responses) {
+        
+        if ([path hasPrefix:prefix] && prefix.length > matchedPrefix.length) { matchedPrefix = prefix; }
+    }
+    
+    return (matchedPrefix ? self.responses[matchedPrefix] : nil);
+}
+
+#pragma mark -
+
+
+@end
@@ -4,7 +4,8 @@
 
 #pragma mark Class forward
 
-@class PNRequestParameters, PubNub;
+@class PNRequestParameters, PNRequestHandle, PNSharedRequest, PubNub;
+@protocol PNTransport;
 
 
 NS_ASSUME_NONNULL_BEGIN
@@ -41,6 +42,27 @@ NS_ASSUME_NONNULL_BEGIN
 + (instancetype)networkForClient:(PubNub *)client requestTimeout:(NSTimeInterval)timeout
               maximumConnections:(NSInteger)maximumConnections longPoll:(BOOL)longPollEnabled;
 
+/**
+ @brief      Construct \b PubNub network manager which will send requests using specified transport.
+ @discussion Custom transport allow to route requests through in-memory or instrumented transport (for
+             example to measure request processing and response parsing overhead without network I/O).
+ 
+ @param client             Reference on client for which this network manager is creating.
+ @param timeout            Maximum time which manager should wait for response on request.
+ @param maximumConnections Maximum simultaneously connections (requests) which can be opened.
+ @param longPollEnabled    Whether \b PubNub network manager should be configured for long-poll requests or 
+                           not. This option affect the way how network manager handle reset.
+ @param transport          Reference on transport which should be used to send network requests. If \c nil is
+                           passed, \a NSURLSession based transport will be used.
+ 
+ @return Constructed and ready to use \b PubNub network manager.
+ 
+ @since 4.8.2
+ */
++ (instancetype)networkForClient:(PubNub *)client requestTimeout:(NSTimeInterval)timeout
+              maximumConnections:(NSInteger)maximumConnections longPoll:(BOOL)longPollEnabled
+                       transport:(nullable id <PNTransport>)transport;
+
 
 ///------------------------------------------------
 /// @name Request processing
@@ -57,11 +79,63 @@ NS_ASSUME_NONNULL_BEGIN
  @param block         Depending on operation type it can be \b PNResultBlock, \b PNStatusBlock or
                       \b PNCompletionBlock blocks.`
  
+ @return Reference on handle which can be used to cancel request or \c nil if request can't be composed from
+         passed \c parameters, has been completed with cached result or attached to identical in-flight
+         request. Handle which has been passed with \c parameters always returned.
+ 
  @since 4.0
  */
-- (void)processOperation:(PNOperationType)operationType
-          withParameters:(PNRequestParameters *)parameters data:(nullable NSData *)data
-         completionBlock:(id)block;
+- (nullable PNRequestHandle *)processOperation:(PNOperationType)operationType
+                                withParameters:(PNRequestParameters *)parameters data:(nullable NSData *)data
+                               completionBlock:(id)block;
+
+/**
+ @brief      Compose key which identify request for coalescing of identical API calls.
+ @discussion Key composed only for idempotent read operations. Required request parameters will be added to
+             passed \c parameters.
+ 
+ @param operationType One of \b PNOperationType enumerator fields which describe what kind of operation will
+                      be executed by client.
+ @param parameters    Request parameters representation object.
+ 
+ @return Request key or \c nil in case if calls for this operation can't be coalesced.
+ 
+ @since 4.8.2
+ */
+- (nullable NSString *)coalescingKeyForOperation:(PNOperationType)operationType
+                                  withParameters:(PNRequestParameters *)parameters;
+
+/**
+ @brief      Attach API call to identical in-flight request.
+ @discussion If there is no identical in-flight requests, API call registered as first caller of new shared
+             request. API call with \c handle can be cancelled separately from other callers.
+ 
+ @param block     Reference on API call completion block.
+ @param handle    Reference on handle which allow user to cancel API call.
+ @param key       Reference on key which identify request.
+ @param operation One of \b PNOperationType enum fields which describe operation type.
+ 
+ @return Reference on new shared request which should be sent by caller or \c nil in case if API call has
+         been attached to identical in-flight request.
+ 
+ @since 4.8.2
+ */
+- (nullable PNSharedRequest *)attachCompletionBlock:(PNCompletionBlock)block
+                                         withHandle:(nullable PNRequestHandle *)handle
+                                   toRequestWithKey:(NSString *)key forOperation:(PNOperationType)operation;
+
+/**
+ @brief  Create completion block which will pass request processing results to all API callers which still
+         wait for them.
+ 
+ @param request Reference on shared request which has been sent by caller.
+ @param key     Reference on key which identify request (\c nil for request which won't be coalesced).
+ 
+ @return Reference on block which should be used as request completion block.
+ 
+ @since 4.8.2
+ */
+- (PNCompletionBlock)completionBlockForSharedRequest:(PNSharedRequest *)request withKey:(nullable NSString *)key;
 
 /**
  @brief  Fetch list of active requests (filtered by API path prefix if passed) and cancel their processing.
@@ -73,6 +147,28 @@ NS_ASSUME_NONNULL_BEGIN
  */
 - (void)cancelAllOperationsWithURLPrefix:(nullable NSString *)prefix;
 
+/**
+ @brief      Cancel all active requests which has been sent for specified operation type.
+ @discussion Requests found in registry of in-flight requests without request URL matching.
+ 
+ @param operationType One of \b PNOperationType enum fields which describe type of operations which should be
+                      cancelled.
+ 
+ @since 4.8.2
+ */
+- (void)cancelAllOperationsOfType:(PNOperationType)operationType;
+
+/**
+ @brief      Open connections to \b PubNub network before first operation will be processed.
+ @discussion Lightweight time requests sent concurrently (up to maximum connections count for non-subscribe
+             requests and single request for long-poll requests), so DNS lookup, TCP and TLS handshakes will
+             be completed before first API call. Requests processed by transport directly and their results
+             ignored.
+ 
+ @since 4.8.2
+ */
+- (void)warmUpConnections;
+
 /**
  @brief  Invalidate network communication layer.
  
@@ -112,6 +208,30 @@ NS_ASSUME_NONNULL_BEGIN
 /// @name Operation information
 ///------------------------------------------------
 
+/**
+ @brief      Retrieve requests scheduler gauges.
+ @discussion Network manager for non-subscribe requests report number of waiting and active requests for
+             each priority class.
+ 
+ @return Dictionary where each metric name is mapped to it's latest value.
+ 
+ @since 4.8.2
+ */
+- (NSDictionary<NSString *, NSNumber *> *)metrics;
+
+/**
+ @brief      Check whether specified operation is expecting result object or not.
+ @discussion Operations which expect result call \b PNCompletionBlock and other operations call
+             \b PNStatusBlock.
+ 
+ @param operation Operation type against which check should be performed.
+ 
+ @return \c YES in case if this type of operation is expecting to receive in result object.
+ 
+ @since 4.0
+ */
+- (BOOL)operationExpectResult:(PNOperationType)operation;
+
 /**
  @brief  Calculate actual size of packet for passed \c operationType which will be sent to \b PubNub network.
  
@@ -6,6 +6,15 @@
 #import "PNNetwork.h"
 #import "NSURLSessionConfiguration+PNConfigurationPrivate.h"
 #import "PNNetworkResponseSerializer.h"
+#import "PNSharedURLSessionTransport.h"
+#import "PNSubscribeStreamParser.h"
+#import "PNCircuitBreaker.h"
+#import "PNRequestScheduler.h"
+#import "PNRequestHedge.h"
+#import "PNSharedRequest.h"
+#import "PNRequestHandle+Private.h"
+#import "PNResponseCache.h"
+#import "PNURLSessionTransport.h"
 #import "PNRequestParameters.h"
 #import "PNPrivateStructures.h"
 #import "PubNub+CorePrivate.h"
@@ -25,19 +34,6 @@
 
 #pragma mark Types
 
-/**
- @brief  Definition for block which is used as NSURLSessionDataTask completion handler (passed during task 
-         creation.
- 
- @param data     Actual raw data which has been received from \b PubNub service in response.
- @param response HTTP response instance which hold metadata about response.
- @param error    Reference on error instance in case of any processing issues.
- 
- @since 4.0.2
- */
-typedef void(^NSURLSessionDataTaskCompletion)(NSData * _Nullable data, NSURLResponse * _Nullable response, 
-                                              NSError * _Nullable error);
-
 /**
  @brief  Definition for block which is used by \b PubNub SDK to process successfully completed request with
          pre-processed response.
@@ -45,9 +41,9 @@ typedef void(^NSURLSessionDataTaskCompletion)(NSData * _Nullable data, NSURLResp
  @param task           Reference on data load task which has been used to communicate with \b PubNub network.
  @param responseObject Serialized \b PubNub service response.
  
- @since 4.0.2
+ @since 4.8.2
  */
-typedef void(^NSURLSessionDataTaskSuccess)(NSURLSessionDataTask * _Nullable task, id _Nullable responseObject);
+typedef void(^PNTransportTaskSuccess)(id <PNTransportTask> _Nullable task, id _Nullable responseObject);
 
 /**
  @brief  Definition for block which is used by \b PubNub SDK to process failed request.
@@ -55,9 +51,9 @@ typedef void(^NSURLSessionDataTaskSuccess)(NSURLSessionDataTask * _Nullable task
  @param task  Reference on data load task which has been used to communicate with \b PubNub network.
  @param error Reference on error instance in case of any processing issues.
  
- @since 4.0.2
+ @since 4.8.2
  */
-typedef void(^NSURLSessionDataTaskFailure)(NSURLSessionDataTask * _Nullable task, NSError * _Nullable error);
+typedef void(^PNTransportTaskFailure)(id <PNTransportTask> _Nullable task, NSError * _Nullable error);
 
 
 NS_ASSUME_NONNULL_BEGIN
@@ -117,11 +113,111 @@ NS_ASSUME_NONNULL_BEGIN
 
 
 /**
- @brief  Stores reference on session instance which is used to send network requests.
+ @brief      Stores reference on transport which is used to send network requests.
+ @discussion By default \a NSURLSession based transport is used, but it can be replaced with custom one during
+             network manager initialization.
  
- @since 4.0.2
+ @since 4.8.2
+ */
+@property (nonatomic, strong, nullable) id <PNTransport> transport;
+
+/**
+ @brief      Stores whether transport has been passed by user during network manager initialization or not.
+ @discussion Custom transport won't be replaced with \a NSURLSession based transport when network manager
+             re-create session.
+ 
+ @since 4.8.2
+ */
+@property (nonatomic, assign) BOOL usesCustomTransport;
+
+/**
+ @brief      Stores whether manager use transport which share session with other clients or not.
+ @discussion Shared session doesn't have delegate, so transaction metrics won't be reported for its tasks.
+ 
+ @since 4.8.2
+ */
+@property (nonatomic, assign) BOOL usesSharedTransport;
+
+/**
+ @brief      Stores reference on scheduler which is used to start non-subscribe requests in order of their
+             priority.
+ @discussion Scheduler not used for long-poll requests and in application extension context.
+ 
+ @since 4.8.2
+ */
+@property (nonatomic, nullable, strong) PNRequestScheduler *scheduler;
+
+/**
+ @brief      Stores reference on cache which is used to reuse results of idempotent read operations.
+ @discussion Cache created only if time-to-live has been configured for at least one operation.
+ 
+ @since 4.8.2
+ */
+@property (nonatomic, nullable, strong) PNResponseCache *responseCache;
+
+/**
+ @brief      Stores reference on map of in-flight idempotent read request keys to objects which track
+             callers which has been attached to them.
+ @discussion Identical requests which is sent while first one is in flight doesn't reach \b PubNub network
+             and receive same result object as first request.
+ 
+ @since 4.8.2
+ */
+@property (nonatomic, strong) NSMutableDictionary<NSString *, PNSharedRequest *> *coalescedRequests;
+
+/**
+ @brief  Stores number of read requests which could be hedged.
+ 
+ @since 4.8.2
+ */
+@property (nonatomic, assign) NSUInteger hedgeEligibleRequestsCount;
+
+/**
+ @brief  Stores number of duplicate requests which has been sent to cut tail latency.
+ 
+ @since 4.8.2
+ */
+@property (nonatomic, assign) NSUInteger hedgedRequestsCount;
+
+/**
+ @brief      Stores reference on breaker which stop requests to degraded endpoints.
+ @discussion Breaker created only for non-subscribe requests and only if failure rate threshold has been
+             configured.
+ 
+ @since 4.8.2
+ */
+@property (nonatomic, nullable, strong) PNCircuitBreaker *circuitBreaker;
+
+/**
+ @brief      Stores reference on GCD timer which is used to check long-poll requests read activity.
+ @discussion Timer used only by long-poll network if \c subscribeWatchdogInterval has been configured and
+             work only while there is active subscribe requests.
+ 
+ @since 4.8.2
+ */
+@property (nonatomic, nullable, strong) dispatch_source_t watchdogTimer;
+
+/**
+ @brief  Stores reference on date when subscribe request has been started or received data last time.
+ 
+ @since 4.8.2
+ */
+@property (nonatomic, nullable, strong) NSDate *lastReadActivityDate;
+
+/**
+ @brief  Whether keep-alive probe request has been sent and didn't completed yet.
+ 
+ @since 4.8.2
+ */
+@property (nonatomic, assign, getter = isWatchdogProbeInFlight) BOOL watchdogProbeInFlight;
+
+/**
+ @brief      Stores reference on identifiers of subscribe tasks which has been cancelled by watchdog.
+ @discussion These tasks should be completed with network issues instead of cancellation.
+ 
+ @since 4.8.2
  */
-@property (nonatomic, strong, nullable) NSURLSession *session;
+@property (nonatomic, strong) NSMutableSet<NSNumber *> *terminatedTaskIdentifiers;
 
 /**
  @brief  Stores unique session identifier which is used by telemetry.
@@ -137,7 +233,7 @@ NS_ASSUME_NONNULL_BEGIN
  
  @since 4.5.4
  */
-@property (nonatomic, nullable, copy) NSURLSessionDataTaskCompletion previousDataTaskCompletionHandler;
+@property (nonatomic, nullable, copy) PNTransportTaskCompletion previousDataTaskCompletionHandler;
 
 /**
  @brief      Stores reference on object which is able to store received service response.
@@ -178,6 +274,15 @@ NS_ASSUME_NONNULL_BEGIN
  */
 @property (nonatomic, strong) NSDictionary *defaultQueryComponents;
 
+/**
+ @brief      Stores reference on registry of in-flight tasks.
+ @discussion Map of operation types to map of task identifiers to tasks, so all tasks of same operation type
+             can be found without request URL matching.
+ 
+ @since 4.8.2
+ */
+@property (nonatomic, strong) NSMutableDictionary<NSNumber *, NSMutableDictionary<NSNumber *, id <PNTransportTask>> *> *activeTasks;
+
 #if PN_URLSESSION_TRANSACTION_METRICS_AVAILABLE
 /**
  @brief      Stores reference on linkage of scheduled data task and it's operation type.
@@ -207,7 +312,7 @@ NS_ASSUME_NONNULL_BEGIN
  
  @since 4.5.0
  */
-@property (nonatomic, strong) NSMutableArray<NSURLSessionDataTask *> *scheduledDataTasks;
+@property (nonatomic, strong) NSMutableArray<id <PNTransportTask>> *scheduledDataTasks;
 
 /**
  @brief  Stores reference on identifier which has been used to request from system more time to complete
@@ -260,12 +365,16 @@ NS_ASSUME_NONNULL_BEGIN
  @param longPollEnabled    Whether \b PubNub network manager should be configured for long-poll requests or 
                            not. This option affect the way how network manager handle reset.
  
+ @param transport          Reference on transport which should be used to send network requests. If \c nil is
+                           passed, \a NSURLSession based transport will be used.
+ 
  @return 4.0
  
  @since Initialized and ready to use \b PubNub network manager.
  */
 - (instancetype)initForClient:(PubNub *)client requestTimeout:(NSTimeInterval)timeout
-           maximumConnections:(NSInteger)maximumConnections longPoll:(BOOL)longPollEnabled;
+           maximumConnections:(NSInteger)maximumConnections longPoll:(BOOL)longPollEnabled
+                    transport:(nullable id <PNTransport>)transport;
 
 
 #pragma mark - Request helper
@@ -314,24 +423,137 @@ NS_ASSUME_NONNULL_BEGIN
  
  @since 4.0
  */
-- (NSURLSessionDataTask *)dataTaskWithRequest:(NSURLRequest *)request 
-                                 forOperation:(PNOperationType)operationType
-                                      success:(NSURLSessionDataTaskSuccess)success
-                                      failure:(NSURLSessionDataTaskFailure)failure;
+- (id <PNTransportTask>)dataTaskWithRequest:(NSURLRequest *)request 
+                               forOperation:(PNOperationType)operationType
+                                    success:(PNTransportTaskSuccess)success
+                                    failure:(PNTransportTaskFailure)failure;
+
+/**
+ @brief      Construct data task which will parse response while it is received.
+ @discussion \c success block will be called with parsed service response, so it shouldn't be passed to
+             parser once more.
+ 
+ @param request       Reference on request which should be issued with data task.
+ @param operationType One of \b PNOperationType enumerator fields which describe what kind of operation will 
+                      be performed by passed \c request.
+ @param success       Reference on data task success handling block which will be called by network manager.
+ @param failure       Reference on data task processing failure handling block which will be called by network 
+                      manager.
+ 
+ @return Constructed and ready to use data task.
+ 
+ @since 4.8.2
+ */
+- (id <PNTransportTask>)streamingDataTaskWithRequest:(NSURLRequest *)request 
+                                        forOperation:(PNOperationType)operationType
+                                             success:(PNTransportTaskSuccess)success
+                                             failure:(PNTransportTaskFailure)failure;
 
 
 #pragma mark - Request processing
 
 /**
- @brief  Check whether specified operation is expecting result object or not.
+ @brief  Store task in in-flight tasks registry.
  
- @param operation Operation type against which check should be performed.
+ @param task      Reference on task which has been created for operation.
+ @param operation One of \b PNOperationType enum fields which describe operation type.
+ 
+ @since 4.8.2
+ */
+- (void)registerTask:(id <PNTransportTask>)task forOperation:(PNOperationType)operation;
+
+/**
+ @brief  Remove task from in-flight tasks registry.
  
- @return \c YES in case if this type of operation is expecting to receive in result object.
+ @param task      Reference on task which has been completed.
+ @param operation One of \b PNOperationType enum fields which describe operation type.
  
- @since 4.0
+ @since 4.8.2
+ */
+- (void)unregisterTask:(id <PNTransportTask>)task forOperation:(PNOperationType)operation;
+
+/**
+ @brief  Create and register data task for operation.
+ 
+ @param operationType One of \b PNOperationType enum fields which describe operation type.
+ @param request       Reference on request which should be sent by task.
+ @param handle        Reference on handle which is used to check whether loaded response still expected by
+                      API caller or not.
+ @param block         Depending on operation type it can be \b PNResultBlock, \b PNStatusBlock or
+                      \b PNCompletionBlock blocks.
+ 
+ @return Data task which should be started with \c -startTask:forOperation:.
+ 
+ @since 4.8.2
+ */
+- (id <PNTransportTask>)taskForOperation:(PNOperationType)operationType withRequest:(NSURLRequest *)request
+                                  handle:(nullable PNRequestHandle *)handle completionBlock:(id)block;
+
+/**
+ @brief  Start task right away or place it into scheduler's lane.
+ 
+ @param task          Reference on task which should be started.
+ @param operationType One of \b PNOperationType enum fields which describe operation type.
+ 
+ @since 4.8.2
+ */
+- (void)startTask:(id <PNTransportTask>)task forOperation:(PNOperationType)operationType;
+
+/**
+ @brief      Calculate timeout for request which is sent for operation.
+ @discussion Timeout is \b 99th percentile of latencies observed for operation's endpoint multiplied by
+             configured factor and limited by configured minimum and maximum timeouts.
+ 
+ @param operationType One of \b PNOperationType enum fields which describe operation type.
+ 
+ @return Timeout in seconds or \b -1 in case if session's timeout should be used.
+ 
+ @since 4.8.2
  */
-- (BOOL)operationExpectResult:(PNOperationType)operation;
+- (NSTimeInterval)adaptiveTimeoutForOperation:(PNOperationType)operationType;
+
+/**
+ @brief      Calculate delay after which duplicate of request should be sent.
+ @discussion Delay is equal to \b 95th percentile of latencies observed for operation's endpoint.
+ 
+ @param operationType One of \b PNOperationType enum fields which describe operation type.
+ 
+ @return Delay in seconds or \b -1 in case if request can't be hedged.
+ 
+ @since 4.8.2
+ */
+- (NSTimeInterval)hedgeDelayForOperation:(PNOperationType)operationType;
+
+/**
+ @brief      Send duplicate of request if original request won't complete during specified delay.
+ @discussion Duplicate won't be sent if it will exceed hedge budget.
+ 
+ @param operationType One of \b PNOperationType enum fields which describe operation type.
+ @param request       Reference on request which should be sent once more.
+ @param hedge         Reference on object which track request attempts.
+ @param delay         Delay after which request should be sent.
+ @param block         Reference on operation completion block.
+ 
+ @since 4.8.2
+ */
+- (void)scheduleHedgeForOperation:(PNOperationType)operationType withRequest:(NSURLRequest *)request
+                            hedge:(PNRequestHedge *)hedge delay:(NSTimeInterval)delay
+                  completionBlock:(PNCompletionBlock)block;
+
+/**
+ @brief  Wrap operation completion block, so it will be called only for attempt which won.
+ 
+ @param block   Reference on operation completion block.
+ @param attempt Index of attempt for which completion block will be used.
+ @param hedge   Reference on object which track request attempts.
+ 
+ @return Completion block which should be used for attempt's task.
+ 
+ @since 4.8.2
+ */
+- (PNCompletionBlock)completionBlock:(PNCompletionBlock)block forAttempt:(NSUInteger)attempt
+                             ofHedge:(PNRequestHedge *)hedge;
+
 
 /**
  @brief  Retrieve reference on parser class which can be used to process received data for \c operation
@@ -378,6 +600,86 @@ NS_ASSUME_NONNULL_BEGIN
 - (void)parseData:(nullable id)data withParser:(Class <PNParser>)parser
        completion:(void(^)(NSDictionary * _Nullable parsedData, BOOL parseError))block;
 
+/**
+ @brief  Check whether response for specified operation should be parsed while it is received or not.
+ 
+ @param operation One of \b PNOperationType enum fields which describe operation for which check should be
+                  done.
+ 
+ @return \c YES in case if transport can stream response body and incremental parser exists for operation.
+ 
+ @since 4.8.2
+ */
+- (BOOL)shouldStreamResponseForOperation:(PNOperationType)operation;
+
+/**
+ @brief  Compose additional information which is used by parsers to process service response.
+ 
+ @return Dictionary with client configuration information required by parsers.
+ 
+ @since 4.8.2
+ */
+- (NSDictionary *)additionalParserData;
+
+
+#pragma mark - Watchdog
+
+/**
+ @brief      Start long-poll requests read activity checks.
+ @discussion Read activity reset each time when subscribe request started.
+ 
+ @since 4.8.2
+ */
+- (void)startWatchdogIfRequired;
+
+/**
+ @brief  Store date when subscribe request received data.
+ 
+ @since 4.8.2
+ */
+- (void)trackReadActivity;
+
+/**
+ @brief  Check whether subscribe requests idle for too long and connection should be checked.
+ 
+ @since 4.8.2
+ */
+- (void)handleWatchdogTimer;
+
+/**
+ @brief      Send keep-alive probe request through same transport which is used by subscribe requests.
+ @discussion Probe sent over separate connection (HTTP/1.1 doesn't allow to send it over connection with
+             pending long-poll request), so it is used only to tell network path loss from stalled long-poll
+             connection.
+ 
+ @param idleTime For how long subscribe requests didn't receive any data.
+ 
+ @since 4.8.2
+ */
+- (void)sendWatchdogProbeAfterIdleTime:(NSTimeInterval)idleTime;
+
+/**
+ @brief      Handle keep-alive probe request completion.
+ @discussion Active subscribe requests cancelled if probe failed because of network issues or if they still
+             didn't receive any data (successful probe doesn't prove that long-poll connection is alive).
+ 
+ @param error Reference on probe request processing error.
+ 
+ @since 4.8.2
+ */
+- (void)handleWatchdogProbeCompletionWithError:(nullable NSError *)error;
+
+/**
+ @brief  Error which should be reported for subscribe task cancelled by watchdog.
+ 
+ @param task Reference on completed data task.
+ 
+ @return Network connection lost error or \c nil in case if task hasn't been cancelled by watchdog.
+ 
+ @since 4.8.2
+ */
+- (nullable NSError *)watchdogErrorForTask:(nullable id <PNTransportTask>)task;
+
 #if TARGET_OS_IOS
 
 /**
@@ -391,7 +693,7 @@ NS_ASSUME_NONNULL_BEGIN
  @param onCompletion Whether list processed after another data task completed or right \b PubNub after client
                      resign active state.
  */
-- (void)processIncompleteBeforeClientResignActiveTasks:(NSArray<NSURLSessionDataTask *> *)dataTasks
+- (void)processIncompleteBeforeClientResignActiveTasks:(NSArray<id <PNTransportTask>> *)dataTasks
                                   onDataTaskCompletion:(BOOL)onCompletion;
 
 #endif // TARGET_OS_IOS
@@ -436,15 +738,15 @@ NS_ASSUME_NONNULL_BEGIN
 - (NSOperationQueue *)operationQueueWithConfiguration:(NSURLSessionConfiguration *)configuration;
 
 /**
- @brief  Construct NSURL session manager used to communicate with \b PubNub network.
+ @brief  Construct NSURL session based transport used to communicate with \b PubNub network.
  
  @param configuration Reference on complete configuration which should be applied to NSURL session.
  
- @return Constructed and ready to use NSURL session manager instance.
+ @return Constructed and ready to use NSURL session based transport instance.
  
  @since 4.0
  */
-- (NSURLSession *)sessionWithConfiguration:(NSURLSessionConfiguration *)configuration;
+- (id <PNTransport>)transportWithConfiguration:(NSURLSessionConfiguration *)configuration;
 
 /**
  @brief  Allow to construct base URL basing on network configuraiton.
@@ -472,9 +774,70 @@ NS_ASSUME_NONNULL_BEGIN
  
  @since 4.0
  */
-- (void)handleData:(nullable NSData *)data loadedWithTask:(nullable NSURLSessionDataTask *)task
-             error:(nullable NSError *)requestError usingSuccess:(NSURLSessionDataTaskSuccess)success
-           failure:(NSURLSessionDataTaskFailure)failure;
+- (void)handleData:(nullable NSData *)data loadedWithTask:(nullable id <PNTransportTask>)task
+             error:(nullable NSError *)requestError usingSuccess:(PNTransportTaskSuccess)success
+           failure:(PNTransportTaskFailure)failure;
+
+/**
+ @brief      Complete processing of response which has been parsed while it has been received.
+ @discussion Response metadata verified in same way as for non-streamed response and if it has been
+             rejected, \c errorData (received instead of events) will be passed with error to \c failure
+             block.
+ 
+ @param parser       Reference on parser which processed response body.
+ @param errorData    Reference on response body which has been received with non-200 status code.
+ @param task         Reference on data task which has been used to communicate with \b PubNub network.
+ @param requestError Reference on request processing error.
+ @param success      Reference on data task success handling block which will be called by network manager.
+ @param failure      Reference on data task processing failure handling block which will be called by network 
+                     manager.
+ 
+ @since 4.8.2
+ */
+- (void)handleStreamParser:(PNSubscribeStreamParser *)parser errorData:(NSData *)errorData
+            loadedWithTask:(nullable id <PNTransportTask>)task error:(nullable NSError *)requestError
+              usingSuccess:(PNTransportTaskSuccess)success failure:(PNTransportTaskFailure)failure;
+
+/**
+ @brief      Uncompress response body if it has been compressed by \b PubNub network.
+ @discussion Response body passed as-is if it isn't GZIP stream (for example if it already has been
+             uncompressed by \c NSURLSession).
+ 
+ @param data          Reference on response body which has been received from \b PubNub network.
+ @param operationType One of \b PNOperationType enum fields which describe for which operation response has
+                      been received.
+ @param error         Reference on storage for uncompression error.
+ 
+ @return Uncompressed response body or \c nil in case if it can't be uncompressed.
+ 
+ @since 4.8.2
+ */
+- (nullable NSData *)inflatedData:(nullable NSData *)data receivedForOperation:(PNOperationType)operationType
+                            error:(NSError **)error;
+
+/**
+ @brief  Report response body compression ratio to telemetry.
+ 
+ @param length         Number of compressed bytes which has been received from \b PubNub network.
+ @param inflatedLength Number of bytes which has been produced from compressed response body.
+ @param operationType  One of \b PNOperationType enum fields which describe for which operation response has
+                       been received.
+ 
+ @since 4.8.2
+ */
+- (void)trackCompressedResponseLength:(NSUInteger)length inflatedLength:(NSUInteger)inflatedLength
+                         forOperation:(PNOperationType)operationType;
+
+/**
+ @brief  Create error which describe response body uncompression failure.
+ 
+ @param task Reference on data task which received compressed response body.
+ 
+ @return Error with \c NSURLErrorCannotDecodeContentData code.
+ 
+ @since 4.8.2
+ */
+- (NSError *)inflationErrorForTask:(nullable id <PNTransportTask>)task;
 
 /**
  @brief      Handle successful operation processing completion.
@@ -489,7 +852,7 @@ NS_ASSUME_NONNULL_BEGIN
  
  @since 4.0
  */
-- (void)handleOperation:(PNOperationType)operation taskDidComplete:(nullable NSURLSessionDataTask *)task
+- (void)handleOperation:(PNOperationType)operation taskDidComplete:(nullable id <PNTransportTask>)task
                withData:(nullable id)responseObject completionBlock:(id)block;
 
 /**
@@ -506,7 +869,7 @@ NS_ASSUME_NONNULL_BEGIN
  
  @since 4.0
  */
-- (void)handleOperation:(PNOperationType)operation taskDidFail:(nullable NSURLSessionDataTask *)task
+- (void)handleOperation:(PNOperationType)operation taskDidFail:(nullable id <PNTransportTask>)task
               withError:(nullable NSError *)error completionBlock:(id)block;
 
 /**
@@ -523,7 +886,7 @@ NS_ASSUME_NONNULL_BEGIN
  
  @since 4.0
  */
-- (void)handleParsedData:(nullable NSDictionary *)data loadedWithTask:(nullable NSURLSessionDataTask *)task
+- (void)handleParsedData:(nullable NSDictionary *)data loadedWithTask:(nullable id <PNTransportTask>)task
             forOperation:(PNOperationType)operation parsedAsError:(BOOL)isError
          processingError:(nullable NSError *)error completionBlock:(id)block;
 
@@ -541,6 +904,59 @@ NS_ASSUME_NONNULL_BEGIN
 - (void)handleOperation:(PNOperationType)operation processingCompletedWithResult:(nullable PNResult *)result
                  status:(nullable PNStatus *)status completionBlock:(id)block;
 
+/**
+ @brief  Complete API call which has been cancelled by user or which \c deadline passed before request
+         sending.
+
+ @param operation One of \b PNOperationType enum fields which describe operation type.
+ @param handle    Reference on handle which has been used to abandon API call.
+ @param block     Depending on operation type it can be \b PNResultBlock, \b PNStatusBlock or
+                  \b PNCompletionBlock blocks.
+
+ @since 4.8.2
+ */
+- (void)handleOperation:(PNOperationType)operation abandonedWithHandle:(PNRequestHandle *)handle
+        completionBlock:(id)block;
+
+/**
+ @brief  Compose status for API call which has been cancelled by user or which \c deadline passed.
+ 
+ @param operation One of \b PNOperationType enum fields which describe operation type.
+ @param handle    Reference on handle which has been used to abandon API call.
+ 
+ @return Error status with \b PNCancelledCategory or \b PNTimeoutCategory category.
+ 
+ @since 4.8.2
+ */
+- (PNErrorStatus *)statusForOperation:(PNOperationType)operation abandonedWithHandle:(PNRequestHandle *)handle;
+
+/**
+ @brief      Complete API call right away when user cancel it while it wait for shared request results.
+ @discussion Shared request's tasks cancelled when there is no other callers.
+ 
+ @param handle    Reference on handle which allow user to cancel API call.
+ @param request   Reference on shared request which results API call wait for.
+ @param key       Reference on key which identify request (\c nil for request which won't be coalesced).
+ @param operation One of \b PNOperationType enum fields which describe operation type.
+ 
+ @since 4.8.2
+ */
+- (void)trackCancellationWithHandle:(nullable PNRequestHandle *)handle ofSharedRequest:(PNSharedRequest *)request
+                            withKey:(nullable NSString *)key forOperation:(PNOperationType)operation;
+
+/**
+ @brief  Complete API call which has been cancelled by user while it wait for shared request results.
+ 
+ @param handle    Reference on handle which has been used to cancel API call.
+ @param request   Reference on shared request which results API call wait for.
+ @param key       Reference on key which identify request (\c nil for request which won't be coalesced).
+ @param operation One of \b PNOperationType enum fields which describe operation type.
+ 
+ @since 4.8.2
+ */
+- (void)handleCancellationWithHandle:(PNRequestHandle *)handle ofSharedRequest:(PNSharedRequest *)request
+                             withKey:(nullable NSString *)key forOperation:(PNOperationType)operation;
+
 
 #pragma mark - Misc
 
@@ -557,7 +973,7 @@ NS_ASSUME_NONNULL_BEGIN
  
  @return \c YES in case if \c operation has been found in list of passed \c tasks.
  */
-- (BOOL)hasOperation:(PNOperationType)operation inDataTasks:(NSArray<NSURLSessionDataTask *> *)tasks;
+- (BOOL)hasOperation:(PNOperationType)operation inDataTasks:(NSArray<id <PNTransportTask>> *)tasks;
 
 /**
  @brief  Depending on current network manager state it may require to complete currently active tasks 
@@ -612,21 +1028,62 @@ NS_ASSUME_NONNULL_END
 + (instancetype)networkForClient:(PubNub *)client requestTimeout:(NSTimeInterval)timeout
               maximumConnections:(NSInteger)maximumConnections longPoll:(BOOL)longPollEnabled {
     
+    return [self networkForClient:client requestTimeout:timeout maximumConnections:maximumConnections
+                         longPoll:longPollEnabled transport:nil];
+}
+
++ (instancetype)networkForClient:(PubNub *)client requestTimeout:(NSTimeInterval)timeout
+              maximumConnections:(NSInteger)maximumConnections longPoll:(BOOL)longPollEnabled
+                       transport:(id <PNTransport>)transport {
+    
     return [[self alloc] initForClient:client requestTimeout:timeout maximumConnections:maximumConnections 
-                              longPoll:longPollEnabled];
+                              longPoll:longPollEnabled transport:transport];
 }
 
 - (instancetype)initForClient:(PubNub *)client requestTimeout:(NSTimeInterval)timeout
-           maximumConnections:(NSInteger)maximumConnections longPoll:(BOOL)longPollEnabled {
+           maximumConnections:(NSInteger)maximumConnections longPoll:(BOOL)longPollEnabled
+                    transport:(id <PNTransport>)transport {
     
     // Check whether initialization was successful or not.
     if ((self = [super init])) {
         
         _client = client;
         [_client.logger enableLogLevel:(PNRequestLogLevel|PNInfoLogLevel)];
-        _metricsNotSupportedByOS = pn_operating_system_version_is_lower_than(PN_URLSESSION_TRANSACTION_METRICS_AVAILABLE_SINCE);
         _configuration = client.configuration;
         _forLongPollRequests = longPollEnabled;
+        _transport = transport;
+        _usesCustomTransport = transport != nil;
+        _usesSharedTransport = !_usesCustomTransport && _configuration.shouldUseSharedTransport;
+        if (@available(macOS 10.10, iOS 8.0, *)) {
+            if (_configuration.applicationExtensionSharedGroupIdentifier) { _usesSharedTransport = NO; }
+        }
+        
+        // Custom and shared transports doesn't provide NSURLSession metrics, so latency should be measured 
+        // manually.
+        _metricsNotSupportedByOS = (_usesCustomTransport || _usesSharedTransport ||
+                                    pn_operating_system_version_is_lower_than(PN_URLSESSION_TRANSACTION_METRICS_AVAILABLE_SINCE));
+        if (!longPollEnabled) {
+            
+            _scheduler = [PNRequestScheduler schedulerWithMaximumActiveTasks:(NSUInteger)maximumConnections
+                                                                      limits:_configuration.concurrentRequestsLimits];
+            if (@available(macOS 10.10, iOS 8.0, *)) {
+                if (_configuration.applicationExtensionSharedGroupIdentifier) { _scheduler = nil; }
+            }
+            
+            if (_configuration.responseCacheTimeToLive.count) {
+                _responseCache = [PNResponseCache cacheWithTimeToLive:_configuration.responseCacheTimeToLive
+                                                         maximumCount:_configuration.maximumResponseCacheSize];
+            }
+            
+            if (_configuration.circuitBreakerFailureRateThreshold > 0) {
+                NSUInteger threshold = _configuration.circuitBreakerFailureRateThreshold;
+                NSUInteger minimumRequests = _configuration.circuitBreakerMinimumRequests;
+                
+                _circuitBreaker = [PNCircuitBreaker breakerWithFailureRateThreshold:threshold
+                                                                    minimumRequests:minimumRequests
+                                                                       openInterval:_configuration.circuitBreakerOpenInterval];
+            }
+        }
 #if TARGET_OS_IOS
         _scheduledDataTasks = [NSMutableArray new];
         _tasksCompletionIdentifier = UIBackgroundTaskInvalid;
@@ -643,6 +1100,9 @@ NS_ASSUME_NONNULL_END
         _dataTaskToOperationMap = [NSMutableDictionary new];
 #endif // PN_URLSESSION_TRANSACTION_METRICS_AVAILABLE
         _serializer = [PNNetworkResponseSerializer new];
+        _activeTasks = [NSMutableDictionary new];
+        _coalescedRequests = [NSMutableDictionary new];
+        _terminatedTaskIdentifiers = [NSMutableSet new];
         _baseURL = [self requestBaseURL];
 #pragma clang diagnostic push
 #pragma clang diagnostic ignored "-Wpartial-availability"
@@ -698,9 +1158,13 @@ NS_ASSUME_NONNULL_END
     httpRequest.HTTPMethod = method;
     pn_lock(&_lock, ^{
         
-        httpRequest.cachePolicy = self.session.configuration.requestCachePolicy;
-        httpRequest.allHTTPHeaderFields = self.session.configuration.HTTPAdditionalHeaders;
+        [self.transport prepareRequest:httpRequest];
     });
+    if (![httpRequest valueForHTTPHeaderField:@"Accept-Encoding"]) {
+        
+        // Custom transports may not request compressed responses on their own.
+        [httpRequest setValue:@"gzip" forHTTPHeaderField:@"Accept-Encoding"];
+    }
     if (postData) {
         
         NSMutableDictionary *allHeaders = [httpRequest.allHTTPHeaderFields mutableCopy];
@@ -715,20 +1179,26 @@ NS_ASSUME_NONNULL_END
     return [httpRequest copy];
 }
 
-- (NSURLSessionDataTask *)dataTaskWithRequest:(NSURLRequest *)request
-                                 forOperation:(PNOperationType)operationType
-                                      success:(NSURLSessionDataTaskSuccess)success
-                                      failure:(NSURLSessionDataTaskFailure)failure {
+- (id <PNTransportTask>)dataTaskWithRequest:(NSURLRequest *)request
+                               forOperation:(PNOperationType)operationType
+                                    success:(PNTransportTaskSuccess)success
+                                    failure:(PNTransportTaskFailure)failure {
     
-    __block NSURLSessionDataTask *task = nil;
+    __block id <PNTransportTask> task = nil;
     __weak __typeof(self) weakSelf = self;
-    NSURLSessionDataTaskCompletion handler = ^(NSData *data, NSURLResponse *response, NSError *error) {
+    PNTransportTaskCompletion handler = ^(NSData *data, NSURLResponse *response, NSError *error) {
         if (self.isMetricsNotSupportByOS) {
             NSString *taskIdentifier = [self.sessionIdentifier stringByAppendingString:@(task.taskIdentifier).stringValue];
             [weakSelf.client.telemetryManager stopLatencyMeasureFor:operationType withIdentifier:taskIdentifier];
         }
-
-        [weakSelf handleData:data loadedWithTask:task error:(error?: task.error)
+        [weakSelf unregisterTask:task forOperation:operationType];
+        [weakSelf.scheduler completeTask:task];
+
+        NSError *inflationError = nil;
+        NSError *requestError = ([weakSelf watchdogErrorForTask:task] ?: error ?: task.error);
+        NSData *inflatedData = [weakSelf inflatedData:data receivedForOperation:operationType
+                                                error:&inflationError];
+        [weakSelf handleData:inflatedData loadedWithTask:task error:(requestError ?: inflationError)
                 usingSuccess:success failure:failure];
     };
     pn_lock(&_lock, ^{
@@ -741,9 +1211,9 @@ NS_ASSUME_NONNULL_END
         if (isApplicationExtension) {
             self.previousDataTaskCompletionHandler = handler;
             self.fetchedData = [NSMutableData new];
-            task = [self.session dataTaskWithRequest:request];
+            task = [self.transport taskWithRequest:request completion:nil];
         }
-        else { task = [self.session dataTaskWithRequest:request completionHandler:[handler copy]]; }
+        else { task = [self.transport taskWithRequest:request completion:[handler copy]]; }
         
 #if TARGET_OS_IOS
         if (self.configuration.applicationExtensionSharedGroupIdentifier == nil && 
@@ -757,29 +1227,156 @@ NS_ASSUME_NONNULL_END
     return task;
 }
 
-
-#pragma mark - Request processing
-
-- (BOOL)operationExpectResult:(PNOperationType)operation {
+- (id <PNTransportTask>)streamingDataTaskWithRequest:(NSURLRequest *)request
+                                        forOperation:(PNOperationType)operationType
+                                             success:(PNTransportTaskSuccess)success
+                                             failure:(PNTransportTaskFailure)failure {
     
-    static NSArray *_resultExpectingOperations;
-    static dispatch_once_t onceToken;
-    dispatch_once(&onceToken, ^{
+    __block id <PNTransportTask> task = nil;
+    __weak __typeof(self) weakSelf = self;
+    PNSubscribeStreamParser *parser = [PNSubscribeStreamParser parserWithAdditionalData:[self additionalParserData]
+                                                                      maximumBufferSize:kPNMaximumStreamedEventSize];
+    NSMutableData *errorData = [NSMutableData new];
+    PNGZIP *inflater = [PNGZIP inflater];
+    void(^appendData)(NSData *) = ^(NSData *data) {
         
-        _resultExpectingOperations = @[
-                   @(PNHistoryOperation), @(PNHistoryForChannelsOperation), @(PNWhereNowOperation), 
-                   @(PNHereNowGlobalOperation), @(PNHereNowForChannelOperation), 
-                   @(PNHereNowForChannelGroupOperation), @(PNStateForChannelOperation), 
-                   @(PNStateForChannelGroupOperation), @(PNChannelGroupsOperation), 
-                   @(PNChannelsForGroupOperation), @(PNPushNotificationEnabledChannelsOperation), 
-                   @(PNTimeOperation)];
+        // Service error responses passed to error parser as-is.
+        if (!data.length) { return; }
+        if (((NSHTTPURLResponse *)task.response).statusCode == 200) { [parser appendData:data]; }
+        else { [errorData appendData:data]; }
+    };
+    PNTransportTaskDataHandler dataHandler = ^(NSData *data) {
+        
+        [weakSelf trackReadActivity];
+        appendData([inflater inflateData:data]);
+    };
+    PNTransportTaskCompletion handler = ^(NSData *data, NSURLResponse *response, NSError *error) {
+        if (self.isMetricsNotSupportByOS) {
+            NSString *taskIdentifier = [self.sessionIdentifier stringByAppendingString:@(task.taskIdentifier).stringValue];
+            [weakSelf.client.telemetryManager stopLatencyMeasureFor:operationType withIdentifier:taskIdentifier];
+        }
+        [weakSelf unregisterTask:task forOperation:operationType];
+        
+        NSData *pendingData = [inflater finish];
+        appendData(pendingData);
+        if (inflater.isCompressed) {
+            [weakSelf trackCompressedResponseLength:inflater.compressedLength
+                                     inflatedLength:inflater.inflatedLength forOperation:operationType];
+        }
+        
+        NSError *inflationError = (!pendingData ? [weakSelf inflationErrorForTask:task] : nil);
+        NSError *requestError = ([weakSelf watchdogErrorForTask:task] ?: error ?: task.error);
+        [weakSelf handleStreamParser:parser errorData:errorData loadedWithTask:task
+                               error:(requestError ?: inflationError) usingSuccess:success failure:failure];
+    };
+    pn_lock(&_lock, ^{
+        
+        task = [self.transport taskWithRequest:request dataHandler:dataHandler completion:[handler copy]];
+#if TARGET_OS_IOS
+        if (self.configuration.shouldCompleteRequestsBeforeSuspension) { [self.scheduledDataTasks addObject:task]; }
+#endif // TARGET_OS_IOS
     });
     
-    return [_resultExpectingOperations containsObject:@(operation)];
+    return task;
 }
 
-- (Class <PNParser>)parserForOperation:(PNOperationType)operation {
-    
+
+#pragma mark - Request processing
+
+- (void)registerTask:(id <PNTransportTask>)task forOperation:(PNOperationType)operation {
+    
+    if (!task) { return; }
+    
+    pn_lock(&_lock, ^{
+        
+        NSMutableDictionary<NSNumber *, id <PNTransportTask>> *tasks = self->_activeTasks[@(operation)];
+        if (!tasks) {
+            
+            tasks = [NSMutableDictionary new];
+            self->_activeTasks[@(operation)] = tasks;
+        }
+        tasks[@(task.taskIdentifier)] = task;
+    });
+}
+
+- (void)unregisterTask:(id <PNTransportTask>)task forOperation:(PNOperationType)operation {
+    
+    pn_lock(&_lock, ^{ [self->_activeTasks[@(operation)] removeObjectForKey:@(task.taskIdentifier)]; });
+}
+
+- (NSString *)coalescingKeyForOperation:(PNOperationType)operationType
+                         withParameters:(PNRequestParameters *)parameters {
+    
+    if (![PNResponseCache isIdempotentReadOperation:operationType]) { return nil; }
+    
+    [self appendRequiredParametersTo:parameters];
+    NSURL *requestURL = [PNURLBuilder URLForOperation:operationType withParameters:parameters];
+    
+    return (requestURL ? [PNResponseCache keyForOperation:operationType URL:requestURL] : nil);
+}
+
+- (PNSharedRequest *)attachCompletionBlock:(PNCompletionBlock)block withHandle:(PNRequestHandle *)handle
+                          toRequestWithKey:(NSString *)key forOperation:(PNOperationType)operation {
+    
+    __block PNSharedRequest *request = nil;
+    __block BOOL attached = NO;
+    pn_lock(&_lock, ^{
+        
+        // Request which has been cancelled by all callers can't be shared anymore.
+        request = self->_coalescedRequests[key];
+        attached = (request != nil && !request.isCancelled);
+        if (!attached) {
+            
+            request = [PNSharedRequest new];
+            self->_coalescedRequests[key] = request;
+        }
+        [request addCompletionBlock:block forHandle:handle];
+    });
+    [self trackCancellationWithHandle:handle ofSharedRequest:request withKey:key forOperation:operation];
+    
+    return (attached ? nil : request);
+}
+
+- (PNCompletionBlock)completionBlockForSharedRequest:(PNSharedRequest *)request withKey:(NSString *)key {
+    
+    __weak __typeof(self) weakSelf = self;
+    
+    return ^(PNResult *result, PNStatus *status) {
+        
+        __strong __typeof(weakSelf) strongSelf = weakSelf;
+        if (strongSelf && key) {
+            pn_lock(&strongSelf->_lock, ^{
+                
+                if (strongSelf->_coalescedRequests[key] == request) {
+                    [strongSelf->_coalescedRequests removeObjectForKey:key];
+                }
+            });
+        }
+        
+        for (PNCompletionBlock block in [request complete]) { block(result, status); }
+    };
+}
+
+- (BOOL)operationExpectResult:(PNOperationType)operation {
+    
+    static NSArray *_resultExpectingOperations;
+    static dispatch_once_t onceToken;
+    dispatch_once(&onceToken, ^{
+        
+        _resultExpectingOperations = @[
+                   @(PNHistoryOperation), @(PNHistoryForChannelsOperation), @(PNWhereNowOperation), 
+                   @(PNHereNowGlobalOperation), @(PNHereNowForChannelOperation), 
+                   @(PNHereNowForChannelGroupOperation), @(PNStateForChannelOperation), 
+                   @(PNStateForChannelGroupOperation), @(PNChannelGroupsOperation), 
+                   @(PNChannelsForGroupOperation), @(PNPushNotificationEnabledChannelsOperation), 
+                   @(PNTimeOperation)];
+    });
+    
+    return [_resultExpectingOperations containsObject:@(operation)];
+}
+
+- (Class <PNParser>)parserForOperation:(PNOperationType)operation {
+    
     static NSDictionary *_parsers;
     static dispatch_once_t onceToken;
     dispatch_once(&onceToken, ^{
@@ -826,39 +1423,130 @@ NS_ASSUME_NONNULL_END
     return class;
 }
 
-- (void)processOperation:(PNOperationType)operationType withParameters:(PNRequestParameters *)parameters 
-                    data:(NSData *)data completionBlock:(id)block {
+- (PNRequestHandle *)processOperation:(PNOperationType)operationType
+                       withParameters:(PNRequestParameters *)parameters data:(NSData *)data
+                      completionBlock:(id)block {
+    
+    PNRequestHandle *handle = parameters.handle;
+    handle.operation = operationType;
+    // Cancelled API call shouldn't stop request which is shared with identical API calls.
+    if (handle.isAbandoned && !parameters.sharedRequest) {
+        
+        [self handleOperation:operationType abandonedWithHandle:handle completionBlock:block];
+        
+        return handle;
+    }
+    
+    // There is no API callers which wait for shared request results anymore.
+    if (parameters.sharedRequest.isCancelled) { return handle; }
     
     [self appendRequiredParametersTo:parameters];
     NSURL *requestURL = [PNURLBuilder URLForOperation:operationType withParameters:parameters];
     if (requestURL) {
         
+        __weak __typeof(self) weakSelf = self;
+        [self.responseCache invalidateResultsAffectedByOperation:operationType];
+        if (!parameters.isFreshResponseRequired && [self.responseCache canCacheOperation:operationType]) {
+            
+            PNResult *cachedResult = [self.responseCache resultForOperation:operationType URL:requestURL];
+            [self.client.telemetryManager incrementMetric:(cachedResult ? @"cache.hits" : @"cache.misses") by:1];
+            if (cachedResult) {
+                
+                PNLogRequest(self.client.logger, @"<PubNub::Network> %@ %@ (cached)", parameters.HTTPMethod,
+                             requestURL.absoluteString);
+                pn_dispatch_async(self.processingQueue, ^{
+                    
+                    [weakSelf handleOperation:operationType processingCompletedWithResult:cachedResult status:nil
+                              completionBlock:block];
+                });
+                
+                return handle;
+            }
+        }
+        
+        // API calls with deadline own single task in flight, so request timeout can be limited by deadline.
+        // Service ping should own single task as well, so it will fail while network is down.
+        BOOL isShareable = (block && !handle.deadline && !parameters.isFreshResponseRequired);
+        PNSharedRequest *sharedRequest = parameters.sharedRequest;
+        if (isShareable && !sharedRequest && [PNResponseCache isIdempotentReadOperation:operationType]) {
+            
+            NSString *requestKey = [PNResponseCache keyForOperation:operationType URL:requestURL];
+            sharedRequest = [self attachCompletionBlock:block withHandle:handle toRequestWithKey:requestKey
+                                           forOperation:operationType];
+            if (!sharedRequest) {
+                
+                PNLogRequest(self.client.logger, @"<PubNub::Network> %@ %@ (attached to in-flight request)",
+                             parameters.HTTPMethod, requestURL.absoluteString);
+                [self.client.telemetryManager incrementMetric:@"requests.coalesced" by:1];
+                
+                return handle;
+            }
+            block = [self completionBlockForSharedRequest:sharedRequest withKey:requestKey];
+        }
+        
+        NSString *endpoint = [self.client.telemetryManager endpointNameForOperation:operationType];
+        if (self.circuitBreaker && ![self.circuitBreaker allowRequestForEndpoint:endpoint]) {
+            
+            PNLogRequest(self.client.logger, @"<PubNub::Network> %@ %@ (rejected: '%@' endpoint degraded)",
+                         parameters.HTTPMethod, requestURL.absoluteString, endpoint);
+            [self.client.telemetryManager incrementMetric:@"circuit.rejected" by:1];
+            PNErrorStatus *degradedStatus = [PNErrorStatus statusForOperation:operationType
+                                                                     category:PNServiceDegradedCategory
+                                                          withProcessingError:nil];
+            pn_dispatch_async(self.processingQueue, ^{
+                
+                [weakSelf handleOperation:operationType processingCompletedWithResult:nil
+                                   status:degradedStatus completionBlock:block];
+            });
+            
+            return handle;
+        }
+        
         PNLogRequest(self.client.logger, @"<PubNub::Network> %@ %@", parameters.HTTPMethod,
                      requestURL.absoluteString);
         
-        __weak __typeof(self) weakSelf = self;
         NSURLRequest *request = [self requestWithURL:requestURL method:parameters.HTTPMethod data:data];
-        NSURLSessionDataTask *task = [self dataTaskWithRequest:request forOperation:operationType
-                                                       success:^(NSURLSessionDataTask *completedTask,
-                                                                 id responseObject) {
-                                                           
-            [weakSelf handleOperation:operationType taskDidComplete:completedTask withData:responseObject
-                      completionBlock:block];
+        NSTimeInterval timeout = [self adaptiveTimeoutForOperation:operationType];
+        if (handle.deadline) {
+            
+            // Request shouldn't wait for response longer than API caller.
+            NSTimeInterval timeLeft = MAX([handle.deadline timeIntervalSinceNow], 0.001f);
+            timeout = MIN((timeout > 0.f ? timeout : self.requestTimeout), timeLeft);
         }
-                                                       failure:^(NSURLSessionDataTask *failedTask, id error) {
-
-            [weakSelf handleOperation:operationType taskDidFail:failedTask withError:error
-                      completionBlock:block];
-        }];
-        NSString *taskIdentifier = [self.sessionIdentifier stringByAppendingString:@(task.taskIdentifier).stringValue];
-        if (self.isMetricsNotSupportByOS) {
-            [self.client.telemetryManager startLatencyMeasureFor:operationType withIdentifier:taskIdentifier];
-        } else {
-#if PN_URLSESSION_TRANSACTION_METRICS_AVAILABLE
-            pn_lock(&_lock, ^{ self.dataTaskToOperationMap[taskIdentifier] = @(operationType); });
-#endif
+        if (timeout > 0.f) {
+            
+            NSMutableURLRequest *timedRequest = [request mutableCopy];
+            timedRequest.timeoutInterval = timeout;
+            request = [timedRequest copy];
+        }
+        NSTimeInterval hedgeDelay = (isShareable ? [self hedgeDelayForOperation:operationType] : -1.f);
+        PNRequestHedge *hedge = (hedgeDelay > 0.f ? [PNRequestHedge new] : nil);
+        if (hedge && handle && !sharedRequest) {
+            
+            // Cancelled API call should stop all hedged attempts.
+            sharedRequest = [PNSharedRequest new];
+            [sharedRequest addCompletionBlock:block forHandle:handle];
+            [self trackCancellationWithHandle:handle ofSharedRequest:sharedRequest withKey:nil
+                                 forOperation:operationType];
+            block = [self completionBlockForSharedRequest:sharedRequest withKey:nil];
+        }
+        
+        // Handle can't cancel task which is shared with other API calls or hedged request attempts.
+        PNRequestHandle *taskHandle = (sharedRequest ? nil : handle);
+        id taskBlock = (hedge ? [self completionBlock:block forAttempt:0 ofHedge:hedge] : block);
+        id <PNTransportTask> task = [self taskForOperation:operationType withRequest:request handle:taskHandle
+                                           completionBlock:taskBlock];
+        [hedge addTask:task];
+        if (hedge) { [sharedRequest addHedge:hedge]; }
+        else { [sharedRequest addTask:task]; }
+        if (taskHandle) { [taskHandle attachTask:task]; }
+        else if (!handle) { handle = [PNRequestHandle handleForOperation:operationType task:task]; }
+        [self startTask:task forOperation:operationType];
+        
+        if (hedge) {
+            [self scheduleHedgeForOperation:operationType withRequest:request hedge:hedge delay:hedgeDelay
+                            completionBlock:block];
         }
-        [task resume];
     }
     else {
         
@@ -875,6 +1563,155 @@ NS_ASSUME_NONNULL_END
             else { ((PNStatusBlock)block)(badRequestStatus); }
         }
     }
+    
+    return handle;
+}
+
+- (id <PNTransportTask>)taskForOperation:(PNOperationType)operationType withRequest:(NSURLRequest *)request
+                                  handle:(PNRequestHandle *)handle completionBlock:(id)block {
+    
+    __weak __typeof(self) weakSelf = self;
+    PNTransportTaskFailure failure = ^(id <PNTransportTask> failedTask, id error) {
+        
+        // Request timeout can be limited by API call deadline, so such timeout doesn't describe endpoint health.
+        if (handle.isExpired && ((NSError *)error).code == NSURLErrorTimedOut) { error = handle.abandonmentError; }
+        [weakSelf handleOperation:operationType taskDidFail:failedTask withError:error completionBlock:block];
+    };
+    BOOL(^abandoned)(id <PNTransportTask>) = ^BOOL(id <PNTransportTask> completedTask) {
+        
+        if (!handle.isAbandoned) { return NO; }
+        
+        // Don't spend time on response parsing if API caller not interested in it anymore.
+        [weakSelf.client.telemetryManager incrementMetric:@"requests.abandoned" by:1];
+        [weakSelf handleParsedData:nil loadedWithTask:completedTask forOperation:operationType
+                     parsedAsError:YES processingError:handle.abandonmentError completionBlock:block];
+        
+        return YES;
+    };
+    id <PNTransportTask> task = nil;
+    if ([self shouldStreamResponseForOperation:operationType]) {
+        
+        task = [self streamingDataTaskWithRequest:request forOperation:operationType
+                                          success:^(id <PNTransportTask> completedTask, id parsedData) {
+            
+            if (abandoned(completedTask)) { return; }
+            [weakSelf handleParsedData:parsedData loadedWithTask:completedTask forOperation:operationType
+                         parsedAsError:NO processingError:nil completionBlock:block];
+        }
+                                          failure:failure];
+    }
+    else {
+        
+        task = [self dataTaskWithRequest:request forOperation:operationType
+                                 success:^(id <PNTransportTask> completedTask, id responseObject) {
+                                                       
+            if (abandoned(completedTask)) { return; }
+            [weakSelf handleOperation:operationType taskDidComplete:completedTask withData:responseObject
+                      completionBlock:block];
+        }
+                                 failure:failure];
+    }
+    NSString *taskIdentifier = [self.sessionIdentifier stringByAppendingString:@(task.taskIdentifier).stringValue];
+    if (self.isMetricsNotSupportByOS) {
+        [self.client.telemetryManager startLatencyMeasureFor:operationType withIdentifier:taskIdentifier];
+    } else {
+#if PN_URLSESSION_TRANSACTION_METRICS_AVAILABLE
+        pn_lock(&_lock, ^{ self.dataTaskToOperationMap[taskIdentifier] = @(operationType); });
+#endif
+    }
+    [self registerTask:task forOperation:operationType];
+    
+    return task;
+}
+
+- (void)startTask:(id <PNTransportTask>)task forOperation:(PNOperationType)operationType {
+    
+    if (operationType == PNSubscribeOperation) { [self startWatchdogIfRequired]; }
+    if (self.scheduler) {
+        [self.scheduler scheduleTask:task withPriority:[PNRequestScheduler priorityForOperation:operationType]];
+    }
+    else { [task resume]; }
+}
+
+- (NSTimeInterval)adaptiveTimeoutForOperation:(PNOperationType)operationType {
+    
+    if (!self.configuration.shouldAdaptRequestTimeout || self.forLongPollRequests) { return -1.f; }
+    
+    NSTimeInterval timeout = self.requestTimeout;
+    NSTimeInterval latency = [self.client.telemetryManager latencyPercentile:99.f forOperation:operationType];
+    if (latency > 0.f) {
+        
+        timeout = latency * self.configuration.adaptiveRequestTimeoutFactor;
+        timeout = MIN(MAX(timeout, self.configuration.minimumRequestTimeout),
+                      self.configuration.maximumRequestTimeout);
+    }
+    
+    return timeout;
+}
+
+- (NSTimeInterval)hedgeDelayForOperation:(PNOperationType)operationType {
+    
+    BOOL isReadOperation = ([PNResponseCache isIdempotentReadOperation:operationType] ||
+                            operationType == PNHistoryOperation || operationType == PNHistoryForChannelsOperation);
+    if (!self.configuration.shouldHedgeReadRequests || self.forLongPollRequests || !isReadOperation) {
+        return -1.f;
+    }
+    
+    pn_lock(&_lock, ^{ self->_hedgeEligibleRequestsCount++; });
+    
+    return [self.client.telemetryManager latencyPercentile:95.f forOperation:operationType];
+}
+
+- (void)scheduleHedgeForOperation:(PNOperationType)operationType withRequest:(NSURLRequest *)request
+                            hedge:(PNRequestHedge *)hedge delay:(NSTimeInterval)delay
+                  completionBlock:(PNCompletionBlock)block {
+    
+    __weak __typeof(self) weakSelf = self;
+    dispatch_after(dispatch_time(DISPATCH_TIME_NOW, (int64_t)(delay * NSEC_PER_SEC)), self.processingQueue, ^{
+        
+        __strong __typeof(weakSelf) strongSelf = weakSelf;
+        if (!strongSelf || hedge.isCompleted) { return; }
+        
+        __block BOOL withinBudget = NO;
+        NSUInteger percentage = strongSelf.configuration.hedgeBudgetPercentage;
+        pn_lock(&strongSelf->_lock, ^{
+            
+            NSUInteger limit = strongSelf->_hedgeEligibleRequestsCount * percentage;
+            withinBudget = ((strongSelf->_hedgedRequestsCount + 1) * 100 <= limit);
+            if (withinBudget) { strongSelf->_hedgedRequestsCount++; }
+        });
+        
+        if (!withinBudget) {
+            
+            [strongSelf.client.telemetryManager incrementMetric:@"hedge.budgetExhausted" by:1];
+            return;
+        }
+        
+        PNLogRequest(strongSelf.client.logger, @"<PubNub::Network> %@ %@ (hedged after %.3f seconds)",
+                     request.HTTPMethod, request.URL.absoluteString, delay);
+        id <PNTransportTask> task = [strongSelf taskForOperation:operationType withRequest:request handle:nil
+                                                 completionBlock:[strongSelf completionBlock:block forAttempt:1
+                                                                                     ofHedge:hedge]];
+        if ([hedge addTask:task]) {
+            
+            [strongSelf.client.telemetryManager incrementMetric:@"hedge.requests" by:1];
+            [strongSelf startTask:task forOperation:operationType];
+        }
+    });
+}
+
+- (PNCompletionBlock)completionBlock:(PNCompletionBlock)block forAttempt:(NSUInteger)attempt
+                             ofHedge:(PNRequestHedge *)hedge {
+    
+    __weak __typeof(self) weakSelf = self;
+    
+    return ^(PNResult *result, PNStatus *status) {
+        
+        if (![hedge shouldCompleteAttempt:attempt withStatus:status]) { return; }
+        if (attempt > 0) { [weakSelf.client.telemetryManager incrementMetric:@"hedge.wins" by:1]; }
+        
+        block(result, status);
+    };
 }
 
 - (void)parseData:(id)data withParser:(Class <PNParser>)parser 
@@ -898,15 +1735,7 @@ NS_ASSUME_NONNULL_END
     }
     else {
 
-        NSMutableDictionary *additionalData = [NSMutableDictionary new];
-#pragma clang diagnostic push
-#pragma clang diagnostic ignored "-Wdeprecated-declarations"
-        additionalData[@"stripMobilePayload"] = @(self.configuration.shouldStripMobilePayload);
-#pragma clang diagnostic pop
-        if ([self.configuration.cipherKey length]) {
-
-            additionalData[@"cipherKey"] = self.configuration.cipherKey;
-        }
+        NSDictionary *additionalData = [self additionalParserData];
         
         // If additional data required client should assume what potentially additional calculations
         // may be required and should temporarily shift to background queue.
@@ -921,9 +1750,180 @@ NS_ASSUME_NONNULL_END
     }
 }
 
+- (BOOL)shouldStreamResponseForOperation:(PNOperationType)operation {
+    
+    BOOL isApplicationExtension = NO;
+    if (@available(macOS 10.10, iOS 8.0, *)) {
+        isApplicationExtension = self.configuration.applicationExtensionSharedGroupIdentifier != nil;
+    }
+    
+    return (operation == PNSubscribeOperation && self.configuration.shouldStreamSubscribeResponses &&
+            !isApplicationExtension &&
+            [self.transport respondsToSelector:@selector(taskWithRequest:dataHandler:completion:)]);
+}
+
+- (NSDictionary *)additionalParserData {
+    
+    NSMutableDictionary *additionalData = [NSMutableDictionary new];
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wdeprecated-declarations"
+    additionalData[@"stripMobilePayload"] = @(self.configuration.shouldStripMobilePayload);
+#pragma clang diagnostic pop
+    if ([self.configuration.cipherKey length]) {
+        
+        additionalData[@"cipherKey"] = self.configuration.cipherKey;
+    }
+    
+    return additionalData;
+}
+
+
+#pragma mark - Watchdog
+
+- (void)startWatchdogIfRequired {
+    
+    NSTimeInterval interval = self.configuration.subscribeWatchdogInterval;
+    if (!self.forLongPollRequests || interval <= 0.f) { return; }
+    
+    __weak __typeof(self) weakSelf = self;
+    pn_lock(&_lock, ^{
+        
+        self->_lastReadActivityDate = [NSDate date];
+        if (self->_watchdogTimer) { return; }
+        
+        // Check twice per interval, so idle connection noticed without big delay.
+        uint64_t checkInterval = (uint64_t)(interval * 0.5f * NSEC_PER_SEC);
+        dispatch_source_t timer = dispatch_source_create(DISPATCH_SOURCE_TYPE_TIMER, 0, 0,
+                                                         self->_processingQueue);
+        dispatch_source_set_event_handler(timer, ^{ [weakSelf handleWatchdogTimer]; });
+        dispatch_source_set_timer(timer, dispatch_time(DISPATCH_TIME_NOW, (int64_t)checkInterval), checkInterval,
+                                  checkInterval / 10);
+        self->_watchdogTimer = timer;
+        dispatch_resume(timer);
+    });
+}
+
+- (void)trackReadActivity {
+    
+    if (self.configuration.subscribeWatchdogInterval <= 0.f) { return; }
+    
+    pn_lock(&_lock, ^{ self->_lastReadActivityDate = [NSDate date]; });
+}
+
+- (void)handleWatchdogTimer {
+    
+    NSTimeInterval interval = self.configuration.subscribeWatchdogInterval;
+    __block NSTimeInterval idleTime = 0.f;
+    __block BOOL shouldProbe = NO;
+    pn_lock(&_lock, ^{
+        
+        // Watchdog not required while there is no active subscribe requests.
+        if (!self->_activeTasks[@(PNSubscribeOperation)].count) {
+            
+            if (self->_watchdogTimer) { dispatch_source_cancel(self->_watchdogTimer); }
+            self->_watchdogTimer = nil;
+            return;
+        }
+        
+        idleTime = -[self->_lastReadActivityDate timeIntervalSinceNow];
+        shouldProbe = (idleTime >= interval && !self->_watchdogProbeInFlight);
+        if (shouldProbe) { self->_watchdogProbeInFlight = YES; }
+    });
+    
+    if (shouldProbe) { [self sendWatchdogProbeAfterIdleTime:idleTime]; }
+}
+
+- (void)sendWatchdogProbeAfterIdleTime:(NSTimeInterval)idleTime {
+    
+    PNRequestParameters *parameters = [PNRequestParameters new];
+    [self appendRequiredParametersTo:parameters];
+    NSURL *requestURL = [PNURLBuilder URLForOperation:PNTimeOperation withParameters:parameters];
+    NSMutableURLRequest *request = [[self requestWithURL:requestURL method:parameters.HTTPMethod
+                                                    data:nil] mutableCopy];
+    request.timeoutInterval = self.configuration.subscribeWatchdogInterval;
+    
+    PNLogRequest(self.client.logger, @"<PubNub::Network> Subscribe request idle for %.3fs. Probe connection.",
+                 idleTime);
+    [self.client.telemetryManager incrementMetric:@"watchdog.probes" by:1];
+    __weak __typeof(self) weakSelf = self;
+    __block id <PNTransportTask> task = nil;
+    pn_lock(&_lock, ^{
+        
+        task = [self.transport taskWithRequest:[request copy] completion:^(NSData *data, NSURLResponse *response,
+                                                                           NSError *error) {
+            
+            [weakSelf handleWatchdogProbeCompletionWithError:error];
+        }];
+    });
+    
+    if (task) { [task resume]; }
+    else { pn_lock(&_lock, ^{ self->_watchdogProbeInFlight = NO; }); }
+}
+
+- (void)handleWatchdogProbeCompletionWithError:(NSError *)error {
+    
+    // Any response from service (even with error status code) mean that network path is alive.
+    BOOL isConnectionLost = (error != nil && error.code != NSURLErrorCancelled);
+    NSTimeInterval interval = self.configuration.subscribeWatchdogInterval;
+    __block NSTimeInterval idleTime = 0.f;
+    __block NSArray<id <PNTransportTask>> *tasks = nil;
+    pn_lock(&_lock, ^{
+        
+        self->_watchdogProbeInFlight = NO;
+        
+        // Long-poll connection may be silently dropped while probe reach service over separate connection,
+        // so it is alive only if data has been received while probe has been sent.
+        idleTime = -[self->_lastReadActivityDate timeIntervalSinceNow];
+        if (!isConnectionLost && idleTime < interval) { return; }
+        
+        tasks = self->_activeTasks[@(PNSubscribeOperation)].allValues;
+        for (id <PNTransportTask> task in tasks) {
+            [self->_terminatedTaskIdentifiers addObject:@(task.taskIdentifier)];
+        }
+    });
+    
+    if (tasks.count) {
+        
+        if (isConnectionLost) {
+            
+            PNLogRequest(self.client.logger, @"<PubNub::Network> Subscribe request connection lost (probe "
+                         "failed: %@). Restart subscription.", error.localizedDescription);
+        }
+        else {
+            
+            PNLogRequest(self.client.logger, @"<PubNub::Network> Subscribe request didn't receive data for "
+                         "%.3fs while network path is alive. Restart subscription.", idleTime);
+        }
+        [self.client.telemetryManager incrementMetric:@"watchdog.deadConnections" by:1];
+        [tasks makeObjectsPerformSelector:@selector(cancel)];
+    }
+}
+
+- (NSError *)watchdogErrorForTask:(id <PNTransportTask>)task {
+    
+    if (!self.forLongPollRequests || !task) { return nil; }
+    
+    __block BOOL terminated = NO;
+    pn_lock(&_lock, ^{
+        
+        NSNumber *identifier = @(task.taskIdentifier);
+        terminated = [self->_terminatedTaskIdentifiers containsObject:identifier];
+        [self->_terminatedTaskIdentifiers removeObject:identifier];
+    });
+    
+    if (!terminated) { return nil; }
+    
+    NSMutableDictionary *userInfo = [@{
+        NSLocalizedDescriptionKey: @"Subscribe request connection lost (no data received in watchdog interval)."
+    } mutableCopy];
+    if (task.originalRequest.URL) { userInfo[NSURLErrorFailingURLErrorKey] = task.originalRequest.URL; }
+    
+    return [NSError errorWithDomain:NSURLErrorDomain code:NSURLErrorNetworkConnectionLost userInfo:userInfo];
+}
+
 #if TARGET_OS_IOS
 
-- (void)processIncompleteBeforeClientResignActiveTasks:(NSArray<NSURLSessionDataTask *> *)dataTasks
+- (void)processIncompleteBeforeClientResignActiveTasks:(NSArray<id <PNTransportTask>> *)dataTasks
                                   onDataTaskCompletion:(BOOL)onCompletion {
     
     NSUInteger incompleteTasksCount = dataTasks.count;
@@ -951,7 +1951,8 @@ NS_ASSUME_NONNULL_END
 
 - (void)cancelAllOperationsWithURLPrefix:(NSString *)prefix {
     
-    pn_lock_async(&_lock, ^(dispatch_block_t complete) {
+    NSMutableArray<id <PNTransportTask>> *tasks = [NSMutableArray new];
+    pn_lock(&_lock, ^{
 #if TARGET_OS_IOS
         if (self.configuration.applicationExtensionSharedGroupIdentifier == nil && 
             self.configuration.shouldCompleteRequestsBeforeSuspension) {
@@ -960,32 +1961,82 @@ NS_ASSUME_NONNULL_END
         }
 #endif // TARGET_OS_IOS
         
-        [self.session getTasksWithCompletionHandler:^(NSArray *dataTasks, NSArray *uploadTasks,
-                                                      NSArray *downloadTasks) {
-            
-            if (prefix) {
-                for (NSURLSessionDataTask *dataTask in dataTasks) {
-                    if ([dataTask.originalRequest.URL.path hasPrefix:prefix]) { [dataTask cancel]; }
-                }
+        for (NSDictionary<NSNumber *, id <PNTransportTask>> *operationTasks in self->_activeTasks.allValues) {
+            for (id <PNTransportTask> task in operationTasks.allValues) {
+                if (!prefix || [task.originalRequest.URL.path hasPrefix:prefix]) { [tasks addObject:task]; }
             }
-            else { [dataTasks makeObjectsPerformSelector:@selector(cancel)]; }
-            complete();
-        }];
+        }
     });
+    
+    [tasks makeObjectsPerformSelector:@selector(cancel)];
+}
+
+- (void)cancelAllOperationsOfType:(PNOperationType)operationType {
+    
+    __block NSArray<id <PNTransportTask>> *tasks = nil;
+    pn_lock(&_lock, ^{ tasks = self->_activeTasks[@(operationType)].allValues; });
+    
+    [tasks makeObjectsPerformSelector:@selector(cancel)];
+}
+
+- (void)warmUpConnections {
+    
+    if (@available(macOS 10.10, iOS 8.0, *)) {
+        if (self.configuration.applicationExtensionSharedGroupIdentifier) { return; }
+    }
+    
+    PNRequestParameters *parameters = [PNRequestParameters new];
+    [self appendRequiredParametersTo:parameters];
+    NSURL *requestURL = [PNURLBuilder URLForOperation:PNTimeOperation withParameters:parameters];
+    NSURLRequest *request = [self requestWithURL:requestURL method:parameters.HTTPMethod data:nil];
+    NSInteger connectionsCount = (self.forLongPollRequests ? 1 : self.maximumConnections);
+    NSDate *startDate = [NSDate date];
+    
+    PNLogRequest(self.client.logger, @"<PubNub::Network> Warm up %@ connection(s) to %@",
+                 @(connectionsCount), self.configuration.origin);
+    __weak __typeof(self) weakSelf = self;
+    for (NSInteger connectionIdx = 0; connectionIdx < connectionsCount; connectionIdx++) {
+        
+        __block id <PNTransportTask> task = nil;
+        pn_lock(&_lock, ^{
+            
+            task = [self.transport taskWithRequest:request completion:^(NSData *data, NSURLResponse *response,
+                                                                        NSError *error) {
+                
+                PNLogRequest(weakSelf.client.logger, @"<PubNub::Network> Warm up request completed in %.3fs%@",
+                             -[startDate timeIntervalSinceNow], (error ? @" with error" : @""));
+            }];
+        });
+        [task resume];
+    }
 }
 
 - (void)invalidate {
     
+    [self cancelAllOperationsWithURLPrefix:nil];
     pn_lock(&_lock, ^{
         
-        [self->_session invalidateAndCancel];
-        self->_session = nil;
+        [self->_transport invalidate];
+        self->_transport = nil;
+        if (self->_watchdogTimer) {
+            
+            dispatch_source_cancel(self->_watchdogTimer);
+            self->_watchdogTimer = nil;
+        }
     });
 }
 
 
 #pragma mark - Operation information
 
+- (NSDictionary<NSString *, NSNumber *> *)metrics {
+    
+    NSMutableDictionary<NSString *, NSNumber *> *metrics = [([self.scheduler metrics] ?: @{}) mutableCopy];
+    [metrics addEntriesFromDictionary:([self.circuitBreaker metrics] ?: @{})];
+    
+    return [metrics copy];
+}
+
 - (NSInteger)packetSizeForOperation:(PNOperationType)operationType
                      withParameters:(PNRequestParameters *)parameters data:(NSData *)data {
     
@@ -1009,10 +2060,20 @@ NS_ASSUME_NONNULL_END
     
     _requestTimeout = timeout;
     _maximumConnections = maximumConnections;
-    NSURLSessionConfiguration *config = [self configurationWithRequestTimeout:timeout
+    
+    // Session's timeout should allow requests with adaptive timeout to wait longer.
+    NSTimeInterval sessionTimeout = timeout;
+    if (!self.forLongPollRequests && self.configuration.shouldAdaptRequestTimeout) {
+        sessionTimeout = MAX(timeout, self.configuration.maximumRequestTimeout);
+    }
+    NSURLSessionConfiguration *config = [self configurationWithRequestTimeout:sessionTimeout
                                                            maximumConnections:maximumConnections];
     _delegateQueue = [self operationQueueWithConfiguration:config];
-    _session = [self sessionWithConfiguration:config];
+    if (self.usesSharedTransport) {
+        _transport = [PNSharedURLSessionTransport transportForLongPollRequests:self.forLongPollRequests
+                                                                requestTimeout:sessionTimeout];
+    }
+    else if (!self.usesCustomTransport) { _transport = [self transportWithConfiguration:config]; }
     _sessionIdentifier = [[NSUUID UUID] UUIDString];
     [self printIfRequiredSessionCustomizationInformation];
     
@@ -1049,13 +2110,11 @@ NS_ASSUME_NONNULL_END
     return queue;
 }
 
-- (NSURLSession *)sessionWithConfiguration:(NSURLSessionConfiguration *)configuration {
+- (id <PNTransport>)transportWithConfiguration:(NSURLSessionConfiguration *)configuration {
     
     // Construct sessions to process requests which should be sent to PubNub network.
-    NSURLSession *session = [NSURLSession sessionWithConfiguration:configuration delegate:self
-                                                     delegateQueue:_delegateQueue];
-    
-    return session;
+    return [PNURLSessionTransport transportWithConfiguration:configuration delegate:self
+                                               delegateQueue:_delegateQueue];
 }
 
 - (NSURL *)requestBaseURL {
@@ -1179,8 +2238,8 @@ NS_ASSUME_NONNULL_END
     }
 }
 
-- (void)handleData:(NSData *)data loadedWithTask:(NSURLSessionDataTask *)task error:(NSError *)requestError 
-      usingSuccess:(NSURLSessionDataTaskSuccess)success failure:(NSURLSessionDataTaskFailure)failure {
+- (void)handleData:(NSData *)data loadedWithTask:(id <PNTransportTask>)task error:(NSError *)requestError 
+      usingSuccess:(PNTransportTaskSuccess)success failure:(PNTransportTaskFailure)failure {
     
     dispatch_async(self.processingQueue, ^{
         
@@ -1192,7 +2251,58 @@ NS_ASSUME_NONNULL_END
     });
 }
 
-- (void)handleOperation:(PNOperationType)operation taskDidComplete:(NSURLSessionDataTask *)task
+- (void)handleStreamParser:(PNSubscribeStreamParser *)parser errorData:(NSData *)errorData
+            loadedWithTask:(id <PNTransportTask>)task error:(NSError *)requestError
+              usingSuccess:(PNTransportTaskSuccess)success failure:(PNTransportTaskFailure)failure {
+    
+    dispatch_async(self.processingQueue, ^{
+        
+        NSError *serializationError = nil;
+        NSDictionary *parsedData = nil;
+        [self.serializer serializedResponse:(NSHTTPURLResponse *)task.response withData:errorData
+                                      error:&serializationError];
+        NSError *error = (requestError?: serializationError);
+        if (!error) {
+            
+            parsedData = [parser finish];
+            error = parser.error;
+        }
+        (!error ? success : failure)(task, (error?: parsedData));
+    });
+}
+
+- (NSData *)inflatedData:(NSData *)data receivedForOperation:(PNOperationType)operationType
+                   error:(NSError *__autoreleasing *)error {
+    
+    if (![PNGZIP isGZIPCompressedData:data]) { return data; }
+    
+    NSData *inflatedData = [PNGZIP GZIPInflatedData:data];
+    [self trackCompressedResponseLength:data.length inflatedLength:inflatedData.length forOperation:operationType];
+    if (!inflatedData && error) { *error = [self inflationErrorForTask:nil]; }
+    
+    return inflatedData;
+}
+
+- (void)trackCompressedResponseLength:(NSUInteger)length inflatedLength:(NSUInteger)inflatedLength
+                         forOperation:(PNOperationType)operationType {
+    
+    NSString *endpoint = (self.forLongPollRequests ? @"sub" :
+                          [self.client.telemetryManager endpointNameForOperation:operationType]);
+    [self.client.telemetryManager trackCompressedResponseLength:length inflatedLength:inflatedLength
+                                                    forEndpoint:endpoint];
+}
+
+- (NSError *)inflationErrorForTask:(id <PNTransportTask>)task {
+    
+    NSMutableDictionary *userInfo = [@{
+        NSLocalizedDescriptionKey: @"Request completed but compressed response body can't be uncompressed."
+    } mutableCopy];
+    if (task.originalRequest.URL) { userInfo[NSURLErrorFailingURLErrorKey] = task.originalRequest.URL; }
+    
+    return [NSError errorWithDomain:NSURLErrorDomain code:NSURLErrorCannotDecodeContentData userInfo:userInfo];
+}
+
+- (void)handleOperation:(PNOperationType)operation taskDidComplete:(id <PNTransportTask>)task
                withData:(id)responseObject completionBlock:(id)block {
     
     __weak __typeof(self) weakSelf = self;
@@ -1204,7 +2314,7 @@ NS_ASSUME_NONNULL_END
          }];
 }
 
-- (void)handleOperation:(PNOperationType)operation taskDidFail:(NSURLSessionDataTask *)task
+- (void)handleOperation:(PNOperationType)operation taskDidFail:(id <PNTransportTask>)task
               withError:(NSError *)error completionBlock:(id)block {
     
     if (error.code == NSURLErrorCancelled) {
@@ -1230,7 +2340,7 @@ NS_ASSUME_NONNULL_END
     }
 }
 
-- (void)handleParsedData:(NSDictionary *)data loadedWithTask:(NSURLSessionDataTask *)task
+- (void)handleParsedData:(NSDictionary *)data loadedWithTask:(id <PNTransportTask>)task
             forOperation:(PNOperationType)operation parsedAsError:(BOOL)isError
          processingError:(NSError *)error completionBlock:(id)block {
     
@@ -1261,6 +2371,29 @@ NS_ASSUME_NONNULL_END
                                                processedData:data processingError:error];
     }
     
+    if (self.circuitBreaker && task) {
+        
+        NSString *endpoint = [self.client.telemetryManager endpointNameForOperation:operation];
+        if (status.category == PNCancelledCategory || [error.userInfo[kPNRequestAbandonedErrorKey] boolValue]) {
+            [self.circuitBreaker recordCancellationForEndpoint:endpoint];
+        }
+        else {
+            
+            BOOL failed = (isError && (status.category == PNTimeoutCategory ||
+                                       status.category == PNNetworkIssuesCategory || status.statusCode >= 500));
+            [self.circuitBreaker recordResponseForEndpoint:endpoint failed:failed];
+        }
+    }
+    
+    if (!isError) {
+        
+        // Modification may be applied after read requests which has been sent during it's processing.
+        [self.responseCache invalidateResultsAffectedByOperation:operation];
+        if (result && task) {
+            [self.responseCache storeResult:result forOperation:operation URL:task.originalRequest.URL];
+        }
+    }
+    
     if (result || status) {
 
         [self handleOperation:operation processingCompletedWithResult:result
@@ -1308,6 +2441,63 @@ NS_ASSUME_NONNULL_END
     #pragma clang diagnostic pop
 }
 
+- (void)handleOperation:(PNOperationType)operation abandonedWithHandle:(PNRequestHandle *)handle
+        completionBlock:(id)block {
+    
+    PNLogRequest(self.client.logger, @"<PubNub::Network> Drop %@ request before sending.",
+                 (handle.isCancelled ? @"cancelled" : @"expired"));
+    [self.client.telemetryManager incrementMetric:@"requests.abandoned" by:1];
+    PNErrorStatus *status = [self statusForOperation:operation abandonedWithHandle:handle];
+    
+    __weak __typeof(self) weakSelf = self;
+    pn_dispatch_async(self.processingQueue, ^{
+        
+        [weakSelf handleOperation:operation processingCompletedWithResult:nil status:status
+                  completionBlock:block];
+    });
+}
+
+- (PNErrorStatus *)statusForOperation:(PNOperationType)operation abandonedWithHandle:(PNRequestHandle *)handle {
+    
+    PNStatusCategory category = (handle.isCancelled ? PNCancelledCategory : PNTimeoutCategory);
+    
+    return [PNErrorStatus statusForOperation:operation category:category
+                         withProcessingError:handle.abandonmentError];
+}
+
+- (void)trackCancellationWithHandle:(PNRequestHandle *)handle ofSharedRequest:(PNSharedRequest *)request
+                            withKey:(NSString *)key forOperation:(PNOperationType)operation {
+    
+    if (!handle) { return; }
+    
+    __weak __typeof(self) weakSelf = self;
+    __weak PNRequestHandle *weakHandle = handle;
+    [handle setCancellationHandler:^{
+        
+        [weakSelf handleCancellationWithHandle:weakHandle ofSharedRequest:request withKey:key
+                                  forOperation:operation];
+    }];
+}
+
+- (void)handleCancellationWithHandle:(PNRequestHandle *)handle ofSharedRequest:(PNSharedRequest *)request
+                             withKey:(NSString *)key forOperation:(PNOperationType)operation {
+    
+    PNCompletionBlock block = (handle ? [request removeCompletionBlockForHandle:handle] : nil);
+    if (!block) { return; }
+    
+    if (key && request.isCancelled) {
+        pn_lock(&_lock, ^{
+            
+            if (self->_coalescedRequests[key] == request) { [self->_coalescedRequests removeObjectForKey:key]; }
+        });
+    }
+    
+    [self.client.telemetryManager incrementMetric:@"requests.abandoned" by:1];
+    PNErrorStatus *status = [self statusForOperation:operation abandonedWithHandle:handle];
+    [self.client appendClientInformation:status];
+    pn_dispatch_async(self.processingQueue, ^{ block(nil, status); });
+}
+
 #if PN_URLSESSION_TRANSACTION_METRICS_AVAILABLE
 #pragma clang diagnostic push
 #pragma clang diagnostic ignored "-Wpartial-availability"
@@ -1331,10 +2521,11 @@ NS_ASSUME_NONNULL_END
             pn_lock(&self->_lock, ^{
                 NSString *taskIdentifier = [self.sessionIdentifier stringByAppendingString:@(task.taskIdentifier).stringValue];
 
-                if (taskIdentifier) {
-                    PNOperationType operationType = self.dataTaskToOperationMap[taskIdentifier].integerValue;
+                // Tasks which has been sent not for API calls (like connections warm up) not tracked.
+                NSNumber *operationType = (taskIdentifier ? self.dataTaskToOperationMap[taskIdentifier] : nil);
+                if (operationType) {
                     [self.dataTaskToOperationMap removeObjectForKey:taskIdentifier];
-                    [self.client.telemetryManager setLatency:latency forOperation:operationType];
+                    [self.client.telemetryManager setLatency:latency forOperation:operationType.integerValue];
                 }
             });
         }
@@ -1354,10 +2545,10 @@ NS_ASSUME_NONNULL_END
 
 #if TARGET_OS_IOS
 
-- (BOOL)hasOperation:(PNOperationType)operation inDataTasks:(NSArray<NSURLSessionDataTask *> *)tasks {
+- (BOOL)hasOperation:(PNOperationType)operation inDataTasks:(NSArray<id <PNTransportTask>> *)tasks {
     
     BOOL hasOperation = NO;
-    for (NSURLSessionDataTask *dataTask in tasks) {
+    for (id <PNTransportTask> dataTask in tasks) {
         
         if ([PNURLBuilder isURL:dataTask.originalRequest.URL forOperation:operation]) {
             
@@ -5,11 +5,23 @@
  */
 #import "PNReachability.h"
 #import "PubNub+CorePrivate.h"
+#import "PubNub+TimePrivate.h"
 #import "PNConfiguration.h"
+#import "PNRetryPolicy.h"
 #import "PNLogMacro.h"
 #import "PubNub.h"
 
 
+#pragma mark Static
+
+/**
+ @brief  Stores interval between remote service pings while it is reachable.
+ 
+ @since 4.8.2
+ */
+static NSTimeInterval const kPNReachabilityPingInterval = 10.0f;
+
+
 NS_ASSUME_NONNULL_BEGIN
 
 #pragma mark - Protected interface declaration
@@ -57,6 +69,15 @@ NS_ASSUME_NONNULL_BEGIN
  */
 @property (nonatomic, assign) BOOL reachable;
 
+/**
+ @brief      Stores reference on policy which is used to calculate delay between pings while remote service
+             not reachable.
+ @discussion Policy reset as soon as ping will be successful.
+ 
+ @since 4.8.2
+ */
+@property (nonatomic, strong) PNRetryPolicy *retryPolicy;
+
 
 #pragma mark - Initialization and Configuration
 
@@ -118,6 +139,7 @@ NS_ASSUME_NONNULL_END
         _resourceAccessQueue = dispatch_queue_create("com.pubnub.reachability",
                                                      DISPATCH_QUEUE_CONCURRENT);
         _reachable = YES;
+        _retryPolicy = [PNRetryPolicy policyWithConfiguration:client.configuration];
     }
     
     return self;
@@ -146,7 +168,7 @@ NS_ASSUME_NONNULL_END
         self.pingRemoteService = YES;
         // Try to request 'time' API to ensure what network really available.
         __weak __typeof(self) weakSelf = self;
-        [self.client timeWithCompletion:^(PNTimeResult *result, __unused PNErrorStatus *status) {
+        [self.client pingServiceWithCompletion:^(PNTimeResult *result, __unused PNErrorStatus *status) {
             
             [weakSelf handleServicePingResult:result];
         }];
@@ -175,7 +197,15 @@ NS_ASSUME_NONNULL_END
     if (self.pingCompleteBlock) { self.pingCompleteBlock(successfulPing); }
     if (self.pingingRemoteService) {
         
-        NSTimeInterval delay = ((self.reachable && !successfulPing) ? 1.f : 10.0f);
+        // Spread pings from clients which lost connection at same time and keep probing with maximum delay
+        // when retry budget exhausted.
+        NSTimeInterval delay = kPNReachabilityPingInterval;
+        if (!successfulPing) {
+            
+            delay = [self.retryPolicy nextDelay];
+            if (delay < 0.f) { delay = self.retryPolicy.maximumDelay; }
+        }
+        else { [self.retryPolicy reset]; }
         dispatch_after(dispatch_time(DISPATCH_TIME_NOW, (int64_t)(delay * NSEC_PER_SEC)),
                        dispatch_get_main_queue(), ^{
 
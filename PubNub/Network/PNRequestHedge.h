@@ -0,0 +1,79 @@
+#import <Foundation/Foundation.h>
+#import "PNTransport.h"
+
+
+#pragma mark Class forward
+
+@class PNStatus;
+
+
+NS_ASSUME_NONNULL_BEGIN
+
+/**
+ @brief      Class which is used to track attempts of single hedged request.
+ @discussion Hedged request sent more than once and completed with first successful response. Error response
+             wins only if there is no other attempts in flight (or if request has been cancelled by user). All
+             other attempts cancelled as soon as winner is chosen.
+
+ @author Sergey Mamontov
+ @since 4.8.2
+ @copyright © 2009-2017 PubNub, Inc.
+ */
+@interface PNRequestHedge : NSObject
+
+
+///------------------------------------------------
+/// @name Information
+///------------------------------------------------
+
+/**
+ @brief  Whether one of attempts already provided response for API call.
+
+ @since 4.8.2
+ */
+@property (nonatomic, readonly, assign, getter = isCompleted) BOOL completed;
+
+
+///------------------------------------------------
+/// @name Attempts
+///------------------------------------------------
+
+/**
+ @brief      Store task which has been created for next request attempt.
+ @discussion Task cancelled right away if hedged request has been completed while it has been created.
+
+ @param task Reference on task which should be started.
+
+ @return \c NO in case if task has been cancelled and shouldn't be started.
+
+ @since 4.8.2
+ */
+- (BOOL)addTask:(id <PNTransportTask>)task;
+
+/**
+ @brief      Check whether attempt's response should be delivered to API caller or not.
+ @discussion Other attempts cancelled if response has been chosen.
+
+ @param attempt Index of attempt (in order in which tasks has been added) which received response.
+ @param status  Reference on attempt processing status.
+
+ @return \c YES in case if response should be delivered to API caller.
+
+ @since 4.8.2
+ */
+- (BOOL)shouldCompleteAttempt:(NSUInteger)attempt withStatus:(nullable PNStatus *)status;
+
+/**
+ @brief      Cancel all request attempts.
+ @discussion Responses of cancelled attempts won't be delivered to API caller.
+
+ @since 4.8.2
+ */
+- (void)cancel;
+
+#pragma mark -
+
+
+@end
+
+NS_ASSUME_NONNULL_END
@@ -0,0 +1,144 @@
+/**
+ @author Sergey Mamontov
+ @since 4.8.2
+ @copyright © 2009-2017 PubNub, Inc.
+ */
+#import "PNRequestHedge.h"
+#import "PNLockSupport.h"
+#import "PNStatus.h"
+
+
+NS_ASSUME_NONNULL_BEGIN
+
+#pragma mark Protected interface declaration
+
+@interface PNRequestHedge ()
+
+
+#pragma mark - Information
+
+@property (nonatomic, assign, getter = isCompleted) BOOL completed;
+
+/**
+ @brief  Stores reference on list of tasks which has been created for request attempts.
+
+ @since 4.8.2
+ */
+@property (nonatomic, strong) NSMutableArray<id <PNTransportTask>> *tasks;
+
+/**
+ @brief  Stores number of attempts which already received response.
+
+ @since 4.8.2
+ */
+@property (nonatomic, assign) NSUInteger finishedAttempts;
+
+/**
+ @brief  Stores reference on lock which is used to protect tasks list and attempts state.
+
+ @since 4.8.2
+ */
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wpartial-availability"
+@property (nonatomic, assign) os_unfair_lock lock;
+#pragma clang diagnostic pop
+
+#pragma mark -
+
+
+@end
+
+NS_ASSUME_NONNULL_END
+
+
+#pragma mark - Interface implementation
+
+@implementation PNRequestHedge
+
+
+#pragma mark - Information
+
+- (BOOL)isCompleted {
+
+    __block BOOL completed = NO;
+    pn_lock(&_lock, ^{ completed = self->_completed; });
+
+    return completed;
+}
+
+
+#pragma mark - Initialization and Configuration
+
+- (instancetype)init {
+
+    // Check whether initialization was successful or not.
+    if ((self = [super init])) {
+
+        _tasks = [NSMutableArray new];
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wpartial-availability"
+        _lock = OS_UNFAIR_LOCK_INIT;
+#pragma clang diagnostic pop
+    }
+
+    return self;
+}
+
+
+#pragma mark - Attempts
+
+- (BOOL)addTask:(id <PNTransportTask>)task {
+
+    __block BOOL added = NO;
+    pn_lock(&_lock, ^{
+
+        added = !self->_completed;
+        if (added) { [self->_tasks addObject:task]; }
+    });
+
+    if (!added) { [task cancel]; }
+
+    return added;
+}
+
+- (BOOL)shouldCompleteAttempt:(NSUInteger)attempt withStatus:(PNStatus *)status {
+
+    __block NSArray<id <PNTransportTask>> *tasks = nil;
+    pn_lock(&_lock, ^{
+
+        self->_finishedAttempts++;
+        if (self->_completed) { return; }
+
+        // Wait for response from other attempts if this one failed.
+        BOOL hasActiveAttempts = self->_finishedAttempts < self->_tasks.count;
+        if (status.isError && status.category != PNCancelledCategory && hasActiveAttempts) { return; }
+
+        self->_completed = YES;
+        tasks = [self->_tasks copy];
+        [self->_tasks removeAllObjects];
+    });
+
+    for (NSUInteger taskIdx = 0; taskIdx < tasks.count; taskIdx++) {
+        if (taskIdx != attempt) { [tasks[taskIdx] cancel]; }
+    }
+
+    return (tasks != nil);
+}
+
+- (void)cancel {
+
+    __block NSArray<id <PNTransportTask>> *tasks = nil;
+    pn_lock(&_lock, ^{
+
+        self->_completed = YES;
+        tasks = [self->_tasks copy];
+        [self->_tasks removeAllObjects];
+    });
+
+    [tasks makeObjectsPerformSelector:@selector(cancel)];
+}
+
+#pragma mark -
+
+
+@end
@@ -1,6 +1,11 @@
 #import <Foundation/Foundation.h>
 
 
+#pragma mark Class forward
+
+@class PNRequestHandle, PNSharedRequest;
+
+
 NS_ASSUME_NONNULL_BEGIN
 
 /**
@@ -41,6 +46,33 @@ NS_ASSUME_NONNULL_BEGIN
  */
 @property (nonatomic, nullable, readonly) NSDictionary<NSString *, NSString *> *query;
 
+/**
+ @brief      Stores reference on handle which allow user to cancel API call or limit time during which API
+             call result is expected.
+ @discussion Network manager won't send request for abandoned API call.
+
+ @since 4.8.2
+ */
+@property (nonatomic, nullable, strong) PNRequestHandle *handle;
+
+/**
+ @brief      Stores reference on object which track identical API calls which has been coalesced by caller.
+ @discussion Network manager won't try to attach such request to identical in-flight request and will stop
+             sending it when all coalesced API calls will be cancelled.
+
+ @since 4.8.2
+ */
+@property (nonatomic, nullable, strong) PNSharedRequest *sharedRequest;
+
+/**
+ @brief      Stores whether response should be received from \b PubNub network for this request.
+ @discussion Network manager won't use cached result or attach such request to identical in-flight request
+             (used by service ping, which should fail while network is down).
+
+ @since 4.8.2
+ */
+@property (nonatomic, assign, getter = isFreshResponseRequired) BOOL freshResponseRequired;
+
 
 ///------------------------------------------------
 /// @name Path components manipulation
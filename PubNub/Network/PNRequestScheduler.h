@@ -0,0 +1,124 @@
+#import <Foundation/Foundation.h>
+#import "PNStructures.h"
+#import "PNTransport.h"
+
+
+NS_ASSUME_NONNULL_BEGIN
+
+/**
+ @brief      Class which is used to start data tasks in order of their priority.
+ @discussion Each task is placed into lane for it's priority class. Scheduler start tasks from lane with
+             highest priority while number of active tasks is lower than connections limit and lane's own
+             concurrency limit allow to start more tasks. This way burst of low priority requests (history or
+             presence audit) can't occupy all connections and delay publish or heartbeat requests.
+
+ @author Sergey Mamontov
+ @since 4.8.2
+ @copyright © 2009-2017 PubNub, Inc.
+ */
+@interface PNRequestScheduler : NSObject
+
+
+///------------------------------------------------
+/// @name Information
+///------------------------------------------------
+
+/**
+ @brief  Maximum number of tasks from all lanes which can be active at the same time.
+
+ @since 4.8.2
+ */
+@property (nonatomic, readonly, assign) NSUInteger maximumActiveTasks;
+
+/**
+ @brief  Retrieve priority class for operation.
+
+ @param operation One of \b PNOperationType enum fields for which priority class should be found.
+
+ @return One of \b PNRequestPriority enum fields.
+
+ @since 4.8.2
+ */
++ (PNRequestPriority)priorityForOperation:(PNOperationType)operation;
+
+
+///------------------------------------------------
+/// @name Initialization and Configuration
+///------------------------------------------------
+
+/**
+ @brief  Construct tasks scheduler.
+
+ @param maximumActiveTasks Maximum number of tasks from all lanes which can be active at the same time.
+ @param limits             Reference on map of \b PNRequestPriority enum fields to maximum number of active
+                           tasks for this priority class. Default limits will be used for classes which is
+                           not specified.
+
+ @return Configured and ready to use scheduler.
+
+ @since 4.8.2
+ */
++ (instancetype)schedulerWithMaximumActiveTasks:(NSUInteger)maximumActiveTasks
+                                         limits:(nullable NSDictionary<NSNumber *, NSNumber *> *)limits;
+
+
+///------------------------------------------------
+/// @name Scheduling
+///------------------------------------------------
+
+/**
+ @brief      Place task into lane for it's priority class.
+ @discussion Task will be resumed right away if there is free slot for it's priority class.
+
+ @param task     Reference on task which should be scheduled.
+ @param priority One of \b PNRequestPriority enum fields which describe task priority class.
+
+ @since 4.8.2
+ */
+- (void)scheduleTask:(id <PNTransportTask>)task withPriority:(PNRequestPriority)priority;
+
+/**
+ @brief      Notify scheduler what task processing has been completed.
+ @discussion Scheduler will start next tasks if freed slot can be used by them.
+
+ @param task Reference on task which has been completed (or cancelled before it has been started).
+
+ @since 4.8.2
+ */
+- (void)completeTask:(id <PNTransportTask>)task;
+
+/**
+ @brief      Cancel tasks which is waiting for free slot.
+ @discussion Cancelled tasks will be removed from lanes when their completion will be reported with
+             \c -completeTask:.
+
+ @param prefix Reference on API endpoint path prefix. If passed, only tasks created against such API endpoint
+               will be cancelled.
+
+ @since 4.8.2
+ */
+- (void)cancelPendingTasksWithURLPrefix:(nullable NSString *)prefix;
+
+
+///------------------------------------------------
+/// @name Metrics
+///------------------------------------------------
+
+/**
+ @brief  Retrieve scheduler lanes gauges.
+
+ @return Dictionary with current (\c network.<lane>.queue.depth) and maximum
+         (\c network.<lane>.queue.maxDepth) number of waiting tasks and number of active tasks
+         (\c network.<lane>.active) for each priority class (\c publish, \c heartbeat, \c state and
+         \c audit).
+
+ @since 4.8.2
+ */
+- (NSDictionary<NSString *, NSNumber *> *)metrics;
+
+#pragma mark -
+
+
+@end
+
+NS_ASSUME_NONNULL_END
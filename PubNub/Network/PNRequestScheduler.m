@@ -0,0 +1,332 @@
+/**
+ @author Sergey Mamontov
+ @since 4.8.2
+ @copyright © 2009-2017 PubNub, Inc.
+ */
+#import "PNRequestScheduler.h"
+#import "PNLockSupport.h"
+#import "PNConstants.h"
+
+
+#pragma mark Static
+
+/**
+ @brief  Number of priority classes (lanes) which is handled by scheduler.
+
+ @since 4.8.2
+ */
+static NSUInteger const kPNRequestPrioritiesCount = (PNAuditRequestPriority + 1);
+
+
+NS_ASSUME_NONNULL_BEGIN
+
+#pragma mark - Protected interface declaration
+
+@interface PNRequestScheduler ()
+
+
+#pragma mark - Information
+
+@property (nonatomic, assign) NSUInteger maximumActiveTasks;
+
+/**
+ @brief  Stores reference on list of maximum number of active tasks for each priority class.
+
+ @since 4.8.2
+ */
+@property (nonatomic, strong) NSArray<NSNumber *> *limits;
+
+/**
+ @brief  Stores reference on list of waiting tasks lanes (index is priority class).
+
+ @since 4.8.2
+ */
+@property (nonatomic, strong) NSArray<NSMutableArray<id <PNTransportTask>> *> *lanes;
+
+/**
+ @brief  Stores reference on list of active tasks count for each priority class.
+
+ @since 4.8.2
+ */
+@property (nonatomic, strong) NSMutableArray<NSNumber *> *activeTasksCount;
+
+/**
+ @brief  Stores reference on list of maximum number of waiting tasks for each priority class.
+
+ @since 4.8.2
+ */
+@property (nonatomic, strong) NSMutableArray<NSNumber *> *maximumLaneDepth;
+
+/**
+ @brief  Stores reference on map of active task identifiers to their priority class.
+
+ @since 4.8.2
+ */
+@property (nonatomic, strong) NSMutableDictionary<NSNumber *, NSNumber *> *activeTasks;
+
+/**
+ @brief  Stores reference on lock which is used to protect lanes and counters.
+
+ @since 4.8.2
+ */
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wpartial-availability"
+@property (nonatomic, assign) os_unfair_lock lock;
+#pragma clang diagnostic pop
+
+
+#pragma mark - Initialization and Configuration
+
+/**
+ @brief  Initialize tasks scheduler.
+
+ @param maximumActiveTasks Maximum number of tasks from all lanes which can be active at the same time.
+ @param limits             Reference on map of priority classes to maximum number of active tasks.
+
+ @return Initialized and ready to use scheduler.
+
+ @since 4.8.2
+ */
+- (instancetype)initWithMaximumActiveTasks:(NSUInteger)maximumActiveTasks
+                                    limits:(nullable NSDictionary<NSNumber *, NSNumber *> *)limits;
+
+
+#pragma mark - Scheduling
+
+/**
+ @brief      Pick tasks which can be started with free slots.
+ @discussion Tasks marked as active and removed from lanes. This method should be called only from within
+             lock.
+
+ @return List of tasks which should be resumed.
+
+ @since 4.8.2
+ */
+- (NSArray<id <PNTransportTask>> *)dequeueTasksForFreeSlots;
+
+
+#pragma mark - Misc
+
+/**
+ @brief  Retrieve lane name which is used in metrics names.
+
+ @param priority One of \b PNRequestPriority enum fields for which name should be provided.
+
+ @return Lane name.
+
+ @since 4.8.2
+ */
++ (NSString *)nameForPriority:(PNRequestPriority)priority;
+
+#pragma mark -
+
+
+@end
+
+NS_ASSUME_NONNULL_END
+
+
+#pragma mark - Interface implementation
+
+@implementation PNRequestScheduler
+
+
+#pragma mark - Information
+
++ (PNRequestPriority)priorityForOperation:(PNOperationType)operation {
+
+    PNRequestPriority priority = PNAuditRequestPriority;
+    switch (operation) {
+        case PNPublishOperation:
+            priority = PNPublishRequestPriority;
+            break;
+        case PNHeartbeatOperation:
+        case PNUnsubscribeOperation:
+            priority = PNHeartbeatRequestPriority;
+            break;
+        case PNSetStateOperation:
+        case PNStateForChannelOperation:
+        case PNStateForChannelGroupOperation:
+        case PNDeleteMessageOperation:
+        case PNAddChannelsToGroupOperation:
+        case PNRemoveChannelsFromGroupOperation:
+        case PNRemoveGroupOperation:
+        case PNAddPushNotificationsOnChannelsOperation:
+        case PNRemovePushNotificationsFromChannelsOperation:
+        case PNRemoveAllPushNotificationsOperation:
+        case PNTimeOperation:
+            priority = PNStateRequestPriority;
+            break;
+        default:
+            break;
+    }
+
+    return priority;
+}
+
+
+#pragma mark - Initialization and Configuration
+
++ (instancetype)schedulerWithMaximumActiveTasks:(NSUInteger)maximumActiveTasks
+                                         limits:(NSDictionary<NSNumber *, NSNumber *> *)limits {
+
+    return [[self alloc] initWithMaximumActiveTasks:maximumActiveTasks limits:limits];
+}
+
+- (instancetype)initWithMaximumActiveTasks:(NSUInteger)maximumActiveTasks
+                                    limits:(NSDictionary<NSNumber *, NSNumber *> *)limits {
+
+    // Check whether initialization was successful or not.
+    if ((self = [super init])) {
+
+        NSArray<NSNumber *> *defaultLimits = @[@(kPNDefaultPublishRequestsLimit),
+                                               @(kPNDefaultHeartbeatRequestsLimit),
+                                               @(kPNDefaultStateRequestsLimit),
+                                               @(kPNDefaultAuditRequestsLimit)];
+        NSMutableArray<NSNumber *> *laneLimits = [NSMutableArray new];
+        NSMutableArray *lanes = [NSMutableArray new];
+        _activeTasksCount = [NSMutableArray new];
+        _maximumLaneDepth = [NSMutableArray new];
+        for (NSUInteger priority = 0; priority < kPNRequestPrioritiesCount; priority++) {
+
+            // Lane can't be completelly disabled, because it's tasks will never complete.
+            NSUInteger limit = (limits[@(priority)] ?: defaultLimits[priority]).unsignedIntegerValue;
+            [laneLimits addObject:@(MAX(limit, 1))];
+            [lanes addObject:[NSMutableArray new]];
+            [_activeTasksCount addObject:@0];
+            [_maximumLaneDepth addObject:@0];
+        }
+
+        _maximumActiveTasks = MAX(maximumActiveTasks, 1);
+        _limits = [laneLimits copy];
+        _lanes = [lanes copy];
+        _activeTasks = [NSMutableDictionary new];
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wpartial-availability"
+        _lock = OS_UNFAIR_LOCK_INIT;
+#pragma clang diagnostic pop
+    }
+
+    return self;
+}
+
+
+#pragma mark - Scheduling
+
+- (void)scheduleTask:(id <PNTransportTask>)task withPriority:(PNRequestPriority)priority {
+
+    __block NSArray<id <PNTransportTask>> *tasks = nil;
+    pn_lock(&_lock, ^{
+
+        NSMutableArray<id <PNTransportTask>> *lane = self->_lanes[priority];
+        [lane addObject:task];
+        if (lane.count > self->_maximumLaneDepth[priority].unsignedIntegerValue) {
+            self->_maximumLaneDepth[priority] = @(lane.count);
+        }
+        tasks = [self dequeueTasksForFreeSlots];
+    });
+
+    [tasks makeObjectsPerformSelector:@selector(resume)];
+}
+
+- (void)completeTask:(id <PNTransportTask>)task {
+
+    __block NSArray<id <PNTransportTask>> *tasks = nil;
+    pn_lock(&_lock, ^{
+
+        NSNumber *taskIdentifier = @(task.taskIdentifier);
+        NSNumber *priority = self->_activeTasks[taskIdentifier];
+        if (priority) {
+
+            NSUInteger lane = priority.unsignedIntegerValue;
+            self->_activeTasksCount[lane] = @(self->_activeTasksCount[lane].unsignedIntegerValue - 1);
+            [self->_activeTasks removeObjectForKey:taskIdentifier];
+        }
+        else {
+
+            for (NSMutableArray<id <PNTransportTask>> *lane in self->_lanes) {
+                [lane removeObjectIdenticalTo:task];
+            }
+        }
+        tasks = [self dequeueTasksForFreeSlots];
+    });
+
+    [tasks makeObjectsPerformSelector:@selector(resume)];
+}
+
+- (void)cancelPendingTasksWithURLPrefix:(NSString *)prefix {
+
+    NSMutableArray<id <PNTransportTask>> *tasks = [NSMutableArray new];
+    pn_lock(&_lock, ^{
+
+        for (NSMutableArray<id <PNTransportTask>> *lane in self->_lanes) {
+            for (id <PNTransportTask> task in lane) {
+                if (!prefix || [task.originalRequest.URL.path hasPrefix:prefix]) { [tasks addObject:task]; }
+            }
+        }
+    });
+
+    [tasks makeObjectsPerformSelector:@selector(cancel)];
+}
+
+- (NSArray<id <PNTransportTask>> *)dequeueTasksForFreeSlots {
+
+    NSMutableArray<id <PNTransportTask>> *tasks = nil;
+    while (_activeTasks.count < _maximumActiveTasks) {
+
+        NSUInteger priority = 0;
+        for (; priority < kPNRequestPrioritiesCount; priority++) {
+            if (_lanes[priority].count &&
+                _activeTasksCount[priority].unsignedIntegerValue < _limits[priority].unsignedIntegerValue) {
+                break;
+            }
+        }
+        if (priority == kPNRequestPrioritiesCount) { break; }
+
+        id <PNTransportTask> task = _lanes[priority].firstObject;
+        [_lanes[priority] removeObjectAtIndex:0];
+        _activeTasksCount[priority] = @(_activeTasksCount[priority].unsignedIntegerValue + 1);
+        _activeTasks[@(task.taskIdentifier)] = @(priority);
+        if (!tasks) { tasks = [NSMutableArray new]; }
+        [tasks addObject:task];
+    }
+
+    return tasks;
+}
+
+
+#pragma mark - Metrics
+
+- (NSDictionary<NSString *, NSNumber *> *)metrics {
+
+    NSMutableDictionary<NSString *, NSNumber *> *metrics = [NSMutableDictionary new];
+    pn_lock(&_lock, ^{
+
+        for (NSUInteger priority = 0; priority < kPNRequestPrioritiesCount; priority++) {
+
+            NSString *prefix = [@"network." stringByAppendingString:[[self class] nameForPriority:priority]];
+            metrics[[prefix stringByAppendingString:@".queue.depth"]] = @(self->_lanes[priority].count);
+            metrics[[prefix stringByAppendingString:@".queue.maxDepth"]] = self->_maximumLaneDepth[priority];
+            metrics[[prefix stringByAppendingString:@".active"]] = self->_activeTasksCount[priority];
+        }
+    });
+
+    return [metrics copy];
+}
+
+
+#pragma mark - Misc
+
++ (NSString *)nameForPriority:(PNRequestPriority)priority {
+
+    static NSArray<NSString *> *_names;
+    static dispatch_once_t onceToken;
+    dispatch_once(&onceToken, ^{ _names = @[@"publish", @"heartbeat", @"state", @"audit"]; });
+
+    return _names[priority];
+}
+
+#pragma mark -
+
+
+@end
@@ -0,0 +1,150 @@
+#import <Foundation/Foundation.h>
+#import "PNStructures.h"
+
+
+#pragma mark Class forward
+
+@class PNResult;
+
+
+NS_ASSUME_NONNULL_BEGIN
+
+/**
+ @brief      Class which is used to keep results of idempotent read operations for limited time.
+ @discussion Results stored under key which is composed from operation type and canonical request (path and
+             sorted query without per-request fields), so same API call with same arguments will be served
+             from cache while result's time-to-live not expired. Modification operations invalidate cached
+             results of read operations which they can affect (for example, adding channels to group
+             invalidate channel group audit results).
+
+ @author Sergey Mamontov
+ @since 4.8.2
+ @copyright © 2009-2017 PubNub, Inc.
+ */
+@interface PNResponseCache : NSObject
+
+
+///------------------------------------------------
+/// @name Information
+///------------------------------------------------
+
+/**
+ @brief  Number of results which currently stored in cache.
+
+ @since 4.8.2
+ */
+@property (nonatomic, readonly, assign) NSUInteger count;
+
+/**
+ @brief  Check whether operation is idempotent read operation.
+
+ @param operation One of \b PNOperationType enum fields which should be checked.
+
+ @return \c YES in case if operation doesn't modify any data and same request will receive same response
+         (while data not changed by other operations).
+
+ @since 4.8.2
+ */
++ (BOOL)isIdempotentReadOperation:(PNOperationType)operation;
+
+/**
+ @brief      Compose key which identify request.
+ @discussion Query fields which is unique for each request (request identifier, SDK version, instance
+             identifier and telemetry) ignored and rest sorted by name, so same API calls with same arguments
+             will have same key.
+
+ @param operation One of \b PNOperationType enum fields which describe requested operation.
+ @param url       Reference on request URL.
+
+ @return Request key.
+
+ @since 4.8.2
+ */
++ (NSString *)keyForOperation:(PNOperationType)operation URL:(NSURL *)url;
+
+/**
+ @brief  Check whether results of specified operation can be stored in cache.
+
+ @param operation One of \b PNOperationType enum fields which should be checked.
+
+ @return \c YES in case if operation is idempotent read operation and non-zero time-to-live has been
+         configured for it.
+
+ @since 4.8.2
+ */
+- (BOOL)canCacheOperation:(PNOperationType)operation;
+
+
+///------------------------------------------------
+/// @name Initialization and Configuration
+///------------------------------------------------
+
+/**
+ @brief  Construct response cache.
+
+ @param ttls         Reference on map of \b PNOperationType enum fields to time-to-live (in seconds) of their
+                     results. Results of operations which is not specified won't be cached.
+ @param maximumCount Maximum number of results which can be stored in cache. Least recently used result will
+                     be removed when limit is reached.
+
+ @return Configured and ready to use response cache.
+
+ @since 4.8.2
+ */
++ (instancetype)cacheWithTimeToLive:(NSDictionary<NSNumber *, NSNumber *> *)ttls
+                       maximumCount:(NSUInteger)maximumCount;
+
+
+///------------------------------------------------
+/// @name Results
+///------------------------------------------------
+
+/**
+ @brief      Retrieve cached result for request.
+ @discussion If result not found, request is remembered as pending, so it's result will be accepted by
+             \c -storeResult:forOperation:URL: only if cached results of this operation won't be invalidated
+             while request is processed.
+
+ @param operation One of \b PNOperationType enum fields which describe requested operation.
+ @param url       Reference on request URL.
+
+ @return Copy of cached result or \c nil if it's missing or expired.
+
+ @since 4.8.2
+ */
+- (nullable PNResult *)resultForOperation:(PNOperationType)operation URL:(NSURL *)url;
+
+/**
+ @brief  Store result of request processing.
+
+ @param result    Reference on successful request processing result.
+ @param operation One of \b PNOperationType enum fields which describe processed operation.
+ @param url       Reference on request URL.
+
+ @since 4.8.2
+ */
+- (void)storeResult:(PNResult *)result forOperation:(PNOperationType)operation URL:(NSURL *)url;
+
+/**
+ @brief      Remove cached results which may be affected by operation.
+ @discussion Pending read requests for affected operations won't store their results.
+
+ @param operation One of \b PNOperationType enum fields which describe modification operation.
+
+ @since 4.8.2
+ */
+- (void)invalidateResultsAffectedByOperation:(PNOperationType)operation;
+
+/**
+ @brief  Remove all cached results.
+
+ @since 4.8.2
+ */
+- (void)removeAllResults;
+
+#pragma mark -
+
+
+@end
+
+NS_ASSUME_NONNULL_END
@@ -0,0 +1,350 @@
+/**
+ @author Sergey Mamontov
+ @since 4.8.2
+ @copyright © 2009-2017 PubNub, Inc.
+ */
+#import "PNResponseCache.h"
+#import "PNLockSupport.h"
+#import "PNResult.h"
+
+
+#pragma mark Static
+
+/**
+ @brief  Stores reference on key under which cached result is stored in cache entry.
+
+ @since 4.8.2
+ */
+static NSString * const kPNResponseCacheResultKey = @"result";
+
+/**
+ @brief  Stores reference on key under which result expiration date is stored in cache entry.
+
+ @since 4.8.2
+ */
+static NSString * const kPNResponseCacheExpirationKey = @"expiration";
+
+/**
+ @brief  Stores reference on key under which operation type is stored in cache entry.
+
+ @since 4.8.2
+ */
+static NSString * const kPNResponseCacheOperationKey = @"operation";
+
+
+NS_ASSUME_NONNULL_BEGIN
+
+#pragma mark - Protected interface declaration
+
+@interface PNResponseCache ()
+
+
+#pragma mark - Information
+
+/**
+ @brief  Stores reference on map of operation types to their results time-to-live.
+
+ @since 4.8.2
+ */
+@property (nonatomic, strong) NSDictionary<NSNumber *, NSNumber *> *ttls;
+
+/**
+ @brief  Stores maximum number of results which can be stored in cache.
+
+ @since 4.8.2
+ */
+@property (nonatomic, assign) NSUInteger maximumCount;
+
+/**
+ @brief  Stores reference on map of request keys to cache entries.
+
+ @since 4.8.2
+ */
+@property (nonatomic, strong) NSMutableDictionary<NSString *, NSDictionary *> *entries;
+
+/**
+ @brief  Stores reference on list of request keys ordered from least to most recently used.
+
+ @since 4.8.2
+ */
+@property (nonatomic, strong) NSMutableArray<NSString *> *usage;
+
+/**
+ @brief      Stores reference on map of operation types to number of times when their results has been
+             invalidated.
+ @discussion Used to reject results of requests which has been sent before invalidation.
+
+ @since 4.8.2
+ */
+@property (nonatomic, strong) NSMutableDictionary<NSNumber *, NSNumber *> *generations;
+
+/**
+ @brief  Stores reference on map of pending request keys to operation generation at the moment when they
+         has been sent.
+
+ @since 4.8.2
+ */
+@property (nonatomic, strong) NSMutableDictionary<NSString *, NSNumber *> *pendingRequests;
+
+/**
+ @brief  Stores reference on lock which is used to protect cache content.
+
+ @since 4.8.2
+ */
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wpartial-availability"
+@property (nonatomic, assign) os_unfair_lock lock;
+#pragma clang diagnostic pop
+
+
+#pragma mark - Initialization and Configuration
+
+/**
+ @brief  Initialize response cache.
+
+ @param ttls         Reference on map of operation types to time-to-live (in seconds) of their results.
+ @param maximumCount Maximum number of results which can be stored in cache.
+
+ @return Initialized and ready to use response cache.
+
+ @since 4.8.2
+ */
+- (instancetype)initWithTimeToLive:(NSDictionary<NSNumber *, NSNumber *> *)ttls
+                      maximumCount:(NSUInteger)maximumCount;
+
+
+#pragma mark - Misc
+
+/**
+ @brief  Retrieve list of read operations which results can be affected by specified operation.
+
+ @param operation One of \b PNOperationType enum fields which describe modification operation.
+
+ @return List of \b PNOperationType enum fields.
+
+ @since 4.8.2
+ */
++ (nullable NSArray<NSNumber *> *)operationsAffectedByOperation:(PNOperationType)operation;
+
+/**
+ @brief  Remove cache entry for key.
+ @discussion This method should be called only from within lock.
+
+ @param key Reference on key of entry which should be removed.
+
+ @since 4.8.2
+ */
+- (void)removeEntryForKey:(NSString *)key;
+
+#pragma mark -
+
+
+@end
+
+NS_ASSUME_NONNULL_END
+
+
+#pragma mark - Interface implementation
+
+@implementation PNResponseCache
+
+
+#pragma mark - Information
+
+- (NSUInteger)count {
+
+    __block NSUInteger count = 0;
+    pn_lock(&_lock, ^{ count = self->_entries.count; });
+
+    return count;
+}
+
++ (BOOL)isIdempotentReadOperation:(PNOperationType)operation {
+
+    static NSArray<NSNumber *> *_readOperations;
+    static dispatch_once_t onceToken;
+    dispatch_once(&onceToken, ^{
+
+        _readOperations = @[
+            @(PNWhereNowOperation), @(PNHereNowGlobalOperation), @(PNHereNowForChannelOperation),
+            @(PNHereNowForChannelGroupOperation), @(PNStateForChannelOperation),
+            @(PNStateForChannelGroupOperation), @(PNChannelGroupsOperation), @(PNChannelsForGroupOperation),
+            @(PNPushNotificationEnabledChannelsOperation), @(PNTimeOperation)];
+    });
+
+    return [_readOperations containsObject:@(operation)];
+}
+
+- (BOOL)canCacheOperation:(PNOperationType)operation {
+
+    return (self.ttls[@(operation)].doubleValue > 0.f && [[self class] isIdempotentReadOperation:operation]);
+}
+
+
+#pragma mark - Initialization and Configuration
+
++ (instancetype)cacheWithTimeToLive:(NSDictionary<NSNumber *, NSNumber *> *)ttls
+                       maximumCount:(NSUInteger)maximumCount {
+
+    return [[self alloc] initWithTimeToLive:ttls maximumCount:maximumCount];
+}
+
+- (instancetype)initWithTimeToLive:(NSDictionary<NSNumber *, NSNumber *> *)ttls
+                      maximumCount:(NSUInteger)maximumCount {
+
+    // Check whether initialization was successful or not.
+    if ((self = [super init])) {
+
+        _ttls = [ttls copy];
+        _maximumCount = maximumCount;
+        _entries = [NSMutableDictionary new];
+        _usage = [NSMutableArray new];
+        _generations = [NSMutableDictionary new];
+        _pendingRequests = [NSMutableDictionary new];
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wpartial-availability"
+        _lock = OS_UNFAIR_LOCK_INIT;
+#pragma clang diagnostic pop
+    }
+
+    return self;
+}
+
+
+#pragma mark - Results
+
+- (PNResult *)resultForOperation:(PNOperationType)operation URL:(NSURL *)url {
+
+    if (![self canCacheOperation:operation]) { return nil; }
+
+    NSString *key = [[self class] keyForOperation:operation URL:url];
+    __block PNResult *result = nil;
+    pn_lock(&_lock, ^{
+
+        NSDictionary *entry = self->_entries[key];
+        if (entry && [(NSDate *)entry[kPNResponseCacheExpirationKey] timeIntervalSinceNow] > 0.f) {
+
+            result = entry[kPNResponseCacheResultKey];
+            [self->_usage removeObject:key];
+            [self->_usage addObject:key];
+        }
+        else {
+
+            if (entry) { [self removeEntryForKey:key]; }
+            self->_pendingRequests[key] = (self->_generations[@(operation)] ?: @0);
+        }
+    });
+
+    return [result copy];
+}
+
+- (void)storeResult:(PNResult *)result forOperation:(PNOperationType)operation URL:(NSURL *)url {
+
+    if (![self canCacheOperation:operation] || !self.maximumCount) { return; }
+
+    NSString *key = [[self class] keyForOperation:operation URL:url];
+    NSDate *expiration = [NSDate dateWithTimeIntervalSinceNow:self.ttls[@(operation)].doubleValue];
+    pn_lock(&_lock, ^{
+
+        NSNumber *generation = self->_pendingRequests[key];
+        [self->_pendingRequests removeObjectForKey:key];
+        if (!generation || ![generation isEqualToNumber:(self->_generations[@(operation)] ?: @0)]) { return; }
+
+        [self removeEntryForKey:key];
+        if (self->_entries.count >= self->_maximumCount) { [self removeEntryForKey:self->_usage.firstObject]; }
+        self->_entries[key] = @{kPNResponseCacheResultKey: [result copy],
+                                kPNResponseCacheExpirationKey: expiration,
+                                kPNResponseCacheOperationKey: @(operation)};
+        [self->_usage addObject:key];
+    });
+}
+
+- (void)invalidateResultsAffectedByOperation:(PNOperationType)operation {
+
+    NSArray<NSNumber *> *operations = [[self class] operationsAffectedByOperation:operation];
+    if (!operations.count) { return; }
+
+    pn_lock(&_lock, ^{
+
+        for (NSNumber *affectedOperation in operations) {
+            self->_generations[affectedOperation] = @(self->_generations[affectedOperation].unsignedIntegerValue + 1);
+        }
+
+        for (NSString *key in self->_entries.allKeys) {
+            if ([operations containsObject:self->_entries[key][kPNResponseCacheOperationKey]]) {
+                [self removeEntryForKey:key];
+            }
+        }
+    });
+}
+
+- (void)removeAllResults {
+
+    pn_lock(&_lock, ^{
+
+        [self->_entries removeAllObjects];
+        [self->_usage removeAllObjects];
+        [self->_pendingRequests removeAllObjects];
+    });
+}
+
+
+#pragma mark - Misc
+
++ (NSString *)keyForOperation:(PNOperationType)operation URL:(NSURL *)url {
+
+    NSURLComponents *components = [NSURLComponents componentsWithURL:url resolvingAgainstBaseURL:YES];
+    NSMutableArray<NSString *> *query = [NSMutableArray new];
+    for (NSURLQueryItem *item in components.queryItems) {
+
+        NSString *name = item.name;
+        if ([name isEqualToString:@"requestid"] || [name isEqualToString:@"pnsdk"] ||
+            [name isEqualToString:@"instanceid"] || [name hasPrefix:@"l_"]) {
+
+            continue;
+        }
+        [query addObject:[NSString stringWithFormat:@"%@=%@", name, (item.value ?: @"")]];
+    }
+    [query sortUsingSelector:@selector(compare:)];
+
+    return [NSString stringWithFormat:@"%@:%@?%@", @(operation), components.path,
+            [query componentsJoinedByString:@"&"]];
+}
+
++ (NSArray<NSNumber *> *)operationsAffectedByOperation:(PNOperationType)operation {
+
+    static NSDictionary<NSNumber *, NSArray<NSNumber *> *> *_affectedOperations;
+    static dispatch_once_t onceToken;
+    dispatch_once(&onceToken, ^{
+
+        NSArray *groupsAudit = @[@(PNChannelGroupsOperation), @(PNChannelsForGroupOperation)];
+        NSArray *stateAudit = @[@(PNStateForChannelOperation), @(PNStateForChannelGroupOperation)];
+        NSArray *pushAudit = @[@(PNPushNotificationEnabledChannelsOperation)];
+        NSArray *presenceAudit = @[@(PNWhereNowOperation), @(PNHereNowGlobalOperation),
+                                   @(PNHereNowForChannelOperation), @(PNHereNowForChannelGroupOperation)];
+        _affectedOperations = @{
+            @(PNAddChannelsToGroupOperation): groupsAudit,
+            @(PNRemoveChannelsFromGroupOperation): groupsAudit,
+            @(PNRemoveGroupOperation): groupsAudit,
+            @(PNSetStateOperation): [stateAudit arrayByAddingObjectsFromArray:presenceAudit],
+            @(PNAddPushNotificationsOnChannelsOperation): pushAudit,
+            @(PNRemovePushNotificationsFromChannelsOperation): pushAudit,
+            @(PNRemoveAllPushNotificationsOperation): pushAudit
+        };
+    });
+
+    return _affectedOperations[@(operation)];
+}
+
+- (void)removeEntryForKey:(NSString *)key {
+
+    if (!key || !_entries[key]) { return; }
+
+    [_entries removeObjectForKey:key];
+    [_usage removeObject:key];
+}
+
+#pragma mark -
+
+
+@end
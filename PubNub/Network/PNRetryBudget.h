@@ -0,0 +1,81 @@
+#import <Foundation/Foundation.h>
+
+
+NS_ASSUME_NONNULL_BEGIN
+
+/**
+ @brief      Client-wide limit for automatic request retries.
+ @discussion Budget work as token bucket: each retry attempt take one token and each successful request
+             return fraction of token (up to maximum number of tokens). During outage requests fail faster
+             than they succeed, so bucket quickly become empty and client stop to multiply load on
+             \b PubNub network with retries until requests start to succeed again.
+
+ @author Sergey Mamontov
+ @since 4.8.2
+ @copyright © 2009-2017 PubNub, Inc.
+ */
+@interface PNRetryBudget : NSObject
+
+
+///------------------------------------------------
+/// @name Information
+///------------------------------------------------
+
+/**
+ @brief  Maximum number of tokens which can be stored in bucket.
+
+ @since 4.8.2
+ */
+@property (nonatomic, readonly, assign) NSUInteger maximumTokens;
+
+/**
+ @brief  Number of retry attempts which can be done right now.
+
+ @since 4.8.2
+ */
+@property (nonatomic, readonly, assign) double tokens;
+
+
+///------------------------------------------------
+/// @name Initialization and Configuration
+///------------------------------------------------
+
+/**
+ @brief  Construct retry budget with full bucket.
+
+ @param maximumTokens Maximum number of retry attempts which can be done in a row without successful requests
+                      (\b 0 disable retries).
+
+ @return Configured and ready to use retry budget.
+
+ @since 4.8.2
+ */
++ (instancetype)budgetWithMaximumTokens:(NSUInteger)maximumTokens;
+
+
+///------------------------------------------------
+/// @name Budget
+///------------------------------------------------
+
+/**
+ @brief  Try to take token for retry attempt.
+
+ @return \c NO in case if budget exhausted and retry shouldn't be done.
+
+ @since 4.8.2
+ */
+- (BOOL)consumeToken;
+
+/**
+ @brief  Return fraction of token to bucket after successful request.
+
+ @since 4.8.2
+ */
+- (void)recordSuccess;
+
+#pragma mark -
+
+
+@end
+
+NS_ASSUME_NONNULL_END
@@ -0,0 +1,133 @@
+/**
+ @author Sergey Mamontov
+ @since 4.8.2
+ @copyright © 2009-2017 PubNub, Inc.
+ */
+#import "PNRetryBudget.h"
+#import "PNLockSupport.h"
+
+
+#pragma mark Static
+
+/**
+ @brief  Fraction of token which is returned to bucket by each successful request.
+ @discussion With this ratio client can't send more than one retry for every ten successful requests for
+             long.
+
+ @since 4.8.2
+ */
+static double const kPNRetryBudgetTokensPerSuccess = 0.1f;
+
+
+NS_ASSUME_NONNULL_BEGIN
+
+#pragma mark - Protected interface declaration
+
+@interface PNRetryBudget ()
+
+
+#pragma mark - Information
+
+@property (nonatomic, assign) NSUInteger maximumTokens;
+@property (nonatomic, assign) double tokens;
+
+/**
+ @brief  Stores reference on lock which is used to protect tokens counter.
+
+ @since 4.8.2
+ */
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wpartial-availability"
+@property (nonatomic, assign) os_unfair_lock lock;
+#pragma clang diagnostic pop
+
+
+#pragma mark - Initialization and Configuration
+
+/**
+ @brief  Initialize retry budget with full bucket.
+
+ @param maximumTokens Maximum number of retry attempts which can be done in a row without successful requests.
+
+ @return Initialized and ready to use retry budget.
+
+ @since 4.8.2
+ */
+- (instancetype)initWithMaximumTokens:(NSUInteger)maximumTokens;
+
+#pragma mark -
+
+
+@end
+
+NS_ASSUME_NONNULL_END
+
+
+#pragma mark - Interface implementation
+
+@implementation PNRetryBudget
+
+
+#pragma mark - Information
+
+- (double)tokens {
+
+    __block double tokens = 0.f;
+    pn_lock(&_lock, ^{ tokens = self->_tokens; });
+
+    return tokens;
+}
+
+
+#pragma mark - Initialization and Configuration
+
++ (instancetype)budgetWithMaximumTokens:(NSUInteger)maximumTokens {
+
+    return [[self alloc] initWithMaximumTokens:maximumTokens];
+}
+
+- (instancetype)initWithMaximumTokens:(NSUInteger)maximumTokens {
+
+    // Check whether initialization was successful or not.
+    if ((self = [super init])) {
+
+        _maximumTokens = maximumTokens;
+        _tokens = maximumTokens;
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wpartial-availability"
+        _lock = OS_UNFAIR_LOCK_INIT;
+#pragma clang diagnostic pop
+    }
+
+    return self;
+}
+
+
+#pragma mark - Budget
+
+- (BOOL)consumeToken {
+
+    __block BOOL consumed = NO;
+    pn_lock(&_lock, ^{
+
+        if (self->_tokens >= 1.f) {
+
+            self->_tokens -= 1.f;
+            consumed = YES;
+        }
+    });
+
+    return consumed;
+}
+
+- (void)recordSuccess {
+
+    pn_lock(&_lock, ^{
+        self->_tokens = MIN(self->_tokens + kPNRetryBudgetTokensPerSuccess, (double)self->_maximumTokens);
+    });
+}
+
+#pragma mark -
+
+
+@end
@@ -0,0 +1,126 @@
+#import <Foundation/Foundation.h>
+
+
+#pragma mark Class forward
+
+@class PNConfiguration;
+
+
+NS_ASSUME_NONNULL_BEGIN
+
+/**
+ @brief      Retry delays calculation engine.
+ @discussion Policy calculate delay before next retry attempt using exponential backoff with decorrelated
+             jitter: each delay randomly chosen between initial delay and tripled previous delay and limited
+             by maximum delay. Random spread prevent clients which lost connection at same time from
+             reconnection in lock-step. Policy also track number of attempts which has been done since last
+             successful request and stop retries as soon as configured retry budget exhausted.
+ 
+ @author Sergey Mamontov
+ @since 4.8.2
+ @copyright © 2009-2017 PubNub, Inc.
+ */
+@interface PNRetryPolicy : NSObject
+
+
+///------------------------------------------------
+/// @name Information
+///------------------------------------------------
+
+/**
+ @brief  Minimum delay before retry attempt.
+ 
+ @since 4.8.2
+ */
+@property (nonatomic, readonly, assign) NSTimeInterval initialDelay;
+
+/**
+ @brief  Maximum delay before retry attempt.
+ 
+ @since 4.8.2
+ */
+@property (nonatomic, readonly, assign) NSTimeInterval maximumDelay;
+
+/**
+ @brief  Maximum number of retry attempts which can be done since last \c -reset call (\b 0 for unlimited
+         number of attempts).
+ 
+ @since 4.8.2
+ */
+@property (nonatomic, readonly, assign) NSUInteger budget;
+
+/**
+ @brief  Number of retry attempts which has been done since last \c -reset call.
+ 
+ @since 4.8.2
+ */
+@property (nonatomic, readonly, assign) NSUInteger attempts;
+
+
+///------------------------------------------------
+/// @name Initialization and Configuration
+///------------------------------------------------
+
+/**
+ @brief  Construct retry policy using delays and budget from client configuration.
+ 
+ @param configuration Reference on configuration which provide \c retryInitialDelay, \c retryMaximumDelay
+                      and \c retryBudget values.
+ 
+ @return Configured and ready to use retry policy.
+ 
+ @since 4.8.2
+ */
++ (instancetype)policyWithConfiguration:(PNConfiguration *)configuration;
+
+/**
+ @brief  Construct retry policy.
+ 
+ @param initialDelay Minimum delay before retry attempt.
+ @param maximumDelay Maximum delay before retry attempt.
+ @param budget       Maximum number of retry attempts (\b 0 for unlimited number of attempts).
+ 
+ @return Configured and ready to use retry policy.
+ 
+ @since 4.8.2
+ */
++ (instancetype)policyWithInitialDelay:(NSTimeInterval)initialDelay maximumDelay:(NSTimeInterval)maximumDelay
+                                budget:(NSUInteger)budget;
+
+
+///------------------------------------------------
+/// @name Retry
+///------------------------------------------------
+
+/**
+ @brief  Check whether retry budget allow one more attempt.
+ 
+ @return \c YES in case if \c -nextDelay will return non-negative delay.
+ 
+ @since 4.8.2
+ */
+- (BOOL)canRetry;
+
+/**
+ @brief      Calculate delay before next retry attempt.
+ @discussion Each call treated as new retry attempt and counted against retry budget.
+ 
+ @return Delay in seconds or \b -1 in case if retry budget exhausted.
+ 
+ @since 4.8.2
+ */
+- (NSTimeInterval)nextDelay;
+
+/**
+ @brief  Reset attempts counter and delay growth after successful request.
+ 
+ @since 4.8.2
+ */
+- (void)reset;
+
+#pragma mark -
+
+
+@end
+
+NS_ASSUME_NONNULL_END
@@ -0,0 +1,142 @@
+/**
+ @author Sergey Mamontov
+ @since 4.8.2
+ @copyright © 2009-2017 PubNub, Inc.
+ */
+#import "PNRetryPolicy.h"
+#import "PNConfiguration.h"
+#import "PNLockSupport.h"
+
+
+NS_ASSUME_NONNULL_BEGIN
+
+#pragma mark Protected interface declaration
+
+@interface PNRetryPolicy ()
+
+
+#pragma mark - Information
+
+@property (nonatomic, assign) NSTimeInterval initialDelay;
+@property (nonatomic, assign) NSTimeInterval maximumDelay;
+@property (nonatomic, assign) NSUInteger budget;
+@property (nonatomic, assign) NSUInteger attempts;
+
+/**
+ @brief  Stores delay which has been returned for previous retry attempt.
+ 
+ @since 4.8.2
+ */
+@property (nonatomic, assign) NSTimeInterval previousDelay;
+
+/**
+ @brief  Stores reference on lock which is used to protect attempts counter and previous delay.
+ 
+ @since 4.8.2
+ */
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wpartial-availability"
+@property (nonatomic, assign) os_unfair_lock lock;
+#pragma clang diagnostic pop
+
+
+#pragma mark - Initialization and Configuration
+
+/**
+ @brief  Initialize retry policy.
+ 
+ @param initialDelay Minimum delay before retry attempt.
+ @param maximumDelay Maximum delay before retry attempt.
+ @param budget       Maximum number of retry attempts (\b 0 for unlimited number of attempts).
+ 
+ @return Initialized and ready to use retry policy.
+ 
+ @since 4.8.2
+ */
+- (instancetype)initWithInitialDelay:(NSTimeInterval)initialDelay maximumDelay:(NSTimeInterval)maximumDelay
+                              budget:(NSUInteger)budget;
+
+#pragma mark -
+
+
+@end
+
+NS_ASSUME_NONNULL_END
+
+
+#pragma mark - Interface implementation
+
+@implementation PNRetryPolicy
+
+
+#pragma mark - Initialization and Configuration
+
++ (instancetype)policyWithConfiguration:(PNConfiguration *)configuration {
+    
+    return [self policyWithInitialDelay:configuration.retryInitialDelay
+                           maximumDelay:configuration.retryMaximumDelay budget:configuration.retryBudget];
+}
+
++ (instancetype)policyWithInitialDelay:(NSTimeInterval)initialDelay maximumDelay:(NSTimeInterval)maximumDelay
+                                budget:(NSUInteger)budget {
+    
+    return [[self alloc] initWithInitialDelay:initialDelay maximumDelay:maximumDelay budget:budget];
+}
+
+- (instancetype)initWithInitialDelay:(NSTimeInterval)initialDelay maximumDelay:(NSTimeInterval)maximumDelay
+                              budget:(NSUInteger)budget {
+    
+    // Check whether initialization was successful or not.
+    if ((self = [super init])) {
+        
+        _initialDelay = MAX(initialDelay, 0.f);
+        _maximumDelay = MAX(maximumDelay, _initialDelay);
+        _budget = budget;
+        _lock = OS_UNFAIR_LOCK_INIT;
+    }
+    
+    return self;
+}
+
+
+#pragma mark - Retry
+
+- (BOOL)canRetry {
+    
+    __block BOOL canRetry = NO;
+    pn_lock(&_lock, ^{ canRetry = (self->_budget == 0 || self->_attempts < self->_budget); });
+    
+    return canRetry;
+}
+
+- (NSTimeInterval)nextDelay {
+    
+    __block NSTimeInterval delay = -1.f;
+    pn_lock(&_lock, ^{
+        
+        if (self->_budget > 0 && self->_attempts >= self->_budget) { return; }
+        
+        // Decorrelated jitter: random delay between initial and tripled previous delay.
+        NSTimeInterval upperBound = MAX(self->_previousDelay, self->_initialDelay) * 3.f;
+        double random = ((double)arc4random() / UINT32_MAX);
+        delay = MIN(self->_maximumDelay, self->_initialDelay + (upperBound - self->_initialDelay) * random);
+        self->_previousDelay = delay;
+        self->_attempts++;
+    });
+    
+    return delay;
+}
+
+- (void)reset {
+    
+    pn_lock(&_lock, ^{
+        
+        self->_attempts = 0;
+        self->_previousDelay = 0.f;
+    });
+}
+
+#pragma mark -
+
+
+@end
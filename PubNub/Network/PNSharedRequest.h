@@ -0,0 +1,108 @@
+#import <Foundation/Foundation.h>
+#import "PNStructures.h"
+#import "PNTransport.h"
+
+
+#pragma mark Class forward
+
+@class PNRequestHandle, PNRequestHedge;
+
+
+NS_ASSUME_NONNULL_BEGIN
+
+/**
+ @brief      Class which is used to track API callers which wait for results of single request.
+ @discussion Request can be shared by identical API calls or sent as set of hedged attempts. Each API caller
+             can be cancelled separately and request tasks cancelled as soon as there is no API callers which
+             wait for its results.
+
+ @author Sergey Mamontov
+ @since 4.8.2
+ @copyright © 2009-2017 PubNub, Inc.
+ */
+@interface PNSharedRequest : NSObject
+
+
+///------------------------------------------------
+/// @name Information
+///------------------------------------------------
+
+/**
+ @brief  Whether all API callers has been cancelled and request tasks shouldn't be sent anymore.
+
+ @since 4.8.2
+ */
+@property (nonatomic, readonly, assign, getter = isCancelled) BOOL cancelled;
+
+
+///------------------------------------------------
+/// @name API callers
+///------------------------------------------------
+
+/**
+ @brief  Add API caller which wait for request processing results.
+
+ @param block  Reference on API call completion block.
+ @param handle Reference on handle which allow user to cancel API call (\c nil if API call can't be
+               cancelled).
+
+ @since 4.8.2
+ */
+- (void)addCompletionBlock:(PNCompletionBlock)block forHandle:(nullable PNRequestHandle *)handle;
+
+/**
+ @brief      Remove cancelled API caller.
+ @discussion Request tasks cancelled if there is no other API callers.
+
+ @param handle Reference on handle which has been used by user to cancel API call.
+
+ @return Reference on API call completion block or \c nil in case if request already completed.
+
+ @since 4.8.2
+ */
+- (nullable PNCompletionBlock)removeCompletionBlockForHandle:(PNRequestHandle *)handle;
+
+/**
+ @brief  Complete request and retrieve completion blocks of API callers which still wait for results.
+
+ @return List of completion blocks which should be called with request processing results.
+
+ @since 4.8.2
+ */
+- (NSArray<PNCompletionBlock> *)complete;
+
+
+///------------------------------------------------
+/// @name Tasks
+///------------------------------------------------
+
+/**
+ @brief      Store task which has been created for request attempt.
+ @discussion Task cancelled right away if all API callers has been cancelled while it has been created.
+
+ @param task Reference on task which should be started.
+
+ @return \c NO in case if task has been cancelled and shouldn't be started.
+
+ @since 4.8.2
+ */
+- (BOOL)addTask:(id <PNTransportTask>)task;
+
+/**
+ @brief      Store object which track hedged attempts of request.
+ @discussion Hedged attempts cancelled right away if all API callers has been cancelled.
+
+ @param hedge Reference on object which track request attempts.
+
+ @return \c NO in case if hedged attempts has been cancelled.
+
+ @since 4.8.2
+ */
+- (BOOL)addHedge:(PNRequestHedge *)hedge;
+
+#pragma mark -
+
+
+@end
+
+NS_ASSUME_NONNULL_END
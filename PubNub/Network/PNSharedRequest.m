@@ -0,0 +1,199 @@
+/**
+ @author Sergey Mamontov
+ @since 4.8.2
+ @copyright © 2009-2017 PubNub, Inc.
+ */
+#import "PNSharedRequest.h"
+#import "PNRequestHedge.h"
+#import "PNLockSupport.h"
+
+
+NS_ASSUME_NONNULL_BEGIN
+
+#pragma mark Protected interface declaration
+
+@interface PNSharedRequest ()
+
+
+#pragma mark - Information
+
+@property (nonatomic, assign, getter = isCancelled) BOOL cancelled;
+
+/**
+ @brief  Stores whether request processing results already passed to API callers.
+
+ @since 4.8.2
+ */
+@property (nonatomic, assign, getter = isCompleted) BOOL completed;
+
+/**
+ @brief  Stores reference on completion blocks of API callers which can be cancelled.
+
+ @since 4.8.2
+ */
+@property (nonatomic, strong) NSMapTable<PNRequestHandle *, PNCompletionBlock> *cancellableBlocks;
+
+/**
+ @brief  Stores reference on completion blocks of API callers which can't be cancelled.
+
+ @since 4.8.2
+ */
+@property (nonatomic, strong) NSMutableArray<PNCompletionBlock> *blocks;
+
+/**
+ @brief  Stores reference on list of tasks which has been created for request attempts.
+
+ @since 4.8.2
+ */
+@property (nonatomic, strong) NSMutableArray<id <PNTransportTask>> *tasks;
+
+/**
+ @brief  Stores reference on list of objects which track hedged request attempts.
+
+ @since 4.8.2
+ */
+@property (nonatomic, strong) NSMutableArray<PNRequestHedge *> *hedges;
+
+/**
+ @brief  Stores reference on lock which is used to protect API callers list and tasks.
+
+ @since 4.8.2
+ */
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wpartial-availability"
+@property (nonatomic, assign) os_unfair_lock lock;
+#pragma clang diagnostic pop
+
+#pragma mark -
+
+
+@end
+
+NS_ASSUME_NONNULL_END
+
+
+#pragma mark - Interface implementation
+
+@implementation PNSharedRequest
+
+
+#pragma mark - Information
+
+- (BOOL)isCancelled {
+
+    __block BOOL cancelled = NO;
+    pn_lock(&_lock, ^{ cancelled = self->_cancelled; });
+
+    return cancelled;
+}
+
+
+#pragma mark - Initialization and Configuration
+
+- (instancetype)init {
+
+    // Check whether initialization was successful or not.
+    if ((self = [super init])) {
+
+        _cancellableBlocks = [NSMapTable strongToStrongObjectsMapTable];
+        _blocks = [NSMutableArray new];
+        _tasks = [NSMutableArray new];
+        _hedges = [NSMutableArray new];
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wpartial-availability"
+        _lock = OS_UNFAIR_LOCK_INIT;
+#pragma clang diagnostic pop
+    }
+
+    return self;
+}
+
+
+#pragma mark - API callers
+
+- (void)addCompletionBlock:(PNCompletionBlock)block forHandle:(PNRequestHandle *)handle {
+
+    pn_lock(&_lock, ^{
+
+        if (handle) { [self->_cancellableBlocks setObject:[block copy] forKey:handle]; }
+        else { [self->_blocks addObject:[block copy]]; }
+    });
+}
+
+- (PNCompletionBlock)removeCompletionBlockForHandle:(PNRequestHandle *)handle {
+
+    __block PNCompletionBlock block = nil;
+    __block NSArray<id <PNTransportTask>> *tasks = nil;
+    __block NSArray<PNRequestHedge *> *hedges = nil;
+    pn_lock(&_lock, ^{
+
+        block = [self->_cancellableBlocks objectForKey:handle];
+        [self->_cancellableBlocks removeObjectForKey:handle];
+        if (!block || self->_completed || self->_blocks.count || self->_cancellableBlocks.count) { return; }
+
+        // Nobody wait for request results anymore.
+        self->_cancelled = YES;
+        tasks = [self->_tasks copy];
+        hedges = [self->_hedges copy];
+        [self->_tasks removeAllObjects];
+        [self->_hedges removeAllObjects];
+    });
+
+    [tasks makeObjectsPerformSelector:@selector(cancel)];
+    [hedges makeObjectsPerformSelector:@selector(cancel)];
+
+    return block;
+}
+
+- (NSArray<PNCompletionBlock> *)complete {
+
+    __block NSMutableArray<PNCompletionBlock> *blocks = nil;
+    pn_lock(&_lock, ^{
+
+        self->_completed = YES;
+        blocks = [self->_blocks mutableCopy];
+        [blocks addObjectsFromArray:self->_cancellableBlocks.objectEnumerator.allObjects];
+        [self->_blocks removeAllObjects];
+        [self->_cancellableBlocks removeAllObjects];
+        [self->_tasks removeAllObjects];
+        [self->_hedges removeAllObjects];
+    });
+
+    return blocks;
+}
+
+
+#pragma mark - Tasks
+
+- (BOOL)addTask:(id <PNTransportTask>)task {
+
+    __block BOOL added = NO;
+    pn_lock(&_lock, ^{
+
+        added = !self->_cancelled;
+        if (added && !self->_completed) { [self->_tasks addObject:task]; }
+    });
+
+    if (!added) { [task cancel]; }
+
+    return added;
+}
+
+- (BOOL)addHedge:(PNRequestHedge *)hedge {
+
+    __block BOOL added = NO;
+    pn_lock(&_lock, ^{
+
+        added = !self->_cancelled;
+        if (added && !self->_completed) { [self->_hedges addObject:hedge]; }
+    });
+
+    if (!added) { [hedge cancel]; }
+
+    return added;
+}
+
+#pragma mark -
+
+
+@end
@@ -0,0 +1,69 @@
+#import <Foundation/Foundation.h>
+#import "PNTransport.h"
+
+
+NS_ASSUME_NONNULL_BEGIN
+
+/**
+ @brief      \c NSURLSession based transport which share connections with all clients in process.
+ @discussion All transports created for long-poll requests use single process-wide session (same is true for
+             non-subscribe requests), so connections to \b PubNub network kept alive and reused by any client
+             and callbacks of all tasks processed by small shared pool of workers instead of separate
+             delegate queue for each client.
+             Each transport track only tasks which has been created with it, so tasks list and invalidation
+             doesn't affect other clients. Shared session invalidated when last transport which use it has
+             been invalidated.
+ @warning    Session doesn't have delegate, so transaction metrics and application extension (background
+             session) mode not supported by this transport.
+
+ @author Sergey Mamontov
+ @since 4.8.2
+ @copyright © 2009-2017 PubNub, Inc.
+ */
+@interface PNSharedURLSessionTransport : NSObject <PNTransport>
+
+
+///------------------------------------------------
+/// @name Information
+///------------------------------------------------
+
+/**
+ @brief      Reference on shared session which is used to send requests.
+ @discussion \c nil after transport invalidation.
+
+ @since 4.8.2
+ */
+@property (nonatomic, nullable, readonly, strong) NSURLSession *session;
+
+/**
+ @brief  Maximum time which transport's requests should wait for response.
+
+ @since 4.8.2
+ */
+@property (nonatomic, readonly, assign) NSTimeInterval requestTimeout;
+
+
+///------------------------------------------------
+/// @name Initialization and Configuration
+///------------------------------------------------
+
+/**
+ @brief  Construct transport which will use process-wide session.
+
+ @param longPollEnabled Whether transport will be used for long-poll requests or not. Long-poll and
+                        non-subscribe requests use separate sessions, so pipelining can be used for
+                        non-subscribe requests.
+ @param timeout         Maximum time which transport's requests should wait for response.
+
+ @return Configured and ready to use transport.
+
+ @since 4.8.2
+ */
++ (instancetype)transportForLongPollRequests:(BOOL)longPollEnabled requestTimeout:(NSTimeInterval)timeout;
+
+#pragma mark -
+
+
+@end
+
+NS_ASSUME_NONNULL_END
@@ -0,0 +1,294 @@
+/**
+ @author Sergey Mamontov
+ @since 4.8.2
+ @copyright © 2009-2017 PubNub, Inc.
+ */
+#import "PNSharedURLSessionTransport.h"
+#import "NSURLSessionConfiguration+PNConfigurationPrivate.h"
+#import "PNLockSupport.h"
+
+
+#pragma mark Static
+
+/**
+ @brief      Maximum number of simultaneously opened connections for each shared session.
+ @discussion Each long-poll request hold own connection while waiting for response, so limit should allow
+             to keep subscribe requests of all clients in process opened at the same time.
+
+ @since 4.8.2
+ */
+static NSInteger const kPNSharedTransportMaximumConnections = 16384;
+
+/**
+ @brief  Maximum number of workers which is used to call completion blocks of all shared sessions tasks.
+
+ @since 4.8.2
+ */
+static NSInteger const kPNSharedTransportWorkersCount = 4;
+
+/**
+ @brief  Stores reference on map of shared session keys to sessions.
+
+ @since 4.8.2
+ */
+static NSMutableDictionary<NSString *, NSURLSession *> *_sharedSessions;
+
+/**
+ @brief  Stores reference on map of shared session keys to number of transports which use them.
+
+ @since 4.8.2
+ */
+static NSMutableDictionary<NSString *, NSNumber *> *_sharedSessionsUsage;
+
+/**
+ @brief  Stores reference on queue which is used by shared sessions to call completion blocks.
+
+ @since 4.8.2
+ */
+static NSOperationQueue *_sharedSessionsQueue;
+
+/**
+ @brief  Stores reference on lock which is used to protect shared sessions registry.
+
+ @since 4.8.2
+ */
+static os_unfair_lock _sharedSessionsLock = OS_UNFAIR_LOCK_INIT;
+
+
+NS_ASSUME_NONNULL_BEGIN
+
+#pragma mark - Protected interface declaration
+
+@interface PNSharedURLSessionTransport ()
+
+
+#pragma mark - Information
+
+@property (nonatomic, nullable, strong) NSURLSession *session;
+@property (nonatomic, assign) NSTimeInterval requestTimeout;
+
+/**
+ @brief  Stores reference on key under which used session is stored in shared sessions registry.
+
+ @since 4.8.2
+ */
+@property (nonatomic, copy) NSString *sessionKey;
+
+/**
+ @brief      Stores reference on tasks which has been created with this transport.
+ @discussion Completed tasks released by session, so they will be removed from table automatically.
+
+ @since 4.8.2
+ */
+@property (nonatomic, strong) NSHashTable<NSURLSessionDataTask *> *tasks;
+
+/**
+ @brief  Stores reference on lock which is used to protect transport's tasks list and session.
+
+ @since 4.8.2
+ */
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wpartial-availability"
+@property (nonatomic, assign) os_unfair_lock lock;
+#pragma clang diagnostic pop
+
+
+#pragma mark - Initialization and Configuration
+
+/**
+ @brief  Initialize transport which will use process-wide session.
+
+ @param longPollEnabled Whether transport will be used for long-poll requests or not.
+ @param timeout         Maximum time which transport's requests should wait for response.
+
+ @return Initialized and ready to use transport.
+
+ @since 4.8.2
+ */
+- (instancetype)initForLongPollRequests:(BOOL)longPollEnabled requestTimeout:(NSTimeInterval)timeout;
+
+
+#pragma mark - Shared sessions
+
+/**
+ @brief      Retrieve shared session for specified key.
+ @discussion Session will be created if there is no transports which use it at this moment.
+
+ @param key             Reference on key under which session is stored in registry.
+ @param longPollEnabled Whether session will be used for long-poll requests or not.
+
+ @return Reference on session which is shared between transports.
+
+ @since 4.8.2
+ */
++ (NSURLSession *)retainSessionForKey:(NSString *)key longPoll:(BOOL)longPollEnabled;
+
+/**
+ @brief      Stop shared session usage by transport.
+ @discussion Session will be invalidated (after scheduled tasks completion) when last transport will release
+             it.
+
+ @param key Reference on key under which session is stored in registry.
+
+ @since 4.8.2
+ */
++ (void)releaseSessionForKey:(NSString *)key;
+
+#pragma mark -
+
+
+@end
+
+NS_ASSUME_NONNULL_END
+
+
+#pragma mark - Interface implementation
+
+@implementation PNSharedURLSessionTransport
+
+
+#pragma mark - Initialization and Configuration
+
++ (instancetype)transportForLongPollRequests:(BOOL)longPollEnabled requestTimeout:(NSTimeInterval)timeout {
+
+    return [[self alloc] initForLongPollRequests:longPollEnabled requestTimeout:timeout];
+}
+
+- (instancetype)initForLongPollRequests:(BOOL)longPollEnabled requestTimeout:(NSTimeInterval)timeout {
+
+    // Check whether initialization was successful or not.
+    if ((self = [super init])) {
+
+        _requestTimeout = timeout;
+        _sessionKey = [(longPollEnabled ? @"subscribe" : @"service") copy];
+        _session = [[self class] retainSessionForKey:_sessionKey longPoll:longPollEnabled];
+        _tasks = [NSHashTable weakObjectsHashTable];
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wpartial-availability"
+        _lock = OS_UNFAIR_LOCK_INIT;
+#pragma clang diagnostic pop
+    }
+
+    return self;
+}
+
+- (void)dealloc {
+
+    if (_session) { [[self class] releaseSessionForKey:_sessionKey]; }
+}
+
+
+#pragma mark - Request processing
+
+- (void)prepareRequest:(NSMutableURLRequest *)request {
+
+    __block NSURLSessionConfiguration *configuration = nil;
+    pn_lock(&_lock, ^{ configuration = self->_session.configuration; });
+
+    request.cachePolicy = configuration.requestCachePolicy;
+    request.allHTTPHeaderFields = configuration.HTTPAdditionalHeaders;
+    request.timeoutInterval = self.requestTimeout;
+}
+
+- (id <PNTransportTask>)taskWithRequest:(NSURLRequest *)request completion:(PNTransportTaskCompletion)block {
+
+    __block NSURLSessionDataTask *task = nil;
+    pn_lock(&_lock, ^{
+
+        NSURLSession *session = self->_session;
+        if (!block) { task = [session dataTaskWithRequest:request]; }
+        else { task = [session dataTaskWithRequest:request completionHandler:block]; }
+        if (task) { [self->_tasks addObject:task]; }
+    });
+
+    return task;
+}
+
+- (void)getTasksWithCompletion:(void(^)(NSArray<id <PNTransportTask>> *tasks))block {
+
+    __block NSMutableArray<NSURLSessionDataTask *> *tasks = [NSMutableArray new];
+    pn_lock(&_lock, ^{
+
+        for (NSURLSessionDataTask *task in self->_tasks) {
+            if (task.state == NSURLSessionTaskStateRunning || task.state == NSURLSessionTaskStateSuspended) {
+                [tasks addObject:task];
+            }
+        }
+    });
+
+    dispatch_async(dispatch_get_global_queue(DISPATCH_QUEUE_PRIORITY_DEFAULT, 0), ^{ block(tasks); });
+}
+
+- (void)invalidate {
+
+    __block NSArray<NSURLSessionDataTask *> *tasks = nil;
+    __block BOOL shouldRelease = NO;
+    pn_lock(&_lock, ^{
+
+        tasks = self->_tasks.allObjects;
+        shouldRelease = self->_session != nil;
+        [self->_tasks removeAllObjects];
+        self->_session = nil;
+    });
+
+    [tasks makeObjectsPerformSelector:@selector(cancel)];
+    if (shouldRelease) { [[self class] releaseSessionForKey:self.sessionKey]; }
+}
+
+
+#pragma mark - Shared sessions
+
++ (NSURLSession *)retainSessionForKey:(NSString *)key longPoll:(BOOL)longPollEnabled {
+
+    __block NSURLSession *session = nil;
+    pn_lock(&_sharedSessionsLock, ^{
+
+        if (!_sharedSessions) {
+
+            _sharedSessions = [NSMutableDictionary new];
+            _sharedSessionsUsage = [NSMutableDictionary new];
+            _sharedSessionsQueue = [NSOperationQueue new];
+            _sharedSessionsQueue.name = @"com.pubnub.network.shared";
+            _sharedSessionsQueue.maxConcurrentOperationCount = kPNSharedTransportWorkersCount;
+        }
+
+        session = _sharedSessions[key];
+        if (!session) {
+
+            NSString *identifier = [@"com.pubnub.network.shared." stringByAppendingString:key];
+            NSURLSessionConfiguration *configuration = nil;
+            configuration = [NSURLSessionConfiguration pn_ephemeralSessionConfigurationWithIdentifier:identifier];
+            configuration.HTTPShouldUsePipelining = !longPollEnabled;
+            configuration.HTTPMaximumConnectionsPerHost = kPNSharedTransportMaximumConnections;
+            session = [NSURLSession sessionWithConfiguration:configuration delegate:nil
+                                               delegateQueue:_sharedSessionsQueue];
+            _sharedSessions[key] = session;
+        }
+        _sharedSessionsUsage[key] = @(_sharedSessionsUsage[key].unsignedIntegerValue + 1);
+    });
+
+    return session;
+}
+
++ (void)releaseSessionForKey:(NSString *)key {
+
+    __block NSURLSession *session = nil;
+    pn_lock(&_sharedSessionsLock, ^{
+
+        NSUInteger usage = _sharedSessionsUsage[key].unsignedIntegerValue;
+        if (usage > 1) { _sharedSessionsUsage[key] = @(usage - 1); }
+        else {
+
+            session = _sharedSessions[key];
+            [_sharedSessions removeObjectForKey:key];
+            [_sharedSessionsUsage removeObjectForKey:key];
+        }
+    });
+
+    [session finishTasksAndInvalidate];
+}
+
+#pragma mark -
+
+
+@end
@@ -0,0 +1,57 @@
+#import <Foundation/Foundation.h>
+#import "PNTransport.h"
+
+
+NS_ASSUME_NONNULL_BEGIN
+
+/**
+ @brief      \c NSURLSession based transport.
+ @discussion Default transport which is used by \b PubNub network manager to send requests to \b PubNub
+             network. Transport act as session delegate to stream response body of tasks created with
+             \c -taskWithRequest:dataHandler:completion: and forward all other session and task level
+             callbacks (like metrics or invalidation) to passed delegate.
+ 
+ @author Sergey Mamontov
+ @since 4.8.2
+ @copyright © 2009-2017 PubNub, Inc.
+ */
+@interface PNURLSessionTransport : NSObject <PNTransport>
+
+
+///------------------------------------------------
+/// @name Information
+///------------------------------------------------
+
+/**
+ @brief  Reference on session which is used to send requests.
+ 
+ @since 4.8.2
+ */
+@property (nonatomic, readonly, strong) NSURLSession *session;
+
+
+///------------------------------------------------
+/// @name Initialization and Configuration
+///------------------------------------------------
+
+/**
+ @brief  Construct transport which will use session with specified configuration.
+ 
+ @param configuration Reference on configuration which should be used to create session.
+ @param delegate      Reference on object which should receive session and tasks callbacks.
+ @param queue         Reference on queue on which \c delegate callbacks and completion blocks should be called.
+ 
+ @return Configured and ready to use transport.
+ 
+ @since 4.8.2
+ */
++ (instancetype)transportWithConfiguration:(NSURLSessionConfiguration *)configuration
+                                  delegate:(nullable id <NSURLSessionDelegate>)delegate
+                             delegateQueue:(nullable NSOperationQueue *)queue;
+
+#pragma mark -
+
+
+@end
+
+NS_ASSUME_NONNULL_END
@@ -0,0 +1,237 @@
+/**
+ @author Sergey Mamontov
+ @since 4.8.2
+ @copyright © 2009-2017 PubNub, Inc.
+ */
+#import "PNURLSessionTransport.h"
+#import "PNLockSupport.h"
+#import "PNDefines.h"
+
+
+NS_ASSUME_NONNULL_BEGIN
+
+#pragma mark Protected interface declaration
+
+@interface PNURLSessionTransport () <NSURLSessionDataDelegate>
+
+
+#pragma mark - Information
+
+@property (nonatomic, strong) NSURLSession *session;
+
+/**
+ @brief      Stores reference on object which should receive session and tasks callbacks.
+ @discussion Transport act as session delegate to deliver response body portions of streaming tasks and
+             forward all other callbacks to this object.
+ 
+ @since 4.8.2
+ */
+@property (nonatomic, nullable, weak) id <NSURLSessionDelegate> delegate;
+
+/**
+ @brief  Stores reference on map of streaming task identifiers to their response body handlers.
+ 
+ @since 4.8.2
+ */
+@property (nonatomic, strong) NSMutableDictionary<NSNumber *, PNTransportTaskDataHandler> *dataHandlers;
+
+/**
+ @brief  Stores reference on map of streaming task identifiers to their completion blocks.
+ 
+ @since 4.8.2
+ */
+@property (nonatomic, strong) NSMutableDictionary<NSNumber *, PNTransportTaskCompletion> *completionBlocks;
+
+/**
+ @brief  Stores reference on lock which is used to protect streaming tasks handlers.
+ 
+ @since 4.8.2
+ */
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wpartial-availability"
+@property (nonatomic, assign) os_unfair_lock lock;
+#pragma clang diagnostic pop
+
+
+#pragma mark - Initialization and Configuration
+
+/**
+ @brief  Initialize transport which will use session with specified configuration.
+ 
+ @param configuration Reference on configuration which should be used to create session.
+ @param delegate      Reference on object which should receive session and tasks callbacks.
+ @param queue         Reference on queue on which \c delegate callbacks and completion blocks should be called.
+ 
+ @return Initialized and ready to use transport.
+ 
+ @since 4.8.2
+ */
+- (instancetype)initWithConfiguration:(NSURLSessionConfiguration *)configuration
+                             delegate:(nullable id <NSURLSessionDelegate>)delegate
+                        delegateQueue:(nullable NSOperationQueue *)queue;
+
+#pragma mark -
+
+
+@end
+
+NS_ASSUME_NONNULL_END
+
+
+#pragma mark - Interface implementation
+
+@implementation PNURLSessionTransport
+
+
+#pragma mark - Initialization and Configuration
+
++ (instancetype)transportWithConfiguration:(NSURLSessionConfiguration *)configuration
+                                  delegate:(id <NSURLSessionDelegate>)delegate
+                             delegateQueue:(NSOperationQueue *)queue {
+    
+    return [[self alloc] initWithConfiguration:configuration delegate:delegate delegateQueue:queue];
+}
+
+- (instancetype)initWithConfiguration:(NSURLSessionConfiguration *)configuration
+                             delegate:(id <NSURLSessionDelegate>)delegate
+                        delegateQueue:(NSOperationQueue *)queue {
+    
+    // Check whether initialization was successful or not.
+    if ((self = [super init])) {
+        
+        _delegate = delegate;
+        _dataHandlers = [NSMutableDictionary new];
+        _completionBlocks = [NSMutableDictionary new];
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wpartial-availability"
+        _lock = OS_UNFAIR_LOCK_INIT;
+#pragma clang diagnostic pop
+        _session = [NSURLSession sessionWithConfiguration:configuration delegate:self delegateQueue:queue];
+    }
+    
+    return self;
+}
+
+
+#pragma mark - Request processing
+
+- (void)prepareRequest:(NSMutableURLRequest *)request {
+    
+    request.cachePolicy = self.session.configuration.requestCachePolicy;
+    request.allHTTPHeaderFields = self.session.configuration.HTTPAdditionalHeaders;
+}
+
+- (id <PNTransportTask>)taskWithRequest:(NSURLRequest *)request completion:(PNTransportTaskCompletion)block {
+    
+    if (!block) { return [self.session dataTaskWithRequest:request]; }
+    
+    return [self.session dataTaskWithRequest:request completionHandler:block];
+}
+
+- (id <PNTransportTask>)taskWithRequest:(NSURLRequest *)request dataHandler:(PNTransportTaskDataHandler)dataHandler
+                             completion:(PNTransportTaskCompletion)block {
+    
+    NSURLSessionDataTask *task = [self.session dataTaskWithRequest:request];
+    pn_lock(&_lock, ^{
+        
+        self->_dataHandlers[@(task.taskIdentifier)] = [dataHandler copy];
+        self->_completionBlocks[@(task.taskIdentifier)] = [block copy];
+    });
+    
+    return task;
+}
+
+- (void)getTasksWithCompletion:(void(^)(NSArray<id <PNTransportTask>> *tasks))block {
+    
+    [self.session getTasksWithCompletionHandler:^(NSArray<NSURLSessionDataTask *> *dataTasks,
+                                                  __unused NSArray *uploadTasks,
+                                                  __unused NSArray *downloadTasks) {
+        
+        block(dataTasks);
+    }];
+}
+
+- (void)invalidate {
+    
+    [self.session invalidateAndCancel];
+}
+
+
+#pragma mark - Session delegate
+
+- (void)URLSession:(NSURLSession *)session didBecomeInvalidWithError:(NSError *)error {
+    
+    id <NSURLSessionDelegate> delegate = self.delegate;
+    if ([delegate respondsToSelector:@selector(URLSession:didBecomeInvalidWithError:)]) {
+        
+        [delegate URLSession:session didBecomeInvalidWithError:error];
+    }
+}
+
+- (void)URLSession:(NSURLSession *)session dataTask:(NSURLSessionDataTask *)dataTask
+    didReceiveData:(NSData *)data {
+    
+    __block PNTransportTaskDataHandler dataHandler = nil;
+    pn_lock(&_lock, ^{ dataHandler = self->_dataHandlers[@(dataTask.taskIdentifier)]; });
+    
+    if (dataHandler) { dataHandler(data); }
+    else {
+        
+        id <NSURLSessionDataDelegate> delegate = (id <NSURLSessionDataDelegate>)self.delegate;
+        if ([delegate respondsToSelector:@selector(URLSession:dataTask:didReceiveData:)]) {
+            
+            [delegate URLSession:session dataTask:dataTask didReceiveData:data];
+        }
+    }
+}
+
+- (void)URLSession:(NSURLSession *)session task:(NSURLSessionTask *)task didCompleteWithError:(NSError *)error {
+    
+    __block PNTransportTaskCompletion block = nil;
+    pn_lock(&_lock, ^{
+        
+        block = self->_completionBlocks[@(task.taskIdentifier)];
+        [self->_dataHandlers removeObjectForKey:@(task.taskIdentifier)];
+        [self->_completionBlocks removeObjectForKey:@(task.taskIdentifier)];
+    });
+    
+    if (block) { block(nil, task.response, error); }
+    else {
+        
+        id <NSURLSessionTaskDelegate> delegate = (id <NSURLSessionTaskDelegate>)self.delegate;
+        if ([delegate respondsToSelector:@selector(URLSession:task:didCompleteWithError:)]) {
+            
+            [delegate URLSession:session task:task didCompleteWithError:error];
+        }
+    }
+}
+
+#if PN_URLSESSION_TRANSACTION_METRICS_AVAILABLE
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wpartial-availability"
+- (void)          URLSession:(NSURLSession *)session task:(NSURLSessionTask *)task 
+  didFinishCollectingMetrics:(NSURLSessionTaskMetrics *)metrics {
+    
+    id <NSURLSessionTaskDelegate> delegate = (id <NSURLSessionTaskDelegate>)self.delegate;
+    if ([delegate respondsToSelector:@selector(URLSession:task:didFinishCollectingMetrics:)]) {
+        
+        [delegate URLSession:session task:task didFinishCollectingMetrics:metrics];
+    }
+}
+#pragma clang diagnostic pop
+#endif // PN_URLSESSION_TRANSACTION_METRICS_AVAILABLE
+
+#pragma mark -
+
+
+@end
+
+
+#pragma mark - Interface implementation
+
+@implementation NSURLSessionDataTask (PNTransportTask)
+
+#pragma mark -
+
+
+@end
@@ -20,6 +20,39 @@
 @interface PNSubscribeParser : NSObject <PNParser>
 
 
+///------------------------------------------------
+/// @name Incremental parsing
+///------------------------------------------------
+
+/**
+ @brief      Process single real-time event from subscribe response.
+ @discussion Used by incremental subscribe response parser to process events as soon as they arrive.
+ 
+ @param data           De-serialized from JSON event envelope.
+ @param additionalData Reference on dictionary which stores additional data which can be used by parser to 
+                       complete parsing.
+ 
+ @return Pre-processed event information.
+ 
+ @since 4.8.2
+ */
++ (NSMutableDictionary *)parsedEvent:(NSDictionary<NSString *, id> *)data
+                            withData:(nullable NSDictionary<NSString *, id> *)additionalData;
+
+/**
+ @brief  Compose parsed subscribe response from pre-processed events.
+ 
+ @param timeTokenData De-serialized from JSON time token information (value stored under \c t key).
+ @param events        List of events which has been processed with \c +parsedEvent:withData:. Events without
+                      own time token will receive time token from \c timeTokenData.
+ 
+ @return Parsed service response (same as provided by \c +parsedServiceResponse:withData:).
+ 
+ @since 4.8.2
+ */
++ (NSDictionary<NSString *, id> *)parsedServiceResponseWithTimeToken:(nullable NSDictionary *)timeTokenData
+                                                              events:(NSArray<NSMutableDictionary *> *)events;
+
 #pragma mark -
 
 
@@ -270,32 +270,45 @@ NS_ASSUME_NONNULL_END
     // Array will arrive in case of subscription event
     if ([response isKindOfClass:[NSDictionary class]]) {
         
-        NSDictionary<NSString *, NSString *> *timeTokenDictionary = response[kPNResponseEventTimeKey];
-        NSNumber *timeToken = @(timeTokenDictionary[PNEventTimeToken.timeToken].longLongValue);
-        NSNumber *region = @(timeTokenDictionary[PNEventTimeToken.region].longLongValue);
-        
         // Checking whether at least one event arrived or not.
         NSArray<NSDictionary *> *feedEvents = response[kPNResponseEventsListKey];
-        if (feedEvents.count) {
+        NSMutableArray<NSMutableDictionary *> *events = [[NSMutableArray alloc] initWithCapacity:feedEvents.count];
+        for (NSUInteger eventIdx = 0; eventIdx < [feedEvents count]; eventIdx++) {
             
-            NSMutableArray<NSDictionary *> *events = [[NSMutableArray alloc] initWithCapacity:feedEvents.count];
-            for (NSUInteger eventIdx = 0; eventIdx < [feedEvents count]; eventIdx++) {
-                
-                // Fetching remote data object name on which event fired.
-                NSMutableDictionary *event = [self eventFromData:feedEvents[eventIdx]
-                                        withAdditionalParserData:additionalData];
-                if (!event[@"timetoken"]) { event[@"timetoken"] = timeToken; }
-                [events addObject:event];
-            }
-            feedEvents = [events copy];
+            // Fetching remote data object name on which event fired.
+            [events addObject:[self eventFromData:feedEvents[eventIdx] withAdditionalParserData:additionalData]];
         }
-        processedResponse = @{@"events": feedEvents, @"timetoken": timeToken, @"region": region};
+        processedResponse = [self parsedServiceResponseWithTimeToken:response[kPNResponseEventTimeKey]
+                                                              events:events];
     }
     
     return processedResponse;
 }
 
 
+#pragma mark - Incremental parsing
+
++ (NSMutableDictionary *)parsedEvent:(NSDictionary<NSString *, id> *)data
+                            withData:(NSDictionary<NSString *, id> *)additionalData {
+    
+    return [self eventFromData:data withAdditionalParserData:additionalData];
+}
+
++ (NSDictionary<NSString *, id> *)parsedServiceResponseWithTimeToken:(NSDictionary *)timeTokenData
+                                                              events:(NSArray<NSMutableDictionary *> *)events {
+    
+    NSDictionary<NSString *, NSString *> *timeTokenDictionary = timeTokenData;
+    NSNumber *timeToken = @(timeTokenDictionary[PNEventTimeToken.timeToken].longLongValue);
+    NSNumber *region = @(timeTokenDictionary[PNEventTimeToken.region].longLongValue);
+    for (NSMutableDictionary *event in events) {
+        
+        if (!event[@"timetoken"]) { event[@"timetoken"] = timeToken; }
+    }
+    
+    return @{@"events": [events copy], @"timetoken": timeToken, @"region": region};
+}
+
+
 #pragma mark - Events processing
 
 + (NSMutableDictionary *)eventFromData:(NSDictionary<NSString *, id> *)data
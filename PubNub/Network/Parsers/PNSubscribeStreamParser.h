@@ -0,0 +1,98 @@
+#import <Foundation/Foundation.h>
+
+
+NS_ASSUME_NONNULL_BEGIN
+
+/**
+ @brief      Class which is used to incrementally parse subscribe response while it is received.
+ @discussion Parser scan response body portions and de-serialize each element of events list as soon as it
+             has been received completelly, so only currently received event stored in buffer and whole
+             response body never kept in memory. Processed events accumulated to build parsed response with
+             same format as \b PNSubscribeParser provide. Events delivered to subscriber only with complete
+             response, because de-duplication and next time token depend on whole events list.
+ @warning    Parser doesn't serialize access to it's state. Caller responsible for passing response body
+             portions in order from the same queue.
+
+ @author Sergey Mamontov
+ @since 4.8.2
+ @copyright © 2009-2017 PubNub, Inc.
+ */
+@interface PNSubscribeStreamParser : NSObject
+
+
+///------------------------------------------------
+/// @name Information
+///------------------------------------------------
+
+/**
+ @brief      Maximum size of single event (in bytes) which can be buffered by parser.
+ @discussion Parsing will fail if event exceed this limit.
+
+ @since 4.8.2
+ */
+@property (nonatomic, readonly, assign) NSUInteger maximumBufferSize;
+
+/**
+ @brief  Number of events which has been processed so far.
+
+ @since 4.8.2
+ */
+@property (nonatomic, readonly, assign) NSUInteger eventsCount;
+
+/**
+ @brief  Reference on error which caused parsing failure.
+
+ @since 4.8.2
+ */
+@property (nonatomic, nullable, readonly, strong) NSError *error;
+
+
+///------------------------------------------------
+/// @name Initialization and Configuration
+///------------------------------------------------
+
+/**
+ @brief  Construct parser for single subscribe response.
+
+ @param additionalData Reference on dictionary which stores additional data which should be used to process
+                       events (like cipher key).
+ @param size           Maximum size of single event (in bytes) which can be buffered by parser.
+
+ @return Configured and ready to use parser.
+
+ @since 4.8.2
+ */
++ (instancetype)parserWithAdditionalData:(nullable NSDictionary<NSString *, id> *)additionalData
+                       maximumBufferSize:(NSUInteger)size;
+
+
+///------------------------------------------------
+/// @name Parsing
+///------------------------------------------------
+
+/**
+ @brief  Process next portion of response body.
+
+ @param data Reference on received portion of response body.
+
+ @return \c NO in case if response can't be parsed (\c error will be set).
+
+ @since 4.8.2
+ */
+- (BOOL)appendData:(NSData *)data;
+
+/**
+ @brief  Complete response parsing.
+
+ @return Parsed service response or \c nil in case if response has been malformed or incomplete.
+
+ @since 4.8.2
+ */
+- (nullable NSDictionary<NSString *, id> *)finish;
+
+#pragma mark -
+
+
+@end
+
+NS_ASSUME_NONNULL_END
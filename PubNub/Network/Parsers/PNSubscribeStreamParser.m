@@ -0,0 +1,371 @@
+/**
+ @author Sergey Mamontov
+ @since 4.8.2
+ @copyright © 2009-2017 PubNub, Inc.
+ */
+#import "PNSubscribeStreamParser.h"
+#import "PNSubscribeParser.h"
+
+
+#pragma mark Static
+
+/**
+ @brief  Stores reference on key under which stored information about when event has been triggered by server
+         and from which region.
+
+ @since 4.8.2
+ */
+static char const kPNStreamEventTimeKey = 't';
+
+/**
+ @brief  Stores reference on key under which list of events is stored.
+
+ @since 4.8.2
+ */
+static char const kPNStreamEventsListKey = 'm';
+
+
+NS_ASSUME_NONNULL_BEGIN
+
+#pragma mark - Protected interface declaration
+
+@interface PNSubscribeStreamParser ()
+
+
+#pragma mark - Information
+
+@property (nonatomic, assign) NSUInteger maximumBufferSize;
+@property (nonatomic, nullable, strong) NSError *error;
+
+/**
+ @brief  Stores reference on additional data which should be used to process events.
+
+ @since 4.8.2
+ */
+@property (nonatomic, nullable, strong) NSDictionary<NSString *, id> *additionalData;
+
+/**
+ @brief  Stores reference on buffer for currently received value (time token or event).
+
+ @since 4.8.2
+ */
+@property (nonatomic, strong) NSMutableData *buffer;
+
+/**
+ @brief  Stores reference on list of processed events.
+
+ @since 4.8.2
+ */
+@property (nonatomic, strong) NSMutableArray<NSMutableDictionary *> *events;
+
+/**
+ @brief  Stores reference on de-serialized time token information.
+
+ @since 4.8.2
+ */
+@property (nonatomic, nullable, strong) NSDictionary *timeToken;
+
+/**
+ @brief  Stores current nesting level (\b 1 inside of response object).
+
+ @since 4.8.2
+ */
+@property (nonatomic, assign) NSInteger depth;
+
+/**
+ @brief  Stores nesting level at which currently buffered value has been started (\b -1 if value not
+         buffered).
+
+ @since 4.8.2
+ */
+@property (nonatomic, assign) NSInteger captureDepth;
+
+/**
+ @brief  Stores whether parser is inside of string or not.
+
+ @since 4.8.2
+ */
+@property (nonatomic, assign) BOOL inString;
+
+/**
+ @brief  Stores whether previous character inside of string was escape character or not.
+
+ @since 4.8.2
+ */
+@property (nonatomic, assign) BOOL escaped;
+
+/**
+ @brief  Stores whether parser expect response object key or not.
+
+ @since 4.8.2
+ */
+@property (nonatomic, assign) BOOL expectingKey;
+
+/**
+ @brief  Stores whether parser is inside of events list or not.
+
+ @since 4.8.2
+ */
+@property (nonatomic, assign) BOOL inEvents;
+
+/**
+ @brief      Stores first character of last response object key.
+ @discussion Only single character keys are tracked (\b 0 for any other keys).
+
+ @since 4.8.2
+ */
+@property (nonatomic, assign) char key;
+
+/**
+ @brief  Stores length of currently received response object key.
+
+ @since 4.8.2
+ */
+@property (nonatomic, assign) NSUInteger keyLength;
+
+
+#pragma mark - Initialization and Configuration
+
+/**
+ @brief  Initialize parser for single subscribe response.
+
+ @param additionalData Reference on dictionary which stores additional data which should be used to process
+                       events.
+ @param size           Maximum size of single event (in bytes) which can be buffered by parser.
+
+ @return Initialized and ready to use parser.
+
+ @since 4.8.2
+ */
+- (instancetype)initWithAdditionalData:(nullable NSDictionary<NSString *, id> *)additionalData
+                     maximumBufferSize:(NSUInteger)size;
+
+
+#pragma mark - Parsing
+
+/**
+ @brief  Append bytes of currently received value to buffer.
+
+ @param bytes  Pointer on first byte which should be appended.
+ @param length Number of bytes which should be appended.
+
+ @return \c NO in case if buffer size limit has been exceeded.
+
+ @since 4.8.2
+ */
+- (BOOL)appendBytes:(const uint8_t *)bytes length:(NSUInteger)length;
+
+/**
+ @brief  De-serialize buffered value and process it as time token information or event.
+
+ @return \c NO in case if buffered value can't be de-serialized.
+
+ @since 4.8.2
+ */
+- (BOOL)processBufferedValue;
+
+
+#pragma mark - Misc
+
+/**
+ @brief  Complete parsing with error.
+
+ @param description Reference on parsing error description.
+
+ @return \c NO, so it can be returned right away.
+
+ @since 4.8.2
+ */
+- (BOOL)failWithDescription:(NSString *)description;
+
+#pragma mark -
+
+
+@end
+
+NS_ASSUME_NONNULL_END
+
+
+#pragma mark - Interface implementation
+
+@implementation PNSubscribeStreamParser
+
+
+#pragma mark - Information
+
+- (NSUInteger)eventsCount {
+
+    return self.events.count;
+}
+
+
+#pragma mark - Initialization and Configuration
+
++ (instancetype)parserWithAdditionalData:(NSDictionary<NSString *, id> *)additionalData
+                       maximumBufferSize:(NSUInteger)size {
+
+    return [[self alloc] initWithAdditionalData:additionalData maximumBufferSize:size];
+}
+
+- (instancetype)initWithAdditionalData:(NSDictionary<NSString *, id> *)additionalData
+                     maximumBufferSize:(NSUInteger)size {
+
+    // Check whether initialization was successful or not.
+    if ((self = [super init])) {
+
+        _additionalData = additionalData;
+        _maximumBufferSize = size;
+        _buffer = [NSMutableData new];
+        _events = [NSMutableArray new];
+        _captureDepth = -1;
+    }
+
+    return self;
+}
+
+
+#pragma mark - Parsing
+
+- (BOOL)appendData:(NSData *)data {
+
+    if (self.error) { return NO; }
+
+    const uint8_t *bytes = data.bytes;
+    NSUInteger length = data.length;
+    NSUInteger captureStart = 0;
+    for (NSUInteger byteIdx = 0; byteIdx < length; byteIdx++) {
+
+        uint8_t byte = bytes[byteIdx];
+        if (_inString) {
+
+            if (_escaped) { _escaped = NO; }
+            else if (byte == '\\') { _escaped = YES; }
+            else if (byte == '"') { _inString = NO; }
+            else if (_depth == 1 && _expectingKey) { _key = (_keyLength++ == 0 ? (char)byte : 0); }
+            continue;
+        }
+
+        switch (byte) {
+            case '"':
+                _inString = YES;
+                if (_depth == 1 && _expectingKey) {
+
+                    _key = 0;
+                    _keyLength = 0;
+                }
+                break;
+            case '{':
+            case '[':
+                if (_depth == 0 && byte != '{') { return [self failWithDescription:@"Unexpected response."]; }
+                if (_depth == 1 && !_expectingKey && _keyLength == 1) {
+
+                    if (_key == kPNStreamEventsListKey && byte == '[') { _inEvents = YES; }
+                    else if (_key == kPNStreamEventTimeKey && byte == '{') {
+
+                        _captureDepth = _depth;
+                        captureStart = byteIdx;
+                    }
+                }
+                else if (_inEvents && _depth == 2 && _captureDepth < 0) {
+
+                    _captureDepth = _depth;
+                    captureStart = byteIdx;
+                }
+                _depth++;
+                if (_depth == 1) { _expectingKey = YES; }
+                break;
+            case '}':
+            case ']':
+                _depth--;
+                if (_depth < 0) { return [self failWithDescription:@"Unbalanced response."]; }
+                if (_captureDepth >= 0 && _depth == _captureDepth) {
+
+                    if (![self appendBytes:(bytes + captureStart) length:(byteIdx - captureStart + 1)] ||
+                        ![self processBufferedValue]) {
+
+                        return NO;
+                    }
+                    _captureDepth = -1;
+                }
+                else if (_inEvents && _depth == 1) { _inEvents = NO; }
+                break;
+            case ':':
+                if (_depth == 1) { _expectingKey = NO; }
+                break;
+            case ',':
+                if (_depth == 1) {
+
+                    _expectingKey = YES;
+                    _keyLength = 0;
+                }
+                break;
+            default:
+                break;
+        }
+    }
+
+    if (_captureDepth >= 0) { return [self appendBytes:(bytes + captureStart) length:(length - captureStart)]; }
+
+    return YES;
+}
+
+- (NSDictionary<NSString *, id> *)finish {
+
+    if (!self.error && (self.depth != 0 || self.captureDepth >= 0 || self.inString)) {
+
+        [self failWithDescription:@"Incomplete response."];
+    }
+    if (self.error) { return nil; }
+
+    NSDictionary *response = [PNSubscribeParser parsedServiceResponseWithTimeToken:self.timeToken
+                                                                            events:self.events];
+    [self.events removeAllObjects];
+
+    return response;
+}
+
+- (BOOL)appendBytes:(const uint8_t *)bytes length:(NSUInteger)length {
+
+    if (self.buffer.length + length > self.maximumBufferSize) {
+
+        return [self failWithDescription:@"Event exceed maximum buffer size."];
+    }
+    [self.buffer appendBytes:bytes length:length];
+
+    return YES;
+}
+
+- (BOOL)processBufferedValue {
+
+    id value = nil;
+    @autoreleasepool {
+        value = [NSJSONSerialization JSONObjectWithData:self.buffer options:(NSJSONReadingOptions)0 error:NULL];
+    }
+    self.buffer.length = 0;
+    if (![value isKindOfClass:[NSDictionary class]]) { return [self failWithDescription:@"Malformed value."]; }
+
+    if (!self.inEvents) { self.timeToken = value; }
+    else {
+
+        [self.events addObject:[PNSubscribeParser parsedEvent:value withData:self.additionalData]];
+    }
+
+    return YES;
+}
+
+
+#pragma mark - Misc
+
+- (BOOL)failWithDescription:(NSString *)description {
+
+    self.buffer.length = 0;
+    self.error = [NSError errorWithDomain:NSURLErrorDomain code:NSURLErrorCannotParseResponse
+                                 userInfo:@{NSLocalizedDescriptionKey: description}];
+
+    return NO;
+}
+
+#pragma mark -
+
+
+@end
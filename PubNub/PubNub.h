@@ -20,6 +20,7 @@
 #import "PNAcknowledgmentStatus.h"
 #import "PNChannelGroupsResult.h"
 #import "PNClientInformation.h"
+#import "PNRequestHandle.h"
 #import "PNSubscriberResults.h"
 #import "PNSubscribeStatus.h"
 #import "PNPublishStatus.h"
@@ -0,0 +1,81 @@
+#import <XCTest/XCTest.h>
+#import <PubNub/PubNub.h>
+
+
+#pragma mark Class forward
+
+@class PNLoopbackTransport;
+
+
+NS_ASSUME_NONNULL_BEGIN
+
+/**
+ @brief      Base class for test cases which work with client without access to \b PubNub network.
+ @discussion Provide client which deliver callbacks on serial queue, loopback transports for client's network
+             managers and run loop based condition waiting. Test case registered as client's listener and
+             removed from it along with networks invalidation on tear down.
+
+ @author Sergey Mamontov
+ @copyright © 2009-2017 PubNub, Inc.
+ */
+@interface PNLoopbackClientTestCase : XCTestCase <PNObjectEventListener>
+
+
+#pragma mark - Properties
+
+/**
+ @brief  Stores reference on client which has been created for test.
+ */
+@property (nonatomic, nullable, strong) PubNub *client;
+
+/**
+ @brief  Stores reference on queue on which client deliver events to listeners.
+ */
+@property (nonatomic, strong) dispatch_queue_t callbackQueue;
+
+/**
+ @brief  Stores reference on transport which is used by client's subscription network manager.
+ */
+@property (nonatomic, nullable, strong) PNLoopbackTransport *transport;
+
+/**
+ @brief  Stores reference on transport which is used by client's non-subscribe network manager.
+ */
+@property (nonatomic, nullable, strong) PNLoopbackTransport *serviceTransport;
+
+
+#pragma mark - Client
+
+/**
+ @brief  Create client which deliver callbacks on \c callbackQueue and register test case as listener.
+
+ @param configuration Reference on configuration which should be used by client.
+ */
+- (void)createClientWithConfiguration:(PNConfiguration *)configuration;
+
+/**
+ @brief  Replace client's network managers with managers which send requests through loopback transports.
+
+ @param maximumConnections Maximum number of concurrent subscribe requests.
+ */
+- (void)useLoopbackTransportWithMaximumSubscribeConnections:(NSUInteger)maximumConnections;
+
+
+#pragma mark - Misc
+
+/**
+ @brief  Run current run loop till condition will be satisfied or timeout.
+
+ @param timeout   Maximum time during which condition should be checked.
+ @param condition Reference on block which return whether expected state has been reached or not.
+
+ @return \c YES in case if condition satisfied before timeout.
+ */
+- (BOOL)waitFor:(NSTimeInterval)timeout condition:(BOOL(^)(void))condition;
+
+#pragma mark -
+
+
+@end
+
+NS_ASSUME_NONNULL_END
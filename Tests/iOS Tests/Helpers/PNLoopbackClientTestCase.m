@@ -0,0 +1,73 @@
+#import "PNLoopbackClientTestCase.h"
+#import "PubNub+CorePrivate.h"
+#import "PNLoopbackTransport.h"
+#import "PNNetwork.h"
+
+
+#pragma mark Test case implementation
+
+@implementation PNLoopbackClientTestCase
+
+- (void)setUp {
+
+    // Forward method call to the super class.
+    [super setUp];
+
+
+    // Prepare 'fixtures'
+    self.callbackQueue = dispatch_queue_create("com.pubnub.tests.callback", DISPATCH_QUEUE_SERIAL);
+}
+
+- (void)tearDown {
+
+    [self.client removeListener:self];
+    if (self.transport) {
+        [self.client.subscriptionNetwork invalidate];
+        [self.client.serviceNetwork invalidate];
+    }
+
+    // Forward method call to the super class.
+    [super tearDown];
+}
+
+
+#pragma mark - Client
+
+- (void)createClientWithConfiguration:(PNConfiguration *)configuration {
+
+    self.client = [PubNub clientWithConfiguration:configuration callbackQueue:self.callbackQueue];
+    [self.client addListener:self];
+}
+
+- (void)useLoopbackTransportWithMaximumSubscribeConnections:(NSUInteger)maximumConnections {
+
+    self.transport = [PNLoopbackTransport transport];
+    self.serviceTransport = [PNLoopbackTransport transport];
+    [self.client.subscriptionNetwork invalidate];
+    [self.client.serviceNetwork invalidate];
+    [self.client setValue:[PNNetwork networkForClient:self.client requestTimeout:310
+                                   maximumConnections:maximumConnections longPoll:YES
+                                            transport:self.transport]
+                   forKey:@"subscriptionNetwork"];
+    [self.client setValue:[PNNetwork networkForClient:self.client requestTimeout:10 maximumConnections:3
+                                             longPoll:NO transport:self.serviceTransport]
+                   forKey:@"serviceNetwork"];
+}
+
+
+#pragma mark - Misc
+
+- (BOOL)waitFor:(NSTimeInterval)timeout condition:(BOOL(^)(void))condition {
+
+    NSDate *timeoutDate = [NSDate dateWithTimeIntervalSinceNow:timeout];
+    while (!condition() && [timeoutDate timeIntervalSinceNow] > 0) {
+        [[NSRunLoop currentRunLoop] runUntilDate:[NSDate dateWithTimeIntervalSinceNow:0.01]];
+    }
+
+    return condition();
+}
+
+#pragma mark -
+
+
+@end
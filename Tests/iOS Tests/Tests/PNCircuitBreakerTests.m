@@ -0,0 +1,198 @@
+#import <XCTest/XCTest.h>
+#import <PubNub/PubNub.h>
+#import "PubNub+CorePrivate.h"
+#import "PNLoopbackTransport.h"
+#import "PNRequestParameters.h"
+#import "PNCircuitBreaker.h"
+#import "PNRequestHandle+Private.h"
+#import "PNNetwork.h"
+
+
+/**
+ @brief      Per-endpoint circuit breaker testing.
+ @discussion Verify that circuit opens after failure rate threshold has been reached, that requests to
+             degraded endpoint fail fast and that probe request close circuit.
+
+ @author Sergey Mamontov
+ @copyright © 2009-2017 PubNub, Inc.
+ */
+@interface PNCircuitBreakerTests : XCTestCase
+
+
+#pragma mark - Properties
+
+/**
+ @brief  Stores reference on transport which is used by client's non-subscribe network manager.
+ */
+@property (nonatomic, strong) PNLoopbackTransport *transport;
+
+
+#pragma mark - Misc
+
+/**
+ @brief  Create client which send non-subscribe requests through loopback transport.
+
+ @param configuration Reference on client configuration.
+
+ @return Configured and ready to use client.
+ */
+- (PubNub *)clientWithConfiguration:(PNConfiguration *)configuration;
+
+#pragma mark -
+
+
+@end
+
+
+#pragma mark - Test case implementation
+
+@implementation PNCircuitBreakerTests
+
+- (void)setUp {
+
+    // Forward method call to the super class.
+    [super setUp];
+
+
+    // Prepare 'fixtures'
+    self.transport = [PNLoopbackTransport transport];
+}
+
+- (void)testCircuitOpenAndClose {
+
+    PNCircuitBreaker *breaker = [PNCircuitBreaker breakerWithFailureRateThreshold:50 minimumRequests:4
+                                                                     openInterval:0.1f];
+
+    [breaker recordResponseForEndpoint:@"pub" failed:NO];
+    [breaker recordResponseForEndpoint:@"pub" failed:YES];
+    [breaker recordResponseForEndpoint:@"pub" failed:YES];
+    XCTAssertTrue([breaker allowRequestForEndpoint:@"pub"], @"Circuit shouldn't open before minimum requests.");
+    [breaker recordResponseForEndpoint:@"pub" failed:NO];
+    XCTAssertFalse([breaker allowRequestForEndpoint:@"pub"], @"Circuit should open at failure threshold.");
+    XCTAssertTrue([breaker allowRequestForEndpoint:@"hist"], @"Other endpoints shouldn't be affected.");
+
+    [NSThread sleepForTimeInterval:0.2f];
+    XCTAssertTrue([breaker allowRequestForEndpoint:@"pub"], @"Probe request should be allowed.");
+    XCTAssertFalse([breaker allowRequestForEndpoint:@"pub"], @"Only one probe request should be allowed.");
+    [breaker recordResponseForEndpoint:@"pub" failed:NO];
+    XCTAssertTrue([breaker allowRequestForEndpoint:@"pub"], @"Successful probe should close circuit.");
+}
+
+- (void)testDegradedEndpointFailFast {
+
+    PNConfiguration *configuration = [PNConfiguration configurationWithPublishKey:@"demo"
+                                                                     subscribeKey:@"demo"];
+    configuration.circuitBreakerFailureRateThreshold = 50;
+    configuration.circuitBreakerMinimumRequests = 2;
+    configuration.circuitBreakerOpenInterval = 60.f;
+    PubNub *client = [self clientWithConfiguration:configuration];
+    self.transport.responder = ^(NSURLRequest *request, PNLoopbackTransportRespondBlock respond) {
+        respond(503, [@"{}" dataUsingEncoding:NSUTF8StringEncoding], nil);
+    };
+
+    for (NSUInteger requestIdx = 0; requestIdx < 2; requestIdx++) {
+        XCTestExpectation *expectation = [self expectationWithDescription:@"Failed request"];
+        [client processOperation:PNTimeOperation withParameters:[PNRequestParameters new]
+                 completionBlock:^(PNTimeResult *result, PNErrorStatus *status) {
+
+            XCTAssertNotEqual(status.category, PNServiceDegradedCategory);
+            [expectation fulfill];
+        }];
+        [self waitForExpectationsWithTimeout:10 handler:nil];
+    }
+
+    XCTestExpectation *expectation = [self expectationWithDescription:@"Rejected request"];
+    [client processOperation:PNTimeOperation withParameters:[PNRequestParameters new]
+             completionBlock:^(PNTimeResult *result, PNErrorStatus *status) {
+
+        XCTAssertEqual(status.category, PNServiceDegradedCategory, @"Request should fail fast.");
+        [expectation fulfill];
+    }];
+    [self waitForExpectationsWithTimeout:10 handler:nil];
+
+    PNRequestParameters *parameters = [PNRequestParameters new];
+    parameters.handle = [PNRequestHandle handleWithTimeout:0];
+    XCTestExpectation *handleExpectation = [self expectationWithDescription:@"Rejected request with handle"];
+    PNRequestHandle *handle = [client processOperation:PNTimeOperation withParameters:parameters
+                                       completionBlock:^(PNTimeResult *result, PNErrorStatus *status) {
+
+        XCTAssertEqual(status.category, PNServiceDegradedCategory, @"Request should fail fast.");
+        [handleExpectation fulfill];
+    }];
+    XCTAssertTrue(handle == parameters.handle, @"Passed handle should be returned.");
+
+    [self waitForExpectationsWithTimeout:10 handler:nil];
+    XCTAssertEqual(self.transport.requestsCount, 2, @"Request to degraded endpoint shouldn't be sent.");
+    XCTAssertEqualObjects([client metrics][@"circuit.rejected"], @2);
+    XCTAssertEqualObjects([client metrics][@"circuit.time.state"], @1);
+}
+
+- (void)testDeadlineTimeoutsNotCountedAsFailures {
+
+    PNConfiguration *configuration = [PNConfiguration configurationWithPublishKey:@"demo"
+                                                                     subscribeKey:@"demo"];
+    configuration.circuitBreakerFailureRateThreshold = 50;
+    configuration.circuitBreakerMinimumRequests = 2;
+    configuration.circuitBreakerOpenInterval = 60.f;
+    PubNub *client = [self clientWithConfiguration:configuration];
+    __block NSUInteger requestIdx = 0;
+    self.transport.responder = ^(NSURLRequest *request, PNLoopbackTransportRespondBlock respond) {
+
+        // Respond after API call deadline: with timeout error and with late response.
+        NSUInteger currentRequestIdx = requestIdx++;
+        dispatch_after(dispatch_time(DISPATCH_TIME_NOW, (int64_t)(0.2f * NSEC_PER_SEC)),
+                       dispatch_get_global_queue(DISPATCH_QUEUE_PRIORITY_DEFAULT, 0), ^{
+
+            if (currentRequestIdx == 0) {
+                respond(0, nil, [NSError errorWithDomain:NSURLErrorDomain code:NSURLErrorTimedOut userInfo:nil]);
+            }
+            else { respond(200, [@"[15000000000000000]" dataUsingEncoding:NSUTF8StringEncoding], nil); }
+        });
+    };
+
+    for (NSUInteger callIdx = 0; callIdx < 2; callIdx++) {
+        PNRequestParameters *parameters = [PNRequestParameters new];
+        parameters.handle = [PNRequestHandle handleWithTimeout:0.05f];
+        XCTestExpectation *expectation = [self expectationWithDescription:@"Expired call"];
+        [client processOperation:PNTimeOperation withParameters:parameters
+                 completionBlock:^(PNTimeResult *result, PNErrorStatus *status) {
+
+            XCTAssertEqual(status.category, PNTimeoutCategory);
+            [expectation fulfill];
+        }];
+        [self waitForExpectationsWithTimeout:10 handler:nil];
+    }
+
+    self.transport.responder = ^(NSURLRequest *request, PNLoopbackTransportRespondBlock respond) {
+        respond(200, [@"[15000000000000000]" dataUsingEncoding:NSUTF8StringEncoding], nil);
+    };
+    XCTestExpectation *expectation = [self expectationWithDescription:@"Allowed request"];
+    [client processOperation:PNTimeOperation withParameters:[PNRequestParameters new]
+             completionBlock:^(PNTimeResult *result, PNErrorStatus *status) {
+
+        XCTAssertNil(status, @"API call deadline shouldn't affect endpoint health.");
+        [expectation fulfill];
+    }];
+
+    [self waitForExpectationsWithTimeout:10 handler:nil];
+    XCTAssertEqual(self.transport.requestsCount, 3, @"Request to endpoint should be sent.");
+    XCTAssertEqualObjects([client metrics][@"circuit.time.state"], @0);
+}
+
+
+#pragma mark - Misc
+
+- (PubNub *)clientWithConfiguration:(PNConfiguration *)configuration {
+
+    PubNub *client = [PubNub clientWithConfiguration:configuration];
+    PNNetwork *network = [PNNetwork networkForClient:client requestTimeout:10 maximumConnections:3
+                                            longPoll:NO transport:self.transport];
+    [client setValue:network forKey:@"serviceNetwork"];
+
+    return client;
+}
+
+#pragma mark -
+
+
+@end
@@ -0,0 +1,353 @@
+#import "PNLoopbackClientTestCase.h"
+#import "PubNub+CorePrivate.h"
+#import "PNResult+Private.h"
+#import "PNStateListener.h"
+
+
+#pragma mark Private interface declaration
+
+/**
+ @brief  Listener which receive messages in batches.
+ */
+@interface PNEventsQueueTestsBatchListener : NSObject <PNObjectEventListener>
+
+
+#pragma mark - Properties
+
+/**
+ @brief  Stores list of messages batches in order in which they has been delivered.
+ */
+@property (atomic, strong) NSMutableArray<NSArray<PNMessageResult *> *> *batches;
+
+#pragma mark -
+
+
+@end
+
+
+/**
+ @brief      Listener's pending events queue testing.
+ @discussion Verify behaviour of each events queue overflow policy, reported queue gauges and resume of
+             subscription loop when queue has free space.
+
+ @author Sergey Mamontov
+ @copyright © 2009-2017 PubNub, Inc.
+ */
+@interface PNEventsQueueTests : PNLoopbackClientTestCase
+
+
+#pragma mark - Properties
+
+/**
+ @brief  Stores reference on configuration which is used to create client for test.
+ */
+@property (nonatomic, strong) PNConfiguration *configuration;
+
+/**
+ @brief  Stores list of messages text in order in which they has been delivered to listener.
+ */
+@property (nonatomic, strong) NSMutableArray<NSString *> *receivedMessages;
+
+
+#pragma mark - Misc
+
+/**
+ @brief      Prevent events delivery.
+ @discussion Callback queue blocked till returned semaphore will be signalled.
+
+ @return Semaphore which should be signalled to unblock events delivery.
+ */
+- (dispatch_semaphore_t)blockEventsDelivery;
+
+/**
+ @brief  Notify listeners about messages and wait till they will be placed into pending events queue.
+
+ @param messages List of message text and channel pairs (channel separated by ':').
+ */
+- (void)notifyMessages:(NSArray<NSString *> *)messages;
+
+/**
+ @brief  Notify batch listeners about messages from single response and wait till they will be placed into
+         pending events queue.
+
+ @param messages List of message text and channel pairs (channel separated by ':').
+ */
+- (void)notifyMessagesBatch:(NSArray<NSString *> *)messages;
+
+/**
+ @brief  Create message event object.
+
+ @param message Message text and channel pair (channel separated by ':').
+
+ @return Configured and ready to use message event object.
+ */
+- (PNMessageResult *)messageFrom:(NSString *)message;
+
+#pragma mark -
+
+
+@end
+
+
+#pragma mark - Test case implementation
+
+@implementation PNEventsQueueTests
+
+- (void)setUp {
+
+    // Forward method call to the super class.
+    [super setUp];
+
+
+    // Prepare 'fixtures'
+    self.configuration = [PNConfiguration configurationWithPublishKey:@"demo" subscribeKey:@"demo"];
+    self.configuration.maximumPendingEvents = 3;
+    self.receivedMessages = [NSMutableArray new];
+}
+
+- (void)testQueueUnboundedByDefault {
+
+    self.configuration = [PNConfiguration configurationWithPublishKey:@"demo" subscribeKey:@"demo"];
+    [self createClientWithConfiguration:self.configuration];
+    dispatch_semaphore_t semaphore = [self blockEventsDelivery];
+    [self notifyMessages:@[@"1:a", @"2:a", @"3:a", @"4:a", @"5:a"]];
+
+    XCTAssertEqual(self.configuration.maximumPendingEvents, 0, @"Queue limit should be disabled by default.");
+    XCTAssertEqualObjects(self.client.metrics[@"events.queue.depth"], @5);
+    XCTAssertEqualObjects(self.client.metrics[@"events.dropped"], @0);
+
+    __block BOOL capacityAvailable = NO;
+    [self.client.listenersManager notifyWhenEventsCapacityAvailable:^{ capacityAvailable = YES; }];
+    XCTAssertTrue(capacityAvailable, @"Unbounded queue always should have capacity.");
+    dispatch_semaphore_signal(semaphore);
+}
+
+- (void)testBlockPolicyKeepsAllEvents {
+
+    self.configuration.eventsOverflowPolicy = PNEventsOverflowBlockPolicy;
+    [self createClientWithConfiguration:self.configuration];
+    dispatch_semaphore_t semaphore = [self blockEventsDelivery];
+    [self notifyMessages:@[@"1:a", @"2:a", @"3:a", @"4:a", @"5:a"]];
+
+    XCTAssertEqualObjects(self.client.metrics[@"events.queue.depth"], @5);
+    XCTAssertEqualObjects(self.client.metrics[@"events.dropped"], @0);
+
+    dispatch_semaphore_signal(semaphore);
+    XCTAssertTrue([self waitFor:5 condition:^BOOL{
+        @synchronized (self.receivedMessages) { return self.receivedMessages.count == 5; }
+    }]);
+    XCTAssertEqualObjects(self.receivedMessages, (@[@"1", @"2", @"3", @"4", @"5"]));
+}
+
+- (void)testDropOldestPolicyDropsOldestEvents {
+
+    self.configuration.eventsOverflowPolicy = PNEventsOverflowDropOldestPolicy;
+    [self createClientWithConfiguration:self.configuration];
+    dispatch_semaphore_t semaphore = [self blockEventsDelivery];
+    [self notifyMessages:@[@"1:a", @"2:a", @"3:a", @"4:a", @"5:a"]];
+
+    XCTAssertEqualObjects(self.client.metrics[@"events.queue.depth"], @3);
+    XCTAssertEqualObjects(self.client.metrics[@"events.dropped"], @2);
+
+    dispatch_semaphore_signal(semaphore);
+    XCTAssertTrue([self waitFor:5 condition:^BOOL{
+        @synchronized (self.receivedMessages) { return self.receivedMessages.count == 3; }
+    }]);
+    XCTAssertEqualObjects(self.receivedMessages, (@[@"3", @"4", @"5"]));
+}
+
+- (void)testDropOldestPolicyCountsEachMessageFromDroppedBatch {
+
+    self.configuration.eventsOverflowPolicy = PNEventsOverflowDropOldestPolicy;
+    [self createClientWithConfiguration:self.configuration];
+    PNEventsQueueTestsBatchListener *batchListener = [PNEventsQueueTestsBatchListener new];
+    [self.client addListener:batchListener];
+    dispatch_semaphore_t semaphore = [self blockEventsDelivery];
+    [self notifyMessagesBatch:@[@"1:a", @"2:a", @"3:a"]];
+    [self notifyMessages:@[@"4:a", @"5:a", @"6:a"]];
+
+    XCTAssertEqualObjects(self.client.metrics[@"events.queue.depth"], @3);
+    XCTAssertEqualObjects(self.client.metrics[@"events.dropped"], @3,
+                          @"Each message from dropped batch should be counted.");
+
+    dispatch_semaphore_signal(semaphore);
+    XCTAssertTrue([self waitFor:5 condition:^BOOL{
+        @synchronized (self.receivedMessages) { return self.receivedMessages.count == 3; }
+    }]);
+    XCTAssertEqual(batchListener.batches.count, 0, @"Dropped batch shouldn't be delivered.");
+    [self.client removeListener:batchListener];
+}
+
+- (void)testBatchMessagesCountedAgainstLimitBeforeAggregation {
+
+    self.configuration.eventsOverflowPolicy = PNEventsOverflowDropOldestPolicy;
+    self.configuration.messagesAggregationWindow = 0.2f;
+    [self createClientWithConfiguration:self.configuration];
+    PNEventsQueueTestsBatchListener *batchListener = [PNEventsQueueTestsBatchListener new];
+    [self.client addListener:batchListener];
+    dispatch_semaphore_t semaphore = [self blockEventsDelivery];
+    [self notifyMessagesBatch:@[@"1:a", @"2:a"]];
+    [self notifyMessagesBatch:@[@"3:a", @"4:a"]];
+
+    XCTAssertEqualObjects(self.client.metrics[@"events.queue.depth"], @3,
+                          @"Each message from batch should be counted against queue limit.");
+    XCTAssertEqualObjects(self.client.metrics[@"events.dropped"], @1,
+                          @"Only oldest message should be dropped from aggregated batch.");
+
+    dispatch_semaphore_signal(semaphore);
+    XCTAssertTrue([self waitFor:5 condition:^BOOL{
+        @synchronized (batchListener) { return batchListener.batches.count == 1; }
+    }]);
+    NSMutableArray<NSString *> *messages = [NSMutableArray new];
+    for (PNMessageResult *message in batchListener.batches.firstObject) {
+        [messages addObject:message.data.message];
+    }
+    XCTAssertEqualObjects(messages, (@[@"2", @"3", @"4"]));
+    [self.client removeListener:batchListener];
+}
+
+- (void)testCoalescePolicyReplacesEventFromSameChannel {
+
+    self.configuration.eventsOverflowPolicy = PNEventsOverflowCoalescePolicy;
+    [self createClientWithConfiguration:self.configuration];
+    dispatch_semaphore_t semaphore = [self blockEventsDelivery];
+    [self notifyMessages:@[@"1:a", @"2:b", @"3:c", @"4:a"]];
+
+    XCTAssertEqualObjects(self.client.metrics[@"events.queue.depth"], @3);
+    XCTAssertEqualObjects(self.client.metrics[@"events.coalesced"], @1);
+    XCTAssertEqualObjects(self.client.metrics[@"events.dropped"], @0);
+
+    [self notifyMessages:@[@"5:d"]];
+    XCTAssertEqualObjects(self.client.metrics[@"events.dropped"], @1,
+                          @"Oldest event should be dropped if there is no event from same channel.");
+
+    dispatch_semaphore_signal(semaphore);
+    XCTAssertTrue([self waitFor:5 condition:^BOOL{
+        @synchronized (self.receivedMessages) { return self.receivedMessages.count == 3; }
+    }]);
+    XCTAssertEqualObjects(self.receivedMessages, (@[@"2", @"3", @"5"]));
+}
+
+- (void)testQueueDepthGauges {
+
+    [self createClientWithConfiguration:self.configuration];
+    dispatch_semaphore_t semaphore = [self blockEventsDelivery];
+    [self notifyMessages:@[@"1:a", @"2:a"]];
+
+    XCTAssertEqualObjects(self.client.metrics[@"events.queue.depth"], @2);
+    XCTAssertEqualObjects(self.client.metrics[@"events.queue.maxDepth"], @2);
+
+    dispatch_semaphore_signal(semaphore);
+    XCTAssertTrue([self waitFor:5 condition:^BOOL{
+        @synchronized (self.receivedMessages) { return self.receivedMessages.count == 2; }
+    }]);
+    XCTAssertEqualObjects(self.client.metrics[@"events.queue.depth"], @0);
+    XCTAssertEqualObjects(self.client.metrics[@"events.queue.maxDepth"], @2,
+                          @"Maximum queue depth should be kept after delivery.");
+}
+
+- (void)testCapacityObserverCalledWhenEventsDelivered {
+
+    self.configuration.eventsOverflowPolicy = PNEventsOverflowBlockPolicy;
+    [self createClientWithConfiguration:self.configuration];
+    dispatch_semaphore_t semaphore = [self blockEventsDelivery];
+    [self notifyMessages:@[@"1:a", @"2:a"]];
+
+    __block BOOL capacityAvailable = NO;
+    [self.client.listenersManager notifyWhenEventsCapacityAvailable:^{ capacityAvailable = YES; }];
+    XCTAssertTrue(capacityAvailable, @"Block should be called right away while queue has free space.");
+
+    [self notifyMessages:@[@"3:a"]];
+    __block BOOL resumed = NO;
+    [self.client.listenersManager notifyWhenEventsCapacityAvailable:^{
+        @synchronized (self) { resumed = YES; }
+    }];
+    XCTAssertFalse(resumed, @"Block shouldn't be called while queue is full.");
+
+    dispatch_semaphore_signal(semaphore);
+    XCTAssertTrue([self waitFor:5 condition:^BOOL{
+        @synchronized (self) { return resumed; }
+    }], @"Block should be called after pending events delivery.");
+}
+
+
+#pragma mark - Listener
+
+- (void)client:(PubNub *)client didReceiveMessage:(PNMessageResult *)message {
+
+    @synchronized (self.receivedMessages) { [self.receivedMessages addObject:message.data.message]; }
+}
+
+
+#pragma mark - Misc
+
+- (dispatch_semaphore_t)blockEventsDelivery {
+
+    dispatch_semaphore_t semaphore = dispatch_semaphore_create(0);
+    dispatch_async(self.callbackQueue, ^{ dispatch_semaphore_wait(semaphore, DISPATCH_TIME_FOREVER); });
+
+    return semaphore;
+}
+
+- (void)notifyMessages:(NSArray<NSString *> *)messages {
+
+    dispatch_semaphore_t semaphore = dispatch_semaphore_create(0);
+    [self.client.listenersManager notifyWithBlock:^{
+
+        for (NSString *message in messages) {
+            [self.client.listenersManager notifyMessage:[self messageFrom:message]];
+        }
+        dispatch_semaphore_signal(semaphore);
+    }];
+    dispatch_semaphore_wait(semaphore, DISPATCH_TIME_FOREVER);
+}
+
+- (void)notifyMessagesBatch:(NSArray<NSString *> *)messages {
+
+    NSMutableArray<PNMessageResult *> *batch = [NSMutableArray new];
+    for (NSString *message in messages) { [batch addObject:[self messageFrom:message]]; }
+    dispatch_semaphore_t semaphore = dispatch_semaphore_create(0);
+    [self.client.listenersManager notifyWithBlock:^{
+
+        [self.client.listenersManager notifyMessages:batch];
+        dispatch_semaphore_signal(semaphore);
+    }];
+    dispatch_semaphore_wait(semaphore, DISPATCH_TIME_FOREVER);
+}
+
+- (PNMessageResult *)messageFrom:(NSString *)message {
+
+    NSArray<NSString *> *components = [message componentsSeparatedByString:@":"];
+
+    return [PNMessageResult objectForOperation:PNSubscribeOperation completedWithTask:nil
+                                 processedData:@{@"message": components.firstObject,
+                                                 @"channel": components.lastObject}
+                               processingError:nil];
+}
+
+#pragma mark -
+
+
+@end
+
+
+#pragma mark - Batch listener implementation
+
+@implementation PNEventsQueueTestsBatchListener
+
+- (instancetype)init {
+
+    if ((self = [super init])) { _batches = [NSMutableArray new]; }
+
+    return self;
+}
+
+- (void)client:(PubNub *)client didReceiveMessages:(NSArray<PNMessageResult *> *)messages {
+
+    @synchronized (self) { [self.batches addObject:messages]; }
+}
+
+#pragma mark -
+
+
+@end
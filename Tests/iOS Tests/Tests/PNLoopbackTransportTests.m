@@ -0,0 +1,613 @@
+#import <XCTest/XCTest.h>
+#import <PubNub/PubNub.h>
+#import "PubNub+CorePrivate.h"
+#import "PNLoopbackTransport.h"
+#import "PNRequestParameters.h"
+#import "PNRequestHandle+Private.h"
+#import "PNGZIP.h"
+#import "PNNetwork.h"
+
+
+#pragma mark Static
+
+/**
+ @brief  Number of operations which is processed by single measurement.
+ */
+static NSUInteger const kPNLoopbackTransportTestsOperationsCount = 1000;
+
+
+/**
+ @brief      PNLoopbackTransport testing.
+ @discussion Verify canned and scripted responses delivery through network manager and measure throughput of
+             operation processing, response parsing and results dispatch without network I/O.
+
+ @author Sergey Mamontov
+ @copyright © 2009-2017 PubNub, Inc.
+ */
+@interface PNLoopbackTransportTests : XCTestCase
+
+
+#pragma mark - Properties
+
+/**
+ @brief  Stores reference on client for which network manager has been created.
+ */
+@property (nonatomic, strong) PubNub *client;
+
+/**
+ @brief  Stores reference on transport which is used by network manager.
+ */
+@property (nonatomic, strong) PNLoopbackTransport *transport;
+
+/**
+ @brief  Stores reference on network manager which is used by tests.
+ */
+@property (nonatomic, strong) PNNetwork *network;
+
+
+#pragma mark - Misc
+
+/**
+ @brief  Process time operation and wait for it's completion.
+
+ @return Reference on object which has been delivered to completion block.
+ */
+- (PNTimeResult *)processTimeOperationWithStatus:(PNErrorStatus * _Nullable __autoreleasing *)status;
+
+#pragma mark -
+
+
+@end
+
+
+#pragma mark - Test case implementation
+
+@implementation PNLoopbackTransportTests
+
+- (void)setUp {
+
+    // Forward method call to the super class.
+    [super setUp];
+
+
+    // Prepare 'fixtures'
+    PNConfiguration *configuration = [PNConfiguration configurationWithPublishKey:@"demo"
+                                                                     subscribeKey:@"demo"];
+    self.client = [PubNub clientWithConfiguration:configuration];
+    self.transport = [PNLoopbackTransport transport];
+    [self.transport setResponseData:[@"[15000000000000000]" dataUsingEncoding:NSUTF8StringEncoding]
+                         statusCode:200 forPathPrefix:@"/time/0"];
+    self.network = [PNNetwork networkForClient:self.client requestTimeout:10 maximumConnections:3
+                                      longPoll:NO transport:self.transport];
+}
+
+- (void)tearDown {
+
+    [self.network invalidate];
+
+    // Forward method call to the super class.
+    [super tearDown];
+}
+
+- (void)testCannedResponse {
+
+    PNErrorStatus *status = nil;
+    PNTimeResult *result = [self processTimeOperationWithStatus:&status];
+
+    XCTAssertNil(status, @"Canned response shouldn't be treated as error.");
+    XCTAssertEqualObjects(result.data.timetoken, @(15000000000000000), @"Unexpected time token.");
+    XCTAssertEqual(result.statusCode, 200, @"Unexpected status code.");
+    XCTAssertEqual(self.transport.requestsCount, 1, @"Unexpected number of processed requests.");
+}
+
+- (void)testScriptedResponse {
+
+    [self.transport removeAllResponses];
+    self.transport.responder = ^(NSURLRequest *request, PNLoopbackTransportRespondBlock respond) {
+
+        respond(403, [@"{\"status\":403,\"message\":\"Forbidden\",\"error\":true}"
+                      dataUsingEncoding:NSUTF8StringEncoding], nil);
+    };
+    PNErrorStatus *status = nil;
+    PNTimeResult *result = [self processTimeOperationWithStatus:&status];
+
+    XCTAssertNil(result, @"Error response shouldn't provide result.");
+    XCTAssertEqual(status.category, PNAccessDeniedCategory, @"Unexpected status category.");
+}
+
+- (void)testCancelScheduledOperation {
+
+    [self.transport removeAllResponses];
+    self.transport.responder = ^(NSURLRequest *request, PNLoopbackTransportRespondBlock respond) {};
+    XCTestExpectation *expectation = [self expectationWithDescription:@"Cancellation"];
+    [self.network processOperation:PNTimeOperation withParameters:[PNRequestParameters new] data:nil
+                   completionBlock:^(PNTimeResult *result, PNErrorStatus *status) {
+
+        XCTAssertEqual(status.category, PNCancelledCategory, @"Unexpected status category.");
+        [expectation fulfill];
+    }];
+    [self.network cancelAllOperationsWithURLPrefix:@"/time"];
+
+    [self waitForExpectationsWithTimeout:5 handler:nil];
+}
+
+- (void)testCancelOperationsOfType {
+
+    [self.transport removeAllResponses];
+    self.transport.responder = ^(NSURLRequest *request, PNLoopbackTransportRespondBlock respond) {};
+    PNRequestParameters *parameters = [PNRequestParameters new];
+    [parameters addPathComponent:@"a" forPlaceholder:@"{channel}"];
+    __block BOOL historyCompleted = NO;
+    [self.network processOperation:PNHistoryOperation withParameters:parameters data:nil
+                   completionBlock:^(PNHistoryResult *result, PNErrorStatus *status) {
+
+        historyCompleted = YES;
+    }];
+    XCTestExpectation *expectation = [self expectationWithDescription:@"Cancellation"];
+    [self.network processOperation:PNTimeOperation withParameters:[PNRequestParameters new] data:nil
+                   completionBlock:^(PNTimeResult *result, PNErrorStatus *status) {
+
+        XCTAssertEqual(status.category, PNCancelledCategory, @"Unexpected status category.");
+        [expectation fulfill];
+    }];
+    [self.network cancelAllOperationsOfType:PNTimeOperation];
+
+    [self waitForExpectationsWithTimeout:5 handler:nil];
+    XCTAssertFalse(historyCompleted, @"Operations of other types shouldn't be cancelled.");
+}
+
+- (void)testCancelThroughHandle {
+
+    [self.transport removeAllResponses];
+    self.transport.responder = ^(NSURLRequest *request, PNLoopbackTransportRespondBlock respond) {};
+    XCTestExpectation *expectation = [self expectationWithDescription:@"Cancellation"];
+    PNRequestHandle *handle = [self.network processOperation:PNTimeOperation
+                                              withParameters:[PNRequestParameters new] data:nil
+                                             completionBlock:^(PNTimeResult *result, PNErrorStatus *status) {
+
+        XCTAssertEqual(status.category, PNCancelledCategory, @"Unexpected status category.");
+        [expectation fulfill];
+    }];
+    [handle cancel];
+
+    [self waitForExpectationsWithTimeout:5 handler:nil];
+    XCTAssertTrue(handle.isCancelled, @"Handle should report cancellation.");
+    XCTAssertEqual(handle.operation, PNTimeOperation, @"Unexpected operation type.");
+}
+
+- (void)testCancelledCallNotSent {
+
+    PNRequestParameters *parameters = [PNRequestParameters new];
+    parameters.handle = [PNRequestHandle handleWithTimeout:0];
+    [parameters.handle cancel];
+    XCTestExpectation *expectation = [self expectationWithDescription:@"Cancellation"];
+    PNRequestHandle *handle = [self.network processOperation:PNTimeOperation withParameters:parameters data:nil
+                                             completionBlock:^(PNTimeResult *result, PNErrorStatus *status) {
+
+        XCTAssertEqual(status.category, PNCancelledCategory, @"Unexpected status category.");
+        [expectation fulfill];
+    }];
+
+    [self waitForExpectationsWithTimeout:5 handler:nil];
+    XCTAssertEqual(handle, parameters.handle, @"Passed handle should be returned.");
+    XCTAssertEqual(self.transport.requestsCount, 0, @"Cancelled call shouldn't be sent.");
+}
+
+- (void)testExpiredCallDropped {
+
+    PNRequestParameters *parameters = [PNRequestParameters new];
+    parameters.handle = [PNRequestHandle handleWithTimeout:0.01f];
+    [NSThread sleepForTimeInterval:0.05f];
+    XCTestExpectation *expectation = [self expectationWithDescription:@"Expiration"];
+    [self.network processOperation:PNTimeOperation withParameters:parameters data:nil
+                   completionBlock:^(PNTimeResult *result, PNErrorStatus *status) {
+
+        XCTAssertNil(result);
+        XCTAssertEqual(status.category, PNTimeoutCategory, @"Unexpected status category.");
+        [expectation fulfill];
+    }];
+
+    [self waitForExpectationsWithTimeout:5 handler:nil];
+    XCTAssertTrue(parameters.handle.isExpired);
+    XCTAssertEqual(self.transport.requestsCount, 0, @"Expired call shouldn't be sent.");
+    XCTAssertEqualObjects([self.client metrics][@"requests.abandoned"], @1);
+}
+
+- (void)testDeadlineLimitsRequestTimeout {
+
+    [self.transport removeAllResponses];
+    __block NSTimeInterval timeout = 0.f;
+    self.transport.responder = ^(NSURLRequest *request, PNLoopbackTransportRespondBlock respond) {
+
+        timeout = request.timeoutInterval;
+        respond(200, [@"[15000000000000000]" dataUsingEncoding:NSUTF8StringEncoding], nil);
+    };
+    PNRequestParameters *parameters = [PNRequestParameters new];
+    parameters.handle = [PNRequestHandle handleWithTimeout:2.f];
+    XCTestExpectation *expectation = [self expectationWithDescription:@"Time"];
+    [self.network processOperation:PNTimeOperation withParameters:parameters data:nil
+                   completionBlock:^(PNTimeResult *result, PNErrorStatus *status) {
+
+        XCTAssertNotNil(result);
+        [expectation fulfill];
+    }];
+
+    [self waitForExpectationsWithTimeout:5 handler:nil];
+    XCTAssertTrue(timeout > 0.f && timeout <= 2.f, @"Request shouldn't outlive API call deadline.");
+}
+
+- (void)testIdenticalRequestsCoalesced {
+
+    [self.transport removeAllResponses];
+    __block PNLoopbackTransportRespondBlock heldRespond = nil;
+    self.transport.responder = ^(NSURLRequest *request, PNLoopbackTransportRespondBlock respond) {
+
+        heldRespond = respond;
+    };
+    NSMutableArray<PNTimeResult *> *results = [NSMutableArray new];
+    dispatch_group_t group = dispatch_group_create();
+    for (NSUInteger callIdx = 0; callIdx < 3; callIdx++) {
+
+        dispatch_group_enter(group);
+        [self.network processOperation:PNTimeOperation withParameters:[PNRequestParameters new] data:nil
+                       completionBlock:^(PNTimeResult *result, PNErrorStatus *status) {
+
+            @synchronized (results) { [results addObject:result]; }
+            dispatch_group_leave(group);
+        }];
+    }
+    while (!heldRespond) { [[NSRunLoop currentRunLoop] runUntilDate:[NSDate dateWithTimeIntervalSinceNow:0.01]]; }
+    heldRespond(200, [@"[15000000000000000]" dataUsingEncoding:NSUTF8StringEncoding], nil);
+
+    XCTAssertEqual(dispatch_group_wait(group, dispatch_time(DISPATCH_TIME_NOW, (int64_t)(5 * NSEC_PER_SEC))), 0);
+    XCTAssertEqual(self.transport.requestsCount, 1, @"Identical requests should be sent once.");
+    XCTAssertEqual(results.count, 3, @"All callers should receive result.");
+    XCTAssertTrue(results[0] == results[1] && results[1] == results[2], @"Callers should share same result.");
+    XCTAssertEqualObjects([self.client metrics][@"requests.coalesced"], @2);
+}
+
+- (void)testIdenticalRequestsWithHandlesCoalesced {
+
+    [self.transport removeAllResponses];
+    __block PNLoopbackTransportRespondBlock heldRespond = nil;
+    self.transport.responder = ^(NSURLRequest *request, PNLoopbackTransportRespondBlock respond) {
+
+        heldRespond = respond;
+    };
+    NSMutableArray<PNRequestHandle *> *handles = [NSMutableArray new];
+    NSMutableArray<PNErrorStatus *> *statuses = [NSMutableArray arrayWithObjects:[NSNull null], [NSNull null], nil];
+    dispatch_group_t group = dispatch_group_create();
+    for (NSUInteger callIdx = 0; callIdx < 2; callIdx++) {
+
+        PNRequestParameters *parameters = [PNRequestParameters new];
+        parameters.handle = [PNRequestHandle handleWithTimeout:0];
+        dispatch_group_enter(group);
+        PNRequestHandle *handle = [self.network processOperation:PNTimeOperation withParameters:parameters
+                                                            data:nil
+                                                 completionBlock:^(PNTimeResult *result, PNErrorStatus *status) {
+
+            @synchronized (statuses) { if (status) { statuses[callIdx] = status; } }
+            dispatch_group_leave(group);
+        }];
+        XCTAssertTrue(handle == parameters.handle, @"Passed handle should be returned.");
+        [handles addObject:handle];
+    }
+    [handles.lastObject cancel];
+    while (!heldRespond) { [[NSRunLoop currentRunLoop] runUntilDate:[NSDate dateWithTimeIntervalSinceNow:0.01]]; }
+    heldRespond(200, [@"[15000000000000000]" dataUsingEncoding:NSUTF8StringEncoding], nil);
+
+    XCTAssertEqual(dispatch_group_wait(group, dispatch_time(DISPATCH_TIME_NOW, (int64_t)(5 * NSEC_PER_SEC))), 0);
+    XCTAssertEqual(self.transport.requestsCount, 1, @"Identical requests with handles should be sent once.");
+    XCTAssertEqualObjects(statuses[0], [NSNull null], @"Not cancelled call should receive result.");
+    XCTAssertEqual(((PNErrorStatus *)statuses[1]).category, PNCancelledCategory,
+                   @"Cancelled call should receive cancellation status.");
+    XCTAssertEqualObjects([self.client metrics][@"requests.coalesced"], @1);
+}
+
+- (void)testWarmUpOpenConfiguredConnections {
+
+    PNLoopbackTransport *transport = [PNLoopbackTransport transport];
+    PNNetwork *network = [PNNetwork networkForClient:self.client requestTimeout:310 maximumConnections:8
+                                            longPoll:YES transport:transport];
+    [self.network warmUpConnections];
+    [network warmUpConnections];
+
+    XCTAssertEqual(self.transport.requestsCount, 3, @"Connection should be opened for each request slot.");
+    XCTAssertEqual(transport.requestsCount, 1, @"Single connection should be opened for long-poll requests.");
+    [network invalidate];
+}
+
+- (void)testSlowReadRequestHedged {
+
+    PNConfiguration *configuration = [PNConfiguration configurationWithPublishKey:@"demo"
+                                                                     subscribeKey:@"demo"];
+    configuration.hedgeReadRequests = YES;
+    configuration.hedgeBudgetPercentage = 100;
+    PubNub *client = [PubNub clientWithConfiguration:configuration];
+    for (NSUInteger latencyIdx = 0; latencyIdx < 20; latencyIdx++) {
+        [client.telemetryManager setLatency:0.05f forOperation:PNTimeOperation];
+    }
+    PNLoopbackTransport *transport = [PNLoopbackTransport transport];
+    __block NSUInteger requestsCount = 0;
+    transport.responder = ^(NSURLRequest *request, PNLoopbackTransportRespondBlock respond) {
+
+        // First request never answer, so only duplicate can complete API call.
+        if (++requestsCount > 1) {
+            respond(200, [@"[15000000000000000]" dataUsingEncoding:NSUTF8StringEncoding], nil);
+        }
+    };
+    PNNetwork *network = [PNNetwork networkForClient:client requestTimeout:10 maximumConnections:3
+                                            longPoll:NO transport:transport];
+    __block NSUInteger completionsCount = 0;
+    XCTestExpectation *expectation = [self expectationWithDescription:@"Hedge"];
+    [network processOperation:PNTimeOperation withParameters:[PNRequestParameters new] data:nil
+              completionBlock:^(PNTimeResult *result, PNErrorStatus *status) {
+
+        completionsCount++;
+        XCTAssertNil(status, @"Hedged request should succeed.");
+        [expectation fulfill];
+    }];
+
+    [self waitForExpectationsWithTimeout:5 handler:nil];
+    [[NSRunLoop currentRunLoop] runUntilDate:[NSDate dateWithTimeIntervalSinceNow:0.2]];
+    XCTAssertEqual(transport.requestsCount, 2, @"Duplicate request should be sent.");
+    XCTAssertEqual(completionsCount, 1, @"Cancelled request shouldn't complete API call.");
+    XCTAssertEqualObjects([client metrics][@"hedge.requests"], @1);
+    XCTAssertEqualObjects([client metrics][@"hedge.wins"], @1);
+    [network invalidate];
+}
+
+- (void)testCancelledHedgedReadCompletedRightAway {
+
+    PNConfiguration *configuration = [PNConfiguration configurationWithPublishKey:@"demo"
+                                                                     subscribeKey:@"demo"];
+    configuration.hedgeReadRequests = YES;
+    configuration.hedgeBudgetPercentage = 100;
+    PubNub *client = [PubNub clientWithConfiguration:configuration];
+    NSArray<NSNumber *> *operations = @[@(PNTimeOperation), @(PNHistoryOperation)];
+    for (NSNumber *operation in operations) {
+        for (NSUInteger latencyIdx = 0; latencyIdx < 20; latencyIdx++) {
+            [client.telemetryManager setLatency:0.05f forOperation:operation.integerValue];
+        }
+    }
+    PNLoopbackTransport *transport = [PNLoopbackTransport transport];
+    transport.responder = ^(NSURLRequest *request, PNLoopbackTransportRespondBlock respond) {
+        // Neither original request nor duplicate answer.
+    };
+    PNNetwork *network = [PNNetwork networkForClient:client requestTimeout:10 maximumConnections:3
+                                            longPoll:NO transport:transport];
+
+    // Shared (time) and not shared (history) hedged read requests.
+    for (NSNumber *operation in operations) {
+
+        PNRequestParameters *parameters = [PNRequestParameters new];
+        parameters.handle = [PNRequestHandle handleWithTimeout:0];
+        [parameters addPathComponent:@"a" forPlaceholder:@"{channel}"];
+        __block PNErrorStatus *cancelledStatus = nil;
+        XCTestExpectation *expectation = [self expectationWithDescription:@"Cancelled hedged read"];
+        NSUInteger requestsCount = transport.requestsCount;
+        [network processOperation:operation.integerValue withParameters:parameters data:nil
+                  completionBlock:^(PNResult *result, PNErrorStatus *status) {
+
+            cancelledStatus = status;
+            [expectation fulfill];
+        }];
+        while (transport.requestsCount < requestsCount + 2) {
+            [[NSRunLoop currentRunLoop] runUntilDate:[NSDate dateWithTimeIntervalSinceNow:0.01]];
+        }
+        [parameters.handle cancel];
+
+        [self waitForExpectationsWithTimeout:1 handler:nil];
+        XCTAssertEqual(cancelledStatus.category, PNCancelledCategory, @"Cancelled call should complete right away.");
+        XCTestExpectation *tasksExpectation = [self expectationWithDescription:@"Tasks"];
+        [transport getTasksWithCompletion:^(NSArray<id <PNTransportTask>> *tasks) {
+
+            XCTAssertEqual(tasks.count, 0, @"Original request and duplicate should be cancelled.");
+            [tasksExpectation fulfill];
+        }];
+        [self waitForExpectationsWithTimeout:1 handler:nil];
+    }
+    XCTAssertEqualObjects([client metrics][@"hedge.requests"], @2);
+    XCTAssertEqualObjects([client metrics][@"requests.abandoned"], @2);
+    [network invalidate];
+}
+
+- (void)testAdaptiveRequestTimeout {
+
+    PNConfiguration *configuration = [PNConfiguration configurationWithPublishKey:@"demo"
+                                                                     subscribeKey:@"demo"];
+    configuration.adaptRequestTimeout = YES;
+    PubNub *client = [PubNub clientWithConfiguration:configuration];
+    PNLoopbackTransport *transport = [PNLoopbackTransport transport];
+    __block NSTimeInterval timeout = 0.f;
+    transport.responder = ^(NSURLRequest *request, PNLoopbackTransportRespondBlock respond) {
+
+        timeout = request.timeoutInterval;
+        respond(200, [@"[15000000000000000]" dataUsingEncoding:NSUTF8StringEncoding], nil);
+    };
+    PNNetwork *network = [PNNetwork networkForClient:client requestTimeout:10 maximumConnections:3
+                                            longPoll:NO transport:transport];
+    for (NSUInteger callIdx = 0; callIdx < 2; callIdx++) {
+
+        XCTestExpectation *expectation = [self expectationWithDescription:@"Time"];
+        [network processOperation:PNTimeOperation withParameters:[PNRequestParameters new] data:nil
+                  completionBlock:^(PNTimeResult *result, PNErrorStatus *status) {
+
+            [expectation fulfill];
+        }];
+        [self waitForExpectationsWithTimeout:5 handler:nil];
+
+        if (callIdx == 0) {
+
+            XCTAssertEqual(timeout, 10.f, @"Fixed timeout should be used without latency information.");
+            for (NSUInteger latencyIdx = 0; latencyIdx < 20; latencyIdx++) {
+                [client.telemetryManager setLatency:1.f forOperation:PNTimeOperation];
+            }
+        }
+    }
+
+    XCTAssertEqualWithAccuracy(timeout, 3.f, 0.001f, @"Timeout should be calculated from p99 latency.");
+    [network invalidate];
+}
+
+- (void)testCompressedResponseInflated {
+
+    PNConfiguration *configuration = [PNConfiguration configurationWithPublishKey:@"demo"
+                                                                     subscribeKey:@"demo"];
+    PubNub *client = [PubNub clientWithConfiguration:configuration];
+    PNLoopbackTransport *transport = [PNLoopbackTransport transport];
+    __block NSString *acceptEncoding = nil;
+    transport.responder = ^(NSURLRequest *request, PNLoopbackTransportRespondBlock respond) {
+
+        acceptEncoding = [request valueForHTTPHeaderField:@"Accept-Encoding"];
+        NSData *data = [@"[15000000000000000]" dataUsingEncoding:NSUTF8StringEncoding];
+        respond(200, [PNGZIP GZIPDeflatedData:data], nil);
+    };
+    PNNetwork *network = [PNNetwork networkForClient:client requestTimeout:10 maximumConnections:3
+                                            longPoll:NO transport:transport];
+    XCTestExpectation *expectation = [self expectationWithDescription:@"Time"];
+    [network processOperation:PNTimeOperation withParameters:[PNRequestParameters new] data:nil
+              completionBlock:^(PNTimeResult *result, PNErrorStatus *status) {
+
+        XCTAssertNil(status, @"Compressed response should be processed.");
+        XCTAssertEqualObjects(result.data.timetoken, @(15000000000000000), @"Unexpected time token.");
+        [expectation fulfill];
+    }];
+
+    [self waitForExpectationsWithTimeout:5 handler:nil];
+    XCTAssertEqualObjects(acceptEncoding, @"gzip", @"Compressed response should be requested.");
+    XCTAssertGreaterThan([client metrics][@"compression.time.inflatedBytes"].integerValue, 0);
+    XCTAssertNotNil([client metrics][@"compression.time.ratio"]);
+    [network invalidate];
+}
+
+- (void)testChunkedCompressedDataInflated {
+
+    NSMutableString *message = [NSMutableString new];
+    for (NSUInteger idx = 0; idx < 5000; idx++) { [message appendFormat:@"{\"idx\":%@},", @(idx)]; }
+    NSData *data = [message dataUsingEncoding:NSUTF8StringEncoding];
+    NSData *compressedData = [PNGZIP GZIPDeflatedData:data];
+    PNGZIP *inflater = [PNGZIP inflater];
+    NSMutableData *inflatedData = [NSMutableData new];
+    for (NSUInteger offset = 0; offset < compressedData.length; offset += 1) {
+        [inflatedData appendData:[inflater inflateData:[compressedData subdataWithRange:NSMakeRange(offset, 1)]]];
+    }
+    [inflatedData appendData:[inflater finish]];
+
+    XCTAssertTrue(inflater.isCompressed);
+    XCTAssertEqualObjects(inflatedData, data, @"Chunked stream should be inflated.");
+    XCTAssertEqual(inflater.compressedLength, compressedData.length);
+    XCTAssertNil([PNGZIP GZIPInflatedData:[compressedData subdataWithRange:NSMakeRange(0, 10)]],
+                 @"Truncated stream shouldn't be inflated.");
+}
+
+- (void)testDeadSubscribeConnectionDetected {
+
+    PNConfiguration *configuration = [PNConfiguration configurationWithPublishKey:@"demo"
+                                                                     subscribeKey:@"demo"];
+    configuration.subscribeWatchdogInterval = 0.5f;
+    PubNub *client = [PubNub clientWithConfiguration:configuration];
+    PNLoopbackTransport *transport = [PNLoopbackTransport transport];
+    transport.responder = ^(NSURLRequest *request, PNLoopbackTransportRespondBlock respond) {
+
+        // Subscribe request never receive response, while probe can't reach service.
+        if ([request.URL.path hasPrefix:@"/time"]) {
+            respond(0, nil, [NSError errorWithDomain:NSURLErrorDomain code:NSURLErrorTimedOut userInfo:nil]);
+        }
+    };
+    PNNetwork *network = [PNNetwork networkForClient:client requestTimeout:310 maximumConnections:2
+                                            longPoll:YES transport:transport];
+    PNRequestParameters *parameters = [PNRequestParameters new];
+    [parameters addPathComponent:@"a" forPlaceholder:@"{channels}"];
+    XCTestExpectation *expectation = [self expectationWithDescription:@"Subscribe"];
+    [network processOperation:PNSubscribeOperation withParameters:parameters data:nil
+              completionBlock:^(PNSubscribeStatus *status) {
+
+        XCTAssertEqual(status.category, PNNetworkIssuesCategory, @"Dead connection should be reported.");
+        [expectation fulfill];
+    }];
+
+    [self waitForExpectationsWithTimeout:5 handler:nil];
+    XCTAssertEqualObjects([client metrics][@"watchdog.deadConnections"], @1);
+    [network invalidate];
+}
+
+- (void)testStalledSubscribeConnectionRestartedWhenProbeSucceed {
+
+    PNConfiguration *configuration = [PNConfiguration configurationWithPublishKey:@"demo"
+                                                                     subscribeKey:@"demo"];
+    configuration.subscribeWatchdogInterval = 0.2f;
+    PubNub *client = [PubNub clientWithConfiguration:configuration];
+    PNLoopbackTransport *transport = [PNLoopbackTransport transport];
+    transport.responder = ^(NSURLRequest *request, PNLoopbackTransportRespondBlock respond) {
+
+        // Subscribe request connection silently dropped, while probe reach service over separate connection.
+        if ([request.URL.path hasPrefix:@"/time"]) {
+            respond(200, [@"[15000000000000000]" dataUsingEncoding:NSUTF8StringEncoding], nil);
+        }
+    };
+    PNNetwork *network = [PNNetwork networkForClient:client requestTimeout:310 maximumConnections:2
+                                            longPoll:YES transport:transport];
+    PNRequestParameters *parameters = [PNRequestParameters new];
+    [parameters addPathComponent:@"a" forPlaceholder:@"{channels}"];
+    XCTestExpectation *expectation = [self expectationWithDescription:@"Subscribe"];
+    [network processOperation:PNSubscribeOperation withParameters:parameters data:nil
+              completionBlock:^(PNSubscribeStatus *status) {
+
+        XCTAssertEqual(status.category, PNNetworkIssuesCategory,
+                       @"Stalled long-poll should be restarted through catch up path.");
+        [expectation fulfill];
+    }];
+
+    [self waitForExpectationsWithTimeout:5 handler:nil];
+    XCTAssertEqualObjects([client metrics][@"watchdog.probes"], @1);
+    XCTAssertEqualObjects([client metrics][@"watchdog.deadConnections"], @1);
+    [network invalidate];
+}
+
+- (void)testOperationProcessingPerformance {
+
+    [self measureBlock:^{
+
+        dispatch_group_t group = dispatch_group_create();
+        for (NSUInteger operationIdx = 0; operationIdx < kPNLoopbackTransportTestsOperationsCount; operationIdx++) {
+
+            // Unique query field prevents concurrent time requests from being coalesced.
+            PNRequestParameters *parameters = [PNRequestParameters new];
+            [parameters addQueryParameter:@(operationIdx).stringValue forFieldName:@"seqn"];
+            dispatch_group_enter(group);
+            [self.network processOperation:PNTimeOperation withParameters:parameters data:nil
+                           completionBlock:^(PNTimeResult *result, PNErrorStatus *status) {
+
+                dispatch_group_leave(group);
+            }];
+        }
+        dispatch_group_wait(group, DISPATCH_TIME_FOREVER);
+    }];
+}
+
+
+#pragma mark - Misc
+
+- (PNTimeResult *)processTimeOperationWithStatus:(PNErrorStatus **)status {
+
+    __block PNTimeResult *timeResult = nil;
+    __block PNErrorStatus *errorStatus = nil;
+    dispatch_semaphore_t semaphore = dispatch_semaphore_create(0);
+    [self.network processOperation:PNTimeOperation withParameters:[PNRequestParameters new] data:nil
+                   completionBlock:^(PNTimeResult *result, PNErrorStatus *operationStatus) {
+
+        timeResult = result;
+        errorStatus = operationStatus;
+        dispatch_semaphore_signal(semaphore);
+    }];
+    dispatch_semaphore_wait(semaphore, dispatch_time(DISPATCH_TIME_NOW, (int64_t)(5 * NSEC_PER_SEC)));
+    if (status) { *status = errorStatus; }
+
+    return timeResult;
+}
+
+#pragma mark -
+
+
+@end
@@ -0,0 +1,259 @@
+#import "PNLoopbackClientTestCase.h"
+#import "PubNub+CorePrivate.h"
+#import "PNResult+Private.h"
+#import "PNStateListener.h"
+
+
+#pragma mark Private interface declaration
+
+/**
+ @brief  Listener which implement both single and batch messages callbacks.
+ */
+@interface PNMessagesBatchTestsListener : NSObject <PNObjectEventListener>
+
+
+#pragma mark - Properties
+
+/**
+ @brief  Stores list of messages batches in order in which they has been delivered.
+ */
+@property (nonatomic, strong) NSMutableArray<NSArray<PNMessageResult *> *> *batches;
+
+/**
+ @brief  Stores list of messages which has been delivered one-by-one.
+ */
+@property (nonatomic, strong) NSMutableArray<PNMessageResult *> *messages;
+
+#pragma mark -
+
+
+@end
+
+
+/**
+ @brief      Messages batch delivery testing.
+ @discussion Verify that listeners receive messages either in batches or one-by-one (depending on implemented
+             callbacks) and that batches from consecutive responses aggregated during configured window.
+
+ @author Sergey Mamontov
+ @copyright © 2009-2017 PubNub, Inc.
+ */
+@interface PNMessagesBatchTests : PNLoopbackClientTestCase
+
+
+#pragma mark - Properties
+
+/**
+ @brief  Stores reference on configuration which is used to create client for test.
+ */
+@property (nonatomic, strong) PNConfiguration *configuration;
+
+/**
+ @brief  Stores reference on listener which receive messages in batches.
+ */
+@property (nonatomic, strong) PNMessagesBatchTestsListener *batchListener;
+
+/**
+ @brief  Stores list of messages which has been delivered to test case one-by-one.
+ */
+@property (nonatomic, strong) NSMutableArray<PNMessageResult *> *receivedMessages;
+
+
+#pragma mark - Misc
+
+/**
+ @brief  Create client with current configuration and register listeners.
+ */
+- (void)createClient;
+
+/**
+ @brief      Notify listeners about messages in same way as subscriber does for single subscribe response.
+ @discussion Method wait till messages will be placed into pending events queue.
+
+ @param messages List of messages text which should be delivered.
+ */
+- (void)notifyResponseWithMessages:(NSArray<NSString *> *)messages;
+
+#pragma mark -
+
+
+@end
+
+
+#pragma mark - Test case implementation
+
+@implementation PNMessagesBatchTests
+
+- (void)setUp {
+
+    // Forward method call to the super class.
+    [super setUp];
+
+
+    // Prepare 'fixtures'
+    self.configuration = [PNConfiguration configurationWithPublishKey:@"demo" subscribeKey:@"demo"];
+    self.batchListener = [PNMessagesBatchTestsListener new];
+    self.receivedMessages = [NSMutableArray new];
+}
+
+- (void)tearDown {
+
+    [self.client removeListener:self.batchListener];
+
+    // Forward method call to the super class.
+    [super tearDown];
+}
+
+- (void)testBatchListenerReceiveMessagesOnlyInBatches {
+
+    [self createClient];
+    [self notifyResponseWithMessages:@[@"1", @"2"]];
+
+    XCTAssertTrue([self waitFor:5 condition:^BOOL{
+        @synchronized (self.batchListener) {
+            @synchronized (self) { return self.receivedMessages.count == 2 && self.batchListener.batches.count == 1; }
+        }
+    }]);
+    [self waitFor:0.2f condition:^BOOL{ return NO; }];
+    @synchronized (self.batchListener) {
+
+        XCTAssertEqual(self.batchListener.messages.count, 0,
+                       @"Batch listener shouldn't receive messages one-by-one.");
+        XCTAssertEqualObjects([self.batchListener.batches.firstObject valueForKeyPath:@"data.message"],
+                              (@[@"1", @"2"]));
+    }
+    @synchronized (self) {
+
+        XCTAssertEqualObjects([self.receivedMessages valueForKeyPath:@"data.message"], (@[@"1", @"2"]),
+                              @"Listener without batch callback should receive messages one-by-one.");
+    }
+}
+
+- (void)testBatchPerResponseWithoutAggregationWindow {
+
+    [self createClient];
+    [self notifyResponseWithMessages:@[@"1", @"2"]];
+    [self notifyResponseWithMessages:@[@"3"]];
+
+    XCTAssertTrue([self waitFor:5 condition:^BOOL{
+        @synchronized (self.batchListener) { return self.batchListener.batches.count == 2; }
+    }]);
+    @synchronized (self.batchListener) {
+
+        XCTAssertEqualObjects([self.batchListener.batches.lastObject valueForKeyPath:@"data.message"], (@[@"3"]));
+    }
+}
+
+- (void)testConsecutiveResponsesAggregatedDuringWindow {
+
+    self.configuration.messagesAggregationWindow = 0.3f;
+    [self createClient];
+    NSDate *startDate = [NSDate date];
+    [self notifyResponseWithMessages:@[@"1", @"2"]];
+    [self notifyResponseWithMessages:@[@"3"]];
+
+    XCTAssertTrue([self waitFor:5 condition:^BOOL{
+        @synchronized (self.batchListener) { return self.batchListener.batches.count > 0; }
+    }]);
+    XCTAssertGreaterThanOrEqual(-[startDate timeIntervalSinceNow], 0.25f,
+                                @"Batch should wait till aggregation window will be closed.");
+    [self waitFor:0.2f condition:^BOOL{ return NO; }];
+    @synchronized (self.batchListener) {
+
+        XCTAssertEqual(self.batchListener.batches.count, 1);
+        XCTAssertEqualObjects([self.batchListener.batches.firstObject valueForKeyPath:@"data.message"],
+                              (@[@"1", @"2", @"3"]));
+    }
+}
+
+- (void)testResponseAfterAggregationWindowDeliveredInNewBatch {
+
+    self.configuration.messagesAggregationWindow = 0.1f;
+    [self createClient];
+    [self notifyResponseWithMessages:@[@"1"]];
+    XCTAssertTrue([self waitFor:5 condition:^BOOL{
+        @synchronized (self.batchListener) { return self.batchListener.batches.count == 1; }
+    }]);
+    [self notifyResponseWithMessages:@[@"2"]];
+
+    XCTAssertTrue([self waitFor:5 condition:^BOOL{
+        @synchronized (self.batchListener) { return self.batchListener.batches.count == 2; }
+    }]);
+    @synchronized (self.batchListener) {
+
+        XCTAssertEqualObjects([self.batchListener.batches.lastObject valueForKeyPath:@"data.message"], (@[@"2"]));
+    }
+}
+
+
+#pragma mark - Listener
+
+- (void)client:(PubNub *)client didReceiveMessage:(PNMessageResult *)message {
+
+    @synchronized (self) { [self.receivedMessages addObject:message]; }
+}
+
+
+#pragma mark - Misc
+
+- (void)createClient {
+
+    [self createClientWithConfiguration:self.configuration];
+    [self.client addListener:self.batchListener];
+}
+
+- (void)notifyResponseWithMessages:(NSArray<NSString *> *)messages {
+
+    NSMutableArray<PNMessageResult *> *results = [NSMutableArray new];
+    for (NSString *message in messages) {
+
+        [results addObject:[PNMessageResult objectForOperation:PNSubscribeOperation completedWithTask:nil
+                                                 processedData:@{@"message": message, @"channel": @"a"}
+                                               processingError:nil]];
+    }
+
+    dispatch_semaphore_t semaphore = dispatch_semaphore_create(0);
+    [self.client.listenersManager notifyWithBlock:^{
+
+        for (PNMessageResult *message in results) { [self.client.listenersManager notifyMessage:message]; }
+        [self.client.listenersManager notifyMessages:results];
+        dispatch_semaphore_signal(semaphore);
+    }];
+    dispatch_semaphore_wait(semaphore, DISPATCH_TIME_FOREVER);
+}
+
+#pragma mark -
+
+
+@end
+
+
+#pragma mark - Listener implementation
+
+@implementation PNMessagesBatchTestsListener
+
+- (instancetype)init {
+
+    if ((self = [super init])) {
+
+        _batches = [NSMutableArray new];
+        _messages = [NSMutableArray new];
+    }
+
+    return self;
+}
+
+- (void)client:(PubNub *)client didReceiveMessage:(PNMessageResult *)message {
+
+    @synchronized (self) { [self.messages addObject:message]; }
+}
+
+- (void)client:(PubNub *)client didReceiveMessages:(NSArray<PNMessageResult *> *)messages {
+
+    @synchronized (self) { [self.batches addObject:messages]; }
+}
+
+#pragma mark -
+
+
+@end
@@ -0,0 +1,160 @@
+#import <XCTest/XCTest.h>
+#import "PNMessagesCache.h"
+
+
+/**
+ @brief      PNMessagesCache testing.
+ @discussion Verify messages 'de-dupe' cache behaviour on insertion, eviction and catch up clean up.
+
+ @author Sergey Mamontov
+ @copyright © 2009-2017 PubNub, Inc.
+ */
+@interface PNMessagesCacheTests : XCTestCase
+
+
+#pragma mark - Properties
+
+/**
+ @brief  Stores reference on cache which is used by tests.
+ */
+@property (nonatomic, strong) PNMessagesCache *cache;
+
+#pragma mark -
+
+
+@end
+
+
+#pragma mark - Test case implementation
+
+@implementation PNMessagesCacheTests
+
+- (void)setUp {
+
+    // Forward method call to the super class.
+    [super setUp];
+
+
+    // Prepare 'fixtures'
+    self.cache = [PNMessagesCache cacheWithCapacity:3];
+}
+
+- (void)testDuplicateMessageDetection {
+
+    XCTAssertTrue([self.cache storeMessage:@{@"text": @"Hello"} withTimetoken:@(1) forChannel:@"a"],
+                  @"New message should be treated as unique.");
+    XCTAssertFalse([self.cache storeMessage:@{@"text": @"Hello"} withTimetoken:@(1) forChannel:@"a"],
+                   @"Same message should be treated as duplicate.");
+    XCTAssertTrue([self.cache storeMessage:@{@"text": @"Hello"} withTimetoken:@(1) forChannel:@"b"],
+                  @"Same message on another channel should be treated as unique.");
+    XCTAssertTrue([self.cache storeMessage:@{@"text": @"Hi"} withTimetoken:@(1) forChannel:@"a"],
+                  @"Another message with same time token should be treated as unique.");
+    XCTAssertEqual(self.cache.count, 3, @"Unexpected number of cached messages.");
+}
+
+- (void)testEqualDictionariesWithDifferentKeysOrderDetected {
+
+    NSMutableDictionary *message = [NSMutableDictionary new];
+    NSMutableDictionary *sameMessage = [NSMutableDictionary new];
+    for (NSUInteger keyIdx = 0; keyIdx < 20; keyIdx++) {
+
+        message[[NSString stringWithFormat:@"key%@", @(keyIdx)]] = @{@"idx": @(keyIdx), @"list": @[@(keyIdx)]};
+        sameMessage[[NSString stringWithFormat:@"key%@", @(19 - keyIdx)]] = @{@"list": @[@(19 - keyIdx)],
+                                                                               @"idx": @(19 - keyIdx)};
+    }
+
+    XCTAssertTrue([self.cache storeMessage:message withTimetoken:@(1) forChannel:@"a"]);
+    XCTAssertFalse([self.cache storeMessage:sameMessage withTimetoken:@(1) forChannel:@"a"],
+                   @"Equal message with different keys order should be treated as duplicate.");
+    XCTAssertTrue([self.cache storeMessage:@{@"key0": @"1"} withTimetoken:@(1) forChannel:@"a"]);
+    XCTAssertTrue([self.cache storeMessage:@{@"key0": @1} withTimetoken:@(1) forChannel:@"a"],
+                  @"Values of different types should be treated as different messages.");
+}
+
+- (void)testCacheSizeNeverExceedCapacity {
+
+    for (NSUInteger messageIdx = 0; messageIdx < 10; messageIdx++) {
+
+        [self.cache storeMessage:@(messageIdx) withTimetoken:@(messageIdx) forChannel:@"a"];
+        XCTAssertLessThanOrEqual(self.cache.count, self.cache.capacity, @"Cache size exceed capacity.");
+    }
+
+    XCTAssertTrue([self.cache storeMessage:@(0) withTimetoken:@(0) forChannel:@"a"],
+                  @"Evicted message should be treated as unique.");
+    XCTAssertFalse([self.cache storeMessage:@(9) withTimetoken:@(9) forChannel:@"a"],
+                   @"Recent message should be treated as duplicate.");
+}
+
+- (void)testRemoveMessagesNewerThanTimetoken {
+
+    [self.cache storeMessage:@"first" withTimetoken:@(10) forChannel:@"a"];
+    [self.cache storeMessage:@"second" withTimetoken:@(20) forChannel:@"a"];
+    [self.cache storeMessage:@"third" withTimetoken:@(30) forChannel:@"a"];
+    [self.cache removeMessagesNewerThan:@(20)];
+
+    XCTAssertEqual(self.cache.count, 1, @"Unexpected number of cached messages.");
+    XCTAssertFalse([self.cache storeMessage:@"first" withTimetoken:@(10) forChannel:@"a"],
+                   @"Older message should stay in cache.");
+    XCTAssertTrue([self.cache storeMessage:@"second" withTimetoken:@(20) forChannel:@"a"],
+                  @"Message with same time token should be removed from cache.");
+    XCTAssertTrue([self.cache storeMessage:@"third" withTimetoken:@(30) forChannel:@"a"],
+                  @"Newer message should be removed from cache.");
+}
+
+- (void)testRemoveMessagesReceivedOutOfOrder {
+
+    [self.cache storeMessage:@"second" withTimetoken:@(20) forChannel:@"a"];
+    [self.cache storeMessage:@"third" withTimetoken:@(30) forChannel:@"a"];
+    [self.cache storeMessage:@"first" withTimetoken:@(10) forChannel:@"a"];
+    [self.cache removeMessagesNewerThan:@(15)];
+
+    XCTAssertEqual(self.cache.count, 1, @"Unexpected number of cached messages.");
+    XCTAssertFalse([self.cache storeMessage:@"first" withTimetoken:@(10) forChannel:@"a"],
+                   @"Older message should stay in cache.");
+
+    [self.cache storeMessage:@"fourth" withTimetoken:@(40) forChannel:@"a"];
+    [self.cache storeMessage:@"fifth" withTimetoken:@(50) forChannel:@"a"];
+    XCTAssertEqual(self.cache.count, 3, @"Removed messages should free space for new messages.");
+    XCTAssertFalse([self.cache storeMessage:@"first" withTimetoken:@(10) forChannel:@"a"],
+                   @"Free space should be used before older messages eviction.");
+}
+
+- (void)testRemovedMessagesInsideRingFreeSpace {
+
+    [self.cache storeMessage:@"first" withTimetoken:@(10) forChannel:@"a"];
+    [self.cache storeMessage:@"third" withTimetoken:@(30) forChannel:@"a"];
+    [self.cache storeMessage:@"second" withTimetoken:@(20) forChannel:@"a"];
+    [self.cache removeMessagesNewerThan:@(25)];
+
+    XCTAssertEqual(self.cache.count, 2, @"Unexpected number of cached messages.");
+
+    [self.cache storeMessage:@"fourth" withTimetoken:@(40) forChannel:@"a"];
+    XCTAssertEqual(self.cache.count, 3, @"Removed message should free space for new message.");
+    XCTAssertFalse([self.cache storeMessage:@"first" withTimetoken:@(10) forChannel:@"a"],
+                   @"Free space should be used before older messages eviction.");
+    XCTAssertFalse([self.cache storeMessage:@"second" withTimetoken:@(20) forChannel:@"a"],
+                   @"Free space should be used before older messages eviction.");
+
+    [self.cache storeMessage:@"fifth" withTimetoken:@(50) forChannel:@"a"];
+    XCTAssertTrue([self.cache storeMessage:@"first" withTimetoken:@(10) forChannel:@"a"],
+                  @"Oldest message should be evicted when cache is full.");
+    XCTAssertFalse([self.cache storeMessage:@"fifth" withTimetoken:@(50) forChannel:@"a"],
+                   @"Recent message should stay in cache.");
+}
+
+- (void)testInheritMessagesFromCache {
+
+    [self.cache storeMessage:@"first" withTimetoken:@(10) forChannel:@"a"];
+    [self.cache storeMessage:@"second" withTimetoken:@(20) forChannel:@"a"];
+    PNMessagesCache *cache = [PNMessagesCache cacheWithCapacity:1];
+    [cache inheritMessagesFromCache:self.cache];
+
+    XCTAssertEqual(cache.count, 1, @"Unexpected number of cached messages.");
+    XCTAssertFalse([cache storeMessage:@"second" withTimetoken:@(20) forChannel:@"a"],
+                   @"Newest message should be inherited.");
+}
+
+#pragma mark -
+
+
+@end
@@ -0,0 +1,82 @@
+#import <XCTest/XCTest.h>
+#import <PubNub/PubNub.h>
+#import "PNLoopbackTransport.h"
+#import "PNNetwork.h"
+
+
+/**
+ @brief      Presence API call builder where now requests testing.
+ @discussion Verify that where now API call built with presence builder sent to where now endpoint.
+
+ @author Sergey Mamontov
+ @copyright © 2009-2017 PubNub, Inc.
+ */
+@interface PNPresenceWhereNowTests : XCTestCase
+
+
+#pragma mark - Properties
+
+/**
+ @brief  Stores reference on client which send requests through loopback transport.
+ */
+@property (nonatomic, strong) PubNub *client;
+
+/**
+ @brief  Stores reference on transport which is used by client's non-subscribe network manager.
+ */
+@property (nonatomic, strong) PNLoopbackTransport *transport;
+
+#pragma mark -
+
+
+@end
+
+
+#pragma mark - Test case implementation
+
+@implementation PNPresenceWhereNowTests
+
+- (void)setUp {
+
+    // Forward method call to the super class.
+    [super setUp];
+
+
+    // Prepare 'fixtures'
+    PNConfiguration *configuration = [PNConfiguration configurationWithPublishKey:@"demo"
+                                                                     subscribeKey:@"demo"];
+    self.client = [PubNub clientWithConfiguration:configuration];
+    self.transport = [PNLoopbackTransport transport];
+    PNNetwork *network = [PNNetwork networkForClient:self.client requestTimeout:10 maximumConnections:3
+                                            longPoll:NO transport:self.transport];
+    [self.client setValue:network forKey:@"serviceNetwork"];
+}
+
+- (void)testBuilderWhereNowSentToWhereNowEndpoint {
+
+    __block NSString *requestPath = nil;
+    self.transport.responder = ^(NSURLRequest *request, PNLoopbackTransportRespondBlock respond) {
+
+        requestPath = request.URL.path;
+        respond(200, [@"{\"status\":200,\"payload\":{\"channels\":[\"a\"]},\"service\":\"Presence\"}"
+                      dataUsingEncoding:NSUTF8StringEncoding], nil);
+    };
+    XCTestExpectation *expectation = [self expectationWithDescription:@"Where now"];
+    self.client.presence().whereNow().uuid(@"tester")
+        .performWithCompletion(^(PNPresenceWhereNowResult *result, PNErrorStatus *status) {
+
+            XCTAssertNil(status, @"Unexpected error.");
+            XCTAssertEqual(result.operation, PNWhereNowOperation);
+            XCTAssertEqualObjects(result.data.channels, @[@"a"]);
+            [expectation fulfill];
+        });
+
+    [self waitForExpectationsWithTimeout:5 handler:nil];
+    XCTAssertEqualObjects(requestPath, @"/v2/presence/sub-key/demo/uuid/tester",
+                          @"Where now shouldn't be sent to global here now endpoint.");
+}
+
+#pragma mark -
+
+
+@end
@@ -0,0 +1,197 @@
+#import <XCTest/XCTest.h>
+#import <PubNub/PubNub.h>
+#import "PubNub+CorePrivate.h"
+#import "PNLoopbackTransport.h"
+#import "PNRequestParameters.h"
+#import "PNRetryBudget.h"
+#import "PNNetwork.h"
+
+
+/**
+ @brief      Automatic non-subscribe requests retry testing.
+ @discussion Verify that only idempotent operations retried, that retry budget limit number of attempts and
+             that API call completed only once.
+
+ @author Sergey Mamontov
+ @copyright © 2009-2017 PubNub, Inc.
+ */
+@interface PNRequestRetryTests : XCTestCase
+
+
+#pragma mark - Properties
+
+/**
+ @brief  Stores reference on transport which is used by client's non-subscribe network manager.
+ */
+@property (nonatomic, strong) PNLoopbackTransport *transport;
+
+
+#pragma mark - Misc
+
+/**
+ @brief  Create client which send non-subscribe requests through loopback transport.
+
+ @param configuration Reference on client configuration.
+
+ @return Configured and ready to use client.
+ */
+- (PubNub *)clientWithConfiguration:(PNConfiguration *)configuration;
+
+#pragma mark -
+
+
+@end
+
+
+#pragma mark - Test case implementation
+
+@implementation PNRequestRetryTests
+
+- (void)setUp {
+
+    // Forward method call to the super class.
+    [super setUp];
+
+
+    // Prepare 'fixtures'
+    self.transport = [PNLoopbackTransport transport];
+}
+
+- (void)testBudgetExhaustedAndRestored {
+
+    PNRetryBudget *budget = [PNRetryBudget budgetWithMaximumTokens:2];
+
+    XCTAssertTrue([budget consumeToken]);
+    XCTAssertTrue([budget consumeToken]);
+    XCTAssertFalse([budget consumeToken], @"Empty budget shouldn't allow retry.");
+    for (NSUInteger requestIdx = 0; requestIdx < 10; requestIdx++) { [budget recordSuccess]; }
+    XCTAssertTrue([budget consumeToken], @"Successful requests should restore budget.");
+    for (NSUInteger requestIdx = 0; requestIdx < 100; requestIdx++) { [budget recordSuccess]; }
+    XCTAssertEqualWithAccuracy(budget.tokens, 2.f, 0.001f, @"Budget shouldn't exceed maximum.");
+}
+
+- (void)testFailedRequestRetried {
+
+    PNConfiguration *configuration = [PNConfiguration configurationWithPublishKey:@"demo"
+                                                                     subscribeKey:@"demo"];
+    configuration.requestRetryAttempts = @{@(PNTimeOperation): @2};
+    PubNub *client = [self clientWithConfiguration:configuration];
+    __block NSUInteger attempts = 0;
+    self.transport.responder = ^(NSURLRequest *request, PNLoopbackTransportRespondBlock respond) {
+
+        if (++attempts == 1) { respond(503, [@"{}" dataUsingEncoding:NSUTF8StringEncoding], nil); }
+        else { respond(200, [@"[15000000000000000]" dataUsingEncoding:NSUTF8StringEncoding], nil); }
+    };
+    XCTestExpectation *expectation = [self expectationWithDescription:@"Retry"];
+    [client processOperation:PNTimeOperation withParameters:[PNRequestParameters new]
+             completionBlock:^(PNTimeResult *result, PNErrorStatus *status) {
+
+        XCTAssertNil(status, @"Retried request should succeed.");
+        XCTAssertEqualObjects(result.data.timetoken, @(15000000000000000), @"Unexpected time token.");
+        [expectation fulfill];
+    }];
+
+    [self waitForExpectationsWithTimeout:10 handler:nil];
+    XCTAssertEqual(self.transport.requestsCount, 2, @"Unexpected number of attempts.");
+    XCTAssertEqualObjects([client metrics][@"retry.attempts"], @1);
+    XCTAssertEqualObjects([client metrics][@"retry.succeeded"], @1);
+}
+
+- (void)testCoalescedCallsReceiveRetriedRequestResult {
+
+    PNConfiguration *configuration = [PNConfiguration configurationWithPublishKey:@"demo"
+                                                                     subscribeKey:@"demo"];
+    configuration.requestRetryAttempts = @{@(PNTimeOperation): @2};
+    PubNub *client = [self clientWithConfiguration:configuration];
+    __block NSUInteger attempts = 0;
+    self.transport.responder = ^(NSURLRequest *request, PNLoopbackTransportRespondBlock respond) {
+
+        if (++attempts == 1) { respond(503, [@"{}" dataUsingEncoding:NSUTF8StringEncoding], nil); }
+        else { respond(200, [@"[15000000000000000]" dataUsingEncoding:NSUTF8StringEncoding], nil); }
+    };
+    XCTestExpectation *firstExpectation = [self expectationWithDescription:@"First call"];
+    XCTestExpectation *secondExpectation = [self expectationWithDescription:@"Attached call"];
+    [client processOperation:PNTimeOperation withParameters:[PNRequestParameters new]
+             completionBlock:^(PNTimeResult *result, PNErrorStatus *status) {
+
+        XCTAssertNil(status, @"Retried request should succeed.");
+        [firstExpectation fulfill];
+    }];
+    [client processOperation:PNTimeOperation withParameters:[PNRequestParameters new]
+             completionBlock:^(PNTimeResult *result, PNErrorStatus *status) {
+
+        XCTAssertNil(status, @"Attached call should receive result of retried request.");
+        XCTAssertEqualObjects(result.data.timetoken, @(15000000000000000), @"Unexpected time token.");
+        [secondExpectation fulfill];
+    }];
+
+    [self waitForExpectationsWithTimeout:10 handler:nil];
+    XCTAssertEqual(self.transport.requestsCount, 2, @"Attached call shouldn't be retried separately.");
+    XCTAssertEqualObjects([client metrics][@"requests.coalesced"], @1);
+    XCTAssertEqualObjects([client metrics][@"retry.attempts"], @1);
+}
+
+- (void)testRetryStopWhenBudgetExhausted {
+
+    PNConfiguration *configuration = [PNConfiguration configurationWithPublishKey:@"demo"
+                                                                     subscribeKey:@"demo"];
+    configuration.requestRetryAttempts = @{@(PNTimeOperation): @5};
+    configuration.requestRetryBudget = 1;
+    PubNub *client = [self clientWithConfiguration:configuration];
+    self.transport.responder = ^(NSURLRequest *request, PNLoopbackTransportRespondBlock respond) {
+        respond(503, [@"{}" dataUsingEncoding:NSUTF8StringEncoding], nil);
+    };
+    XCTestExpectation *expectation = [self expectationWithDescription:@"Budget"];
+    [client processOperation:PNTimeOperation withParameters:[PNRequestParameters new]
+             completionBlock:^(PNTimeResult *result, PNErrorStatus *status) {
+
+        XCTAssertTrue(status.isError, @"Last attempt status should be reported.");
+        [expectation fulfill];
+    }];
+
+    [self waitForExpectationsWithTimeout:10 handler:nil];
+    XCTAssertEqual(self.transport.requestsCount, 2, @"Retry budget should limit attempts.");
+    XCTAssertEqualObjects([client metrics][@"retry.budgetExhausted"], @1);
+}
+
+- (void)testNonIdempotentRequestNotRetried {
+
+    PNConfiguration *configuration = [PNConfiguration configurationWithPublishKey:@"demo"
+                                                                     subscribeKey:@"demo"];
+    configuration.requestRetryAttempts = @{@(PNPublishOperation): @2};
+    PubNub *client = [self clientWithConfiguration:configuration];
+    self.transport.responder = ^(NSURLRequest *request, PNLoopbackTransportRespondBlock respond) {
+        respond(503, [@"{}" dataUsingEncoding:NSUTF8StringEncoding], nil);
+    };
+    PNRequestParameters *parameters = [PNRequestParameters new];
+    [parameters addPathComponent:@"a" forPlaceholder:@"{channel}"];
+    [parameters addPathComponent:@"%22m%22" forPlaceholder:@"{message}"];
+    XCTestExpectation *expectation = [self expectationWithDescription:@"Publish"];
+    [client processOperation:PNPublishOperation withParameters:parameters
+             completionBlock:^(PNPublishStatus *status) {
+
+        XCTAssertTrue(status.isError, @"Failed publish should be reported.");
+        [expectation fulfill];
+    }];
+
+    [self waitForExpectationsWithTimeout:10 handler:nil];
+    XCTAssertEqual(self.transport.requestsCount, 1, @"Publish without sequence number shouldn't be retried.");
+}
+
+
+#pragma mark - Misc
+
+- (PubNub *)clientWithConfiguration:(PNConfiguration *)configuration {
+
+    PubNub *client = [PubNub clientWithConfiguration:configuration];
+    PNNetwork *network = [PNNetwork networkForClient:client requestTimeout:10 maximumConnections:3
+                                            longPoll:NO transport:self.transport];
+    [client setValue:network forKey:@"serviceNetwork"];
+
+    return client;
+}
+
+#pragma mark -
+
+
+@end
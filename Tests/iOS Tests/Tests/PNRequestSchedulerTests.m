@@ -0,0 +1,181 @@
+#import <XCTest/XCTest.h>
+#import "PNRequestScheduler.h"
+#import "PNLoopbackTransport.h"
+
+
+/**
+ @brief      PNRequestScheduler testing.
+ @discussion Verify that tasks started in order of their priority class and that lanes concurrency limits
+             keep connections for high priority requests.
+
+ @author Sergey Mamontov
+ @copyright © 2009-2017 PubNub, Inc.
+ */
+@interface PNRequestSchedulerTests : XCTestCase
+
+
+#pragma mark - Properties
+
+/**
+ @brief  Stores reference on transport which is used to create tasks.
+ */
+@property (nonatomic, strong) PNLoopbackTransport *transport;
+
+/**
+ @brief  Stores reference on list of request paths in order in which they has been received by transport.
+ */
+@property (nonatomic, strong) NSMutableArray<NSString *> *receivedPaths;
+
+
+#pragma mark - Misc
+
+/**
+ @brief  Create task which will report it's completion to scheduler.
+
+ @param path       Reference on request path.
+ @param scheduler  Reference on scheduler which should be notified about task completion.
+ @param completion Reference on block which should be called after task completion.
+
+ @return Created task.
+ */
+- (id <PNTransportTask>)taskWithPath:(NSString *)path scheduler:(PNRequestScheduler *)scheduler
+                          completion:(void(^)(NSError *error))completion;
+
+#pragma mark -
+
+
+@end
+
+
+#pragma mark - Test case implementation
+
+@implementation PNRequestSchedulerTests
+
+- (void)setUp {
+
+    // Forward method call to the super class.
+    [super setUp];
+
+
+    // Prepare 'fixtures'
+    self.transport = [PNLoopbackTransport transport];
+    self.receivedPaths = [NSMutableArray new];
+}
+
+- (void)tearDown {
+
+    [self.transport invalidate];
+
+    // Forward method call to the super class.
+    [super tearDown];
+}
+
+- (void)testOperationsPriorityClasses {
+
+    XCTAssertEqual([PNRequestScheduler priorityForOperation:PNPublishOperation], PNPublishRequestPriority);
+    XCTAssertEqual([PNRequestScheduler priorityForOperation:PNHeartbeatOperation], PNHeartbeatRequestPriority);
+    XCTAssertEqual([PNRequestScheduler priorityForOperation:PNSetStateOperation], PNStateRequestPriority);
+    XCTAssertEqual([PNRequestScheduler priorityForOperation:PNHistoryOperation], PNAuditRequestPriority);
+    XCTAssertEqual([PNRequestScheduler priorityForOperation:PNHereNowForChannelOperation],
+                   PNAuditRequestPriority);
+}
+
+- (void)testTasksStartedInPriorityOrder {
+
+    __block PNLoopbackTransportRespondBlock heldRespond = nil;
+    __weak __typeof(self) weakSelf = self;
+    self.transport.responder = ^(NSURLRequest *request, PNLoopbackTransportRespondBlock respond) {
+
+        @synchronized (weakSelf.receivedPaths) { [weakSelf.receivedPaths addObject:request.URL.path]; }
+        if ([request.URL.path isEqualToString:@"/v2/history/first"]) { heldRespond = respond; }
+        else { respond(200, [@"[]" dataUsingEncoding:NSUTF8StringEncoding], nil); }
+    };
+    PNRequestScheduler *scheduler = [PNRequestScheduler schedulerWithMaximumActiveTasks:1 limits:nil];
+    dispatch_group_t group = dispatch_group_create();
+    NSArray<NSString *> *paths = @[@"/v2/history/first", @"/v2/history/second", @"/v1/channel-registration",
+                                   @"/publish"];
+    NSArray<NSNumber *> *priorities = @[@(PNAuditRequestPriority), @(PNAuditRequestPriority),
+                                        @(PNStateRequestPriority), @(PNPublishRequestPriority)];
+    for (NSUInteger taskIdx = 0; taskIdx < paths.count; taskIdx++) {
+
+        dispatch_group_enter(group);
+        id <PNTransportTask> task = [self taskWithPath:paths[taskIdx] scheduler:scheduler
+                                            completion:^(NSError *error) { dispatch_group_leave(group); }];
+        [scheduler scheduleTask:task withPriority:(PNRequestPriority)priorities[taskIdx].integerValue];
+    }
+
+    XCTAssertEqual(self.transport.requestsCount, 1, @"Only one task should be started.");
+    XCTAssertEqualObjects([scheduler metrics][@"network.audit.queue.depth"], @1);
+    XCTAssertEqualObjects([scheduler metrics][@"network.publish.queue.depth"], @1);
+    while (!heldRespond) { [[NSRunLoop currentRunLoop] runUntilDate:[NSDate dateWithTimeIntervalSinceNow:0.01]]; }
+    heldRespond(200, [@"[]" dataUsingEncoding:NSUTF8StringEncoding], nil);
+
+    XCTAssertEqual(dispatch_group_wait(group, dispatch_time(DISPATCH_TIME_NOW, (int64_t)(5 * NSEC_PER_SEC))), 0);
+    NSArray *expected = @[@"/v2/history/first", @"/publish", @"/v1/channel-registration", @"/v2/history/second"];
+    XCTAssertEqualObjects(self.receivedPaths, expected, @"Tasks should be started in priority order.");
+    XCTAssertEqualObjects([scheduler metrics][@"network.audit.queue.maxDepth"], @1);
+}
+
+- (void)testLaneLimitKeepConnectionForPublish {
+
+    self.transport.responder = ^(NSURLRequest *request, PNLoopbackTransportRespondBlock respond) {};
+    PNRequestScheduler *scheduler = [PNRequestScheduler schedulerWithMaximumActiveTasks:3
+                                                                                 limits:@{@(PNAuditRequestPriority): @1}];
+    for (NSUInteger taskIdx = 0; taskIdx < 5; taskIdx++) {
+
+        id <PNTransportTask> task = [self taskWithPath:@"/v2/history" scheduler:scheduler completion:nil];
+        [scheduler scheduleTask:task withPriority:PNAuditRequestPriority];
+    }
+    id <PNTransportTask> task = [self taskWithPath:@"/publish" scheduler:scheduler completion:nil];
+    [scheduler scheduleTask:task withPriority:PNPublishRequestPriority];
+
+    NSDictionary *metrics = [scheduler metrics];
+    XCTAssertEqual(self.transport.requestsCount, 2, @"Audit lane should be limited to single task.");
+    XCTAssertEqualObjects(metrics[@"network.audit.active"], @1);
+    XCTAssertEqualObjects(metrics[@"network.audit.queue.depth"], @4);
+    XCTAssertEqualObjects(metrics[@"network.publish.active"], @1);
+}
+
+- (void)testCancelPendingTasks {
+
+    self.transport.responder = ^(NSURLRequest *request, PNLoopbackTransportRespondBlock respond) {};
+    PNRequestScheduler *scheduler = [PNRequestScheduler schedulerWithMaximumActiveTasks:1 limits:nil];
+    XCTestExpectation *expectation = [self expectationWithDescription:@"Cancellation"];
+    id <PNTransportTask> activeTask = [self taskWithPath:@"/time/0" scheduler:scheduler completion:nil];
+    id <PNTransportTask> pendingTask = [self taskWithPath:@"/v2/history" scheduler:scheduler
+                                               completion:^(NSError *error) {
+
+        XCTAssertEqual(error.code, NSURLErrorCancelled, @"Pending task should be cancelled.");
+        [expectation fulfill];
+    }];
+    [scheduler scheduleTask:activeTask withPriority:PNStateRequestPriority];
+    [scheduler scheduleTask:pendingTask withPriority:PNAuditRequestPriority];
+    [scheduler cancelPendingTasksWithURLPrefix:@"/v2/history"];
+
+    [self waitForExpectationsWithTimeout:5 handler:nil];
+    XCTAssertEqual(self.transport.requestsCount, 1, @"Cancelled task shouldn't be started.");
+    XCTAssertEqualObjects([scheduler metrics][@"network.audit.queue.depth"], @0);
+}
+
+
+#pragma mark - Misc
+
+- (id <PNTransportTask>)taskWithPath:(NSString *)path scheduler:(PNRequestScheduler *)scheduler
+                          completion:(void(^)(NSError *error))completion {
+
+    NSURL *url = [NSURL URLWithString:[@"https://ps.pndsn.com" stringByAppendingString:path]];
+    __block id <PNTransportTask> task = nil;
+    task = [self.transport taskWithRequest:[NSURLRequest requestWithURL:url]
+                                completion:^(NSData *data, NSURLResponse *response, NSError *error) {
+
+        [scheduler completeTask:task];
+        if (completion) { completion(error); }
+    }];
+
+    return task;
+}
+
+#pragma mark -
+
+
+@end
@@ -0,0 +1,266 @@
+#import <XCTest/XCTest.h>
+#import <PubNub/PubNub.h>
+#import "PNLoopbackTransport.h"
+#import "PNRequestParameters.h"
+#import "PNRequestHandle+Private.h"
+#import "PNResponseCache.h"
+#import "PNReachability.h"
+#import "PNResult+Private.h"
+#import "PNNetwork.h"
+
+
+/**
+ @brief      PNResponseCache testing.
+ @discussion Verify results reuse, expiration, size limit and invalidation by modification operations.
+
+ @author Sergey Mamontov
+ @copyright © 2009-2017 PubNub, Inc.
+ */
+@interface PNResponseCacheTests : XCTestCase
+
+
+#pragma mark - Misc
+
+/**
+ @brief  Construct URL for request.
+
+ @param path Reference on request path and query.
+
+ @return Request URL.
+ */
+- (NSURL *)URLWithPath:(NSString *)path;
+
+/**
+ @brief  Construct result which can be stored in cache.
+
+ @param operation One of \b PNOperationType enum fields for which result should be created.
+
+ @return Result object.
+ */
+- (PNResult *)resultForOperation:(PNOperationType)operation;
+
+#pragma mark -
+
+
+@end
+
+
+#pragma mark - Test case implementation
+
+@implementation PNResponseCacheTests
+
+- (void)testCachedResultReused {
+
+    PNResponseCache *cache = [PNResponseCache cacheWithTimeToLive:@{@(PNTimeOperation): @60} maximumCount:10];
+    NSURL *url = [self URLWithPath:@"/time/0?uuid=a&requestid=1&l_time=0.1"];
+
+    XCTAssertNil([cache resultForOperation:PNTimeOperation URL:url], @"Empty cache shouldn't have result.");
+    [cache storeResult:[self resultForOperation:PNTimeOperation] forOperation:PNTimeOperation URL:url];
+    PNResult *result = [cache resultForOperation:PNTimeOperation
+                                             URL:[self URLWithPath:@"/time/0?requestid=2&uuid=a"]];
+
+    XCTAssertNotNil(result, @"Per-request query fields shouldn't affect cache key.");
+    XCTAssertEqual(result.operation, PNTimeOperation, @"Unexpected operation.");
+    XCTAssertNil([cache resultForOperation:PNTimeOperation URL:[self URLWithPath:@"/time/0?uuid=b"]],
+                 @"Different arguments shouldn't use same result.");
+}
+
+- (void)testOperationsWithoutTimeToLiveNotCached {
+
+    PNResponseCache *cache = [PNResponseCache cacheWithTimeToLive:@{@(PNTimeOperation): @60,
+                                                                    @(PNPublishOperation): @60}
+                                                     maximumCount:10];
+
+    XCTAssertTrue([cache canCacheOperation:PNTimeOperation]);
+    XCTAssertFalse([cache canCacheOperation:PNChannelsForGroupOperation], @"Operation without TTL cached.");
+    XCTAssertFalse([cache canCacheOperation:PNPublishOperation], @"Modification operation cached.");
+}
+
+- (void)testExpiredResultRemoved {
+
+    PNResponseCache *cache = [PNResponseCache cacheWithTimeToLive:@{@(PNTimeOperation): @0.1} maximumCount:10];
+    NSURL *url = [self URLWithPath:@"/time/0"];
+    [cache resultForOperation:PNTimeOperation URL:url];
+    [cache storeResult:[self resultForOperation:PNTimeOperation] forOperation:PNTimeOperation URL:url];
+    [[NSRunLoop currentRunLoop] runUntilDate:[NSDate dateWithTimeIntervalSinceNow:0.2]];
+
+    XCTAssertNil([cache resultForOperation:PNTimeOperation URL:url], @"Expired result shouldn't be used.");
+    XCTAssertEqual(cache.count, 0, @"Expired result should be removed.");
+}
+
+- (void)testLeastRecentlyUsedResultEvicted {
+
+    PNResponseCache *cache = [PNResponseCache cacheWithTimeToLive:@{@(PNTimeOperation): @60} maximumCount:2];
+    for (NSString *uuid in @[@"a", @"b", @"c"]) {
+
+        NSURL *url = [self URLWithPath:[@"/time/0?uuid=" stringByAppendingString:uuid]];
+        [cache resultForOperation:PNTimeOperation URL:url];
+        [cache storeResult:[self resultForOperation:PNTimeOperation] forOperation:PNTimeOperation URL:url];
+        if ([uuid isEqualToString:@"b"]) {
+            [cache resultForOperation:PNTimeOperation URL:[self URLWithPath:@"/time/0?uuid=a"]];
+        }
+    }
+
+    XCTAssertEqual(cache.count, 2, @"Cache size limit exceeded.");
+    XCTAssertNotNil([cache resultForOperation:PNTimeOperation URL:[self URLWithPath:@"/time/0?uuid=a"]]);
+    XCTAssertNil([cache resultForOperation:PNTimeOperation URL:[self URLWithPath:@"/time/0?uuid=b"]]);
+}
+
+- (void)testModificationInvalidateAffectedResults {
+
+    PNResponseCache *cache = [PNResponseCache cacheWithTimeToLive:@{@(PNChannelsForGroupOperation): @60,
+                                                                    @(PNStateForChannelOperation): @60}
+                                                     maximumCount:10];
+    NSURL *groupURL = [self URLWithPath:@"/v1/channel-registration/sub-key/demo/channel-group/g"];
+    NSURL *stateURL = [self URLWithPath:@"/v2/presence/sub-key/demo/channel/a/uuid/u"];
+    [cache resultForOperation:PNChannelsForGroupOperation URL:groupURL];
+    [cache storeResult:[self resultForOperation:PNChannelsForGroupOperation]
+          forOperation:PNChannelsForGroupOperation URL:groupURL];
+    [cache resultForOperation:PNStateForChannelOperation URL:stateURL];
+    [cache storeResult:[self resultForOperation:PNStateForChannelOperation]
+          forOperation:PNStateForChannelOperation URL:stateURL];
+    [cache invalidateResultsAffectedByOperation:PNAddChannelsToGroupOperation];
+
+    XCTAssertNil([cache resultForOperation:PNChannelsForGroupOperation URL:groupURL],
+                 @"Channel group audit should be invalidated.");
+    XCTAssertNotNil([cache resultForOperation:PNStateForChannelOperation URL:stateURL],
+                    @"Unrelated results shouldn't be invalidated.");
+}
+
+- (void)testResultOfRequestSentBeforeInvalidationRejected {
+
+    PNResponseCache *cache = [PNResponseCache cacheWithTimeToLive:@{@(PNChannelsForGroupOperation): @60}
+                                                     maximumCount:10];
+    NSURL *url = [self URLWithPath:@"/v1/channel-registration/sub-key/demo/channel-group/g"];
+    [cache resultForOperation:PNChannelsForGroupOperation URL:url];
+    [cache invalidateResultsAffectedByOperation:PNRemoveChannelsFromGroupOperation];
+    [cache storeResult:[self resultForOperation:PNChannelsForGroupOperation]
+          forOperation:PNChannelsForGroupOperation URL:url];
+
+    XCTAssertEqual(cache.count, 0, @"Potentially stale result shouldn't be stored.");
+}
+
+- (void)testNetworkServeRepeatedCallFromCache {
+
+    PNConfiguration *configuration = [PNConfiguration configurationWithPublishKey:@"demo"
+                                                                     subscribeKey:@"demo"];
+    configuration.responseCacheTimeToLive = @{@(PNTimeOperation): @60};
+    PubNub *client = [PubNub clientWithConfiguration:configuration];
+    PNLoopbackTransport *transport = [PNLoopbackTransport transport];
+    [transport setResponseData:[@"[15000000000000000]" dataUsingEncoding:NSUTF8StringEncoding]
+                    statusCode:200 forPathPrefix:@"/time/0"];
+    PNNetwork *network = [PNNetwork networkForClient:client requestTimeout:10 maximumConnections:3
+                                            longPoll:NO transport:transport];
+
+    for (NSUInteger callIdx = 0; callIdx < 2; callIdx++) {
+
+        XCTestExpectation *expectation = [self expectationWithDescription:@"Time"];
+        [network processOperation:PNTimeOperation withParameters:[PNRequestParameters new] data:nil
+                  completionBlock:^(PNTimeResult *result, PNErrorStatus *status) {
+
+            XCTAssertNil(status, @"Unexpected error.");
+            XCTAssertEqualObjects(result.data.timetoken, @(15000000000000000), @"Unexpected time token.");
+            [expectation fulfill];
+        }];
+        [self waitForExpectationsWithTimeout:5 handler:nil];
+    }
+
+    XCTAssertEqual(transport.requestsCount, 1, @"Repeated call should be served from cache.");
+    XCTAssertEqualObjects([client metrics][@"cache.hits"], @1);
+    XCTAssertEqualObjects([client metrics][@"cache.misses"], @1);
+    [network invalidate];
+}
+
+- (void)testCachedResultReturnPassedHandle {
+
+    PNConfiguration *configuration = [PNConfiguration configurationWithPublishKey:@"demo"
+                                                                     subscribeKey:@"demo"];
+    configuration.responseCacheTimeToLive = @{@(PNTimeOperation): @60};
+    PubNub *client = [PubNub clientWithConfiguration:configuration];
+    PNLoopbackTransport *transport = [PNLoopbackTransport transport];
+    [transport setResponseData:[@"[15000000000000000]" dataUsingEncoding:NSUTF8StringEncoding]
+                    statusCode:200 forPathPrefix:@"/time/0"];
+    PNNetwork *network = [PNNetwork networkForClient:client requestTimeout:10 maximumConnections:3
+                                            longPoll:NO transport:transport];
+
+    for (NSUInteger callIdx = 0; callIdx < 2; callIdx++) {
+
+        PNRequestParameters *parameters = [PNRequestParameters new];
+        parameters.handle = [PNRequestHandle handleWithTimeout:0];
+        XCTestExpectation *expectation = [self expectationWithDescription:@"Time"];
+        PNRequestHandle *handle = [network processOperation:PNTimeOperation withParameters:parameters data:nil
+                                            completionBlock:^(PNTimeResult *result, PNErrorStatus *status) {
+
+            XCTAssertNil(status, @"Unexpected error.");
+            [expectation fulfill];
+        }];
+        XCTAssertTrue(handle == parameters.handle, @"Passed handle should be returned.");
+        [self waitForExpectationsWithTimeout:5 handler:nil];
+    }
+
+    XCTAssertEqual(transport.requestsCount, 1, @"Repeated call should be served from cache.");
+    [network invalidate];
+}
+
+- (void)testServicePingNotServedFromCache {
+
+    PNConfiguration *configuration = [PNConfiguration configurationWithPublishKey:@"demo"
+                                                                     subscribeKey:@"demo"];
+    configuration.responseCacheTimeToLive = @{@(PNTimeOperation): @60};
+    PubNub *client = [PubNub clientWithConfiguration:configuration];
+    PNLoopbackTransport *transport = [PNLoopbackTransport transport];
+    [transport setResponseData:[@"[15000000000000000]" dataUsingEncoding:NSUTF8StringEncoding]
+                    statusCode:200 forPathPrefix:@"/time/0"];
+    PNNetwork *network = [PNNetwork networkForClient:client requestTimeout:10 maximumConnections:3
+                                            longPoll:NO transport:transport];
+    [client setValue:network forKey:@"serviceNetwork"];
+    XCTestExpectation *timeExpectation = [self expectationWithDescription:@"Time"];
+    [client timeWithCompletion:^(PNTimeResult *result, PNErrorStatus *status) {
+
+        XCTAssertNil(status, @"Unexpected error.");
+        [timeExpectation fulfill];
+    }];
+    [self waitForExpectationsWithTimeout:5 handler:nil];
+
+    // Device went offline after time token has been cached.
+    [transport removeAllResponses];
+    transport.responder = ^(NSURLRequest *request, PNLoopbackTransportRespondBlock respond) {
+        respond(0, nil, [NSError errorWithDomain:NSURLErrorDomain code:NSURLErrorNotConnectedToInternet
+                                        userInfo:nil]);
+    };
+    XCTestExpectation *pingExpectation = [self expectationWithDescription:@"Ping"];
+    __block __weak PNReachability *weakReachability = nil;
+    PNReachability *reachability = [PNReachability reachabilityForClient:client
+                                                          withPingStatus:^(BOOL pingSuccessful) {
+
+        [weakReachability stopServicePing];
+        XCTAssertFalse(pingSuccessful, @"Ping shouldn't use cached time token.");
+        [pingExpectation fulfill];
+    }];
+    weakReachability = reachability;
+    [reachability startServicePing];
+
+    [self waitForExpectationsWithTimeout:5 handler:nil];
+    XCTAssertEqual(transport.requestsCount, 2, @"Ping should be sent to network.");
+    XCTAssertEqualObjects([client metrics][@"cache.hits"], nil);
+    [network invalidate];
+}
+
+
+#pragma mark - Misc
+
+- (NSURL *)URLWithPath:(NSString *)path {
+
+    return [NSURL URLWithString:[@"https://ps.pndsn.com" stringByAppendingString:path]];
+}
+
+- (PNResult *)resultForOperation:(PNOperationType)operation {
+
+    return [PNResult objectForOperation:operation completedWithTask:nil processedData:@{@"value": @1}
+                        processingError:nil];
+}
+
+#pragma mark -
+
+
+@end
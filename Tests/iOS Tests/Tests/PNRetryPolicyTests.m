@@ -0,0 +1,127 @@
+#import <XCTest/XCTest.h>
+#import "PNRetryPolicy.h"
+
+
+#pragma mark Static
+
+/**
+ @brief  Number of clients which lose connection at same time in reconnection simulation.
+ */
+static NSUInteger const kPNRetryPolicyTestsClientsCount = 1000;
+
+/**
+ @brief  Number of failed reconnection attempts which each client perform in simulation.
+ */
+static NSUInteger const kPNRetryPolicyTestsAttemptsCount = 5;
+
+
+/**
+ @brief      PNRetryPolicy testing.
+ @discussion Verify delays bounds, retry budget and simulate reconnection of large number of clients after
+             service outage to ensure what attempts spread in time.
+
+ @author Sergey Mamontov
+ @copyright © 2009-2017 PubNub, Inc.
+ */
+@interface PNRetryPolicyTests : XCTestCase
+
+
+#pragma mark - Misc
+
+/**
+ @brief  Calculate biggest number of reconnection attempts which happened within same second.
+
+ @param reconnectDates List of dates (seconds since outage) at which clients tried to reconnect.
+
+ @return Maximum number of attempts in one second slot.
+ */
+- (NSUInteger)peakReconnectsCountFrom:(NSArray<NSNumber *> *)reconnectDates;
+
+#pragma mark -
+
+
+@end
+
+
+#pragma mark - Test case implementation
+
+@implementation PNRetryPolicyTests
+
+- (void)testDelaysStayWithinBounds {
+
+    PNRetryPolicy *policy = [PNRetryPolicy policyWithInitialDelay:1.f maximumDelay:8.f budget:0];
+
+    for (NSUInteger attemptIdx = 0; attemptIdx < 100; attemptIdx++) {
+
+        NSTimeInterval delay = [policy nextDelay];
+        XCTAssertGreaterThanOrEqual(delay, 1.f, @"Delay shorter than initial delay.");
+        XCTAssertLessThanOrEqual(delay, 8.f, @"Delay exceed maximum delay.");
+    }
+    XCTAssertEqual(policy.attempts, 100, @"Unexpected number of attempts.");
+}
+
+- (void)testBudgetLimitAttempts {
+
+    PNRetryPolicy *policy = [PNRetryPolicy policyWithInitialDelay:1.f maximumDelay:8.f budget:3];
+
+    for (NSUInteger attemptIdx = 0; attemptIdx < 3; attemptIdx++) {
+
+        XCTAssertTrue([policy canRetry], @"Budget exhausted too early.");
+        XCTAssertGreaterThan([policy nextDelay], 0.f, @"Unexpected delay.");
+    }
+    XCTAssertFalse([policy canRetry], @"Budget should be exhausted.");
+    XCTAssertLessThan([policy nextDelay], 0.f, @"Negative delay expected for exhausted budget.");
+
+    [policy reset];
+    XCTAssertTrue([policy canRetry], @"Budget should be restored after reset.");
+    XCTAssertEqual(policy.attempts, 0, @"Attempts counter should be reset.");
+}
+
+- (void)testReconnectsSpreadAfterOutage {
+
+    NSMutableArray<NSNumber *> *fixedReconnectDates = [NSMutableArray new];
+    NSMutableArray<NSNumber *> *reconnectDates = [NSMutableArray new];
+    for (NSUInteger clientIdx = 0; clientIdx < kPNRetryPolicyTestsClientsCount; clientIdx++) {
+
+        PNRetryPolicy *policy = [PNRetryPolicy policyWithInitialDelay:1.f maximumDelay:32.f budget:0];
+        NSTimeInterval fixedDate = 0.f;
+        NSTimeInterval date = 0.f;
+        for (NSUInteger attemptIdx = 0; attemptIdx < kPNRetryPolicyTestsAttemptsCount; attemptIdx++) {
+
+            fixedDate += 1.f;
+            date += [policy nextDelay];
+            [fixedReconnectDates addObject:@(fixedDate)];
+            [reconnectDates addObject:@(date)];
+        }
+    }
+
+    NSUInteger fixedPeak = [self peakReconnectsCountFrom:fixedReconnectDates];
+    NSUInteger peak = [self peakReconnectsCountFrom:reconnectDates];
+
+    XCTAssertEqual(fixedPeak, kPNRetryPolicyTestsClientsCount,
+                   @"All clients expected to reconnect in lock-step with fixed interval.");
+    // First delay randomly chosen between 1 and 3 seconds, so about 60% of clients still meet in same slot.
+    XCTAssertLessThan(peak, kPNRetryPolicyTestsClientsCount * 7 / 10,
+                      @"Reconnection attempts should be spread in time (peak: %@).", @(peak));
+    XCTAssertGreaterThan(peak, kPNRetryPolicyTestsClientsCount / 2,
+                         @"Unexpected reconnects distribution (peak: %@).", @(peak));
+}
+
+
+#pragma mark - Misc
+
+- (NSUInteger)peakReconnectsCountFrom:(NSArray<NSNumber *> *)reconnectDates {
+
+    NSCountedSet *slots = [NSCountedSet new];
+    for (NSNumber *date in reconnectDates) { [slots addObject:@((NSUInteger)date.doubleValue)]; }
+
+    NSUInteger peak = 0;
+    for (NSNumber *slot in slots) { peak = MAX(peak, [slots countForObject:slot]); }
+
+    return peak;
+}
+
+#pragma mark -
+
+
+@end
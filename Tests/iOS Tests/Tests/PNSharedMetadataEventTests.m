@@ -0,0 +1,132 @@
+#import <XCTest/XCTest.h>
+#import <objc/runtime.h>
+#import <PubNub/PubNub.h>
+#import "PNResult+Private.h"
+
+
+/**
+ @brief      Lightweight real-time event objects testing.
+ @discussion Verify that event objects which share response metadata with subscribe status report same
+             request and response information as event objects which has been built with full metadata copy.
+
+ @author Sergey Mamontov
+ @copyright © 2009-2017 PubNub, Inc.
+ */
+@interface PNSharedMetadataEventTests : XCTestCase
+
+
+#pragma mark - Properties
+
+/**
+ @brief  Stores reference on subscribe status which has been created for service response.
+ */
+@property (nonatomic, strong) PNSubscribeStatus *status;
+
+/**
+ @brief  Stores reference on real-time event data which has been received with service response.
+ */
+@property (nonatomic, strong) NSDictionary *event;
+
+
+#pragma mark - Misc
+
+/**
+ @brief  Verify that \c result report same request and response information as \c expectedResult.
+
+ @param result         Reference on result object which should be verified.
+ @param expectedResult Reference on result object with expected information.
+ */
+- (void)assertResult:(PNResult *)result hasSameMetadataAs:(PNResult *)expectedResult;
+
+#pragma mark -
+
+
+@end
+
+
+#pragma mark - Test case implementation
+
+@implementation PNSharedMetadataEventTests
+
+- (void)setUp {
+
+    // Forward method call to the super class.
+    [super setUp];
+
+
+    // Prepare 'fixtures'
+    NSURL *url = [NSURL URLWithString:@"https://ps.pndsn.com/v2/subscribe/demo/a/0?tt=0"];
+    self.status = [PNSubscribeStatus objectForOperation:PNSubscribeOperation completedWithTask:nil
+                                          processedData:@{@"status": @202} processingError:nil];
+    [self.status setValue:@"tester" forKey:@"uuid"];
+    [self.status setValue:@"secret" forKey:@"authKey"];
+    [self.status setValue:@"ps.pndsn.com" forKey:@"origin"];
+    [self.status setValue:@YES forKey:@"TLSEnabled"];
+    [self.status setValue:[NSURLRequest requestWithURL:url] forKey:@"clientRequest"];
+    self.event = @{@"channel": @"a", @"message": @{@"text": @"Hello"}, @"timetoken": @15000000000000000};
+}
+
+- (void)testSharedMetadataEventSameAsFullyBuiltEvent {
+
+    PNResult *fullyBuiltMessage = [self.status copyWithMutatedData:self.event];
+    object_setClass(fullyBuiltMessage, [PNMessageResult class]);
+    PNMessageResult *message = [PNMessageResult objectWithServiceData:self.event sharingMetadataWith:self.status];
+
+    XCTAssertEqual(message.statusCode, 202);
+    XCTAssertEqual(message.operation, PNSubscribeOperation);
+    [self assertResult:message hasSameMetadataAs:fullyBuiltMessage];
+    XCTAssertEqualObjects(message.data.channel, ((PNMessageResult *)fullyBuiltMessage).data.channel);
+    XCTAssertEqualObjects(message.data.message, ((PNMessageResult *)fullyBuiltMessage).data.message);
+}
+
+- (void)testSharedMetadataPresenceEventSameAsStatus {
+
+    NSDictionary *event = @{@"channel": @"a", @"presenceEvent": @"join",
+                            @"presence": @{@"uuid": @"tester", @"occupancy": @1}};
+    PNPresenceEventResult *presenceEvent = [PNPresenceEventResult objectWithServiceData:event
+                                                                    sharingMetadataWith:self.status];
+
+    [self assertResult:presenceEvent hasSameMetadataAs:self.status];
+    XCTAssertEqualObjects(presenceEvent.data.presenceEvent, @"join");
+}
+
+- (void)testCopyKeepsSharedMetadata {
+
+    PNMessageResult *message = [PNMessageResult objectWithServiceData:self.event sharingMetadataWith:self.status];
+    PNMessageResult *messageCopy = [message copy];
+    PNResult *mutatedCopy = [message copyWithMutatedData:@{@"information": @"test"}];
+
+    [self assertResult:messageCopy hasSameMetadataAs:self.status];
+    XCTAssertEqualObjects(messageCopy.data.message, message.data.message);
+    [self assertResult:mutatedCopy hasSameMetadataAs:self.status];
+}
+
+- (void)testEventSharingMetadataWithEventUseOriginalMetadata {
+
+    PNMessageResult *message = [PNMessageResult objectWithServiceData:self.event sharingMetadataWith:self.status];
+    PNMessageResult *nextMessage = [PNMessageResult objectWithServiceData:self.event sharingMetadataWith:message];
+
+    XCTAssertTrue([nextMessage valueForKey:@"metadata"] == self.status,
+                  @"Metadata should be shared with original status.");
+    [self assertResult:nextMessage hasSameMetadataAs:self.status];
+}
+
+
+#pragma mark - Misc
+
+- (void)assertResult:(PNResult *)result hasSameMetadataAs:(PNResult *)expectedResult {
+
+    XCTAssertEqual(result.statusCode, expectedResult.statusCode);
+    XCTAssertEqual(result.operation, expectedResult.operation);
+    XCTAssertEqualObjects(result.stringifiedOperation, expectedResult.stringifiedOperation);
+    XCTAssertEqual(result.isTLSEnabled, expectedResult.isTLSEnabled);
+    XCTAssertEqualObjects(result.uuid, expectedResult.uuid);
+    XCTAssertEqualObjects(result.authKey, expectedResult.authKey);
+    XCTAssertEqualObjects(result.origin, expectedResult.origin);
+    XCTAssertEqualObjects(result.clientRequest.URL, expectedResult.clientRequest.URL);
+}
+
+#pragma mark -
+
+
+@end
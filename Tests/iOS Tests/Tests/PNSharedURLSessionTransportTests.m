@@ -0,0 +1,163 @@
+#import <XCTest/XCTest.h>
+#import "PNSharedURLSessionTransport.h"
+#import "PNURLSessionTransport.h"
+
+
+#pragma mark Static
+
+/**
+ @brief  Number of transports which is created by single measurement (emulate clients hosted by one process).
+ */
+static NSUInteger const kPNSharedURLSessionTransportTestsClientsCount = 1000;
+
+
+/**
+ @brief      PNSharedURLSessionTransport testing.
+ @discussion Verify that transports share process-wide session, track only own tasks and compare cost of
+             long-poll transport set up for many clients with shared and separate sessions.
+
+ @author Sergey Mamontov
+ @copyright © 2009-2017 PubNub, Inc.
+ */
+@interface PNSharedURLSessionTransportTests : XCTestCase
+
+
+#pragma mark - Misc
+
+/**
+ @brief  Construct subscribe request which won't reach any server.
+
+ @return Configured request.
+ */
+- (NSURLRequest *)subscribeRequest;
+
+#pragma mark -
+
+
+@end
+
+
+#pragma mark - Test case implementation
+
+@implementation PNSharedURLSessionTransportTests
+
+- (void)testTransportsShareSession {
+
+    PNSharedURLSessionTransport *first = [PNSharedURLSessionTransport transportForLongPollRequests:YES
+                                                                                    requestTimeout:310];
+    PNSharedURLSessionTransport *second = [PNSharedURLSessionTransport transportForLongPollRequests:YES
+                                                                                     requestTimeout:310];
+    PNSharedURLSessionTransport *service = [PNSharedURLSessionTransport transportForLongPollRequests:NO
+                                                                                      requestTimeout:10];
+
+    XCTAssertTrue(first.session == second.session, @"Long-poll transports should share session.");
+    XCTAssertFalse(first.session == service.session, @"Long-poll and service sessions should be different.");
+
+    [first invalidate];
+    [second invalidate];
+    [service invalidate];
+}
+
+- (void)testPrepareRequestApplyTransportTimeout {
+
+    PNSharedURLSessionTransport *transport = [PNSharedURLSessionTransport transportForLongPollRequests:NO
+                                                                                        requestTimeout:7];
+    NSMutableURLRequest *request = [[self subscribeRequest] mutableCopy];
+    [transport prepareRequest:request];
+
+    XCTAssertEqual(request.timeoutInterval, 7, @"Transport timeout should be applied to request.");
+    [transport invalidate];
+}
+
+- (void)testInvalidationCancelOnlyOwnTasks {
+
+    PNSharedURLSessionTransport *first = [PNSharedURLSessionTransport transportForLongPollRequests:YES
+                                                                                    requestTimeout:310];
+    PNSharedURLSessionTransport *second = [PNSharedURLSessionTransport transportForLongPollRequests:YES
+                                                                                     requestTimeout:310];
+    NSURLSessionDataTask *firstTask = (NSURLSessionDataTask *)[first taskWithRequest:[self subscribeRequest]
+                                                                          completion:^(NSData *data,
+                                                                                       NSURLResponse *response,
+                                                                                       NSError *error) {}];
+    NSURLSessionDataTask *secondTask = (NSURLSessionDataTask *)[second taskWithRequest:[self subscribeRequest]
+                                                                            completion:^(NSData *data,
+                                                                                         NSURLResponse *response,
+                                                                                         NSError *error) {}];
+    [first invalidate];
+
+    XCTAssertNil(first.session, @"Invalidated transport shouldn't use session.");
+    XCTAssertNotEqual(firstTask.state, NSURLSessionTaskStateSuspended, @"Own task should be cancelled.");
+    XCTAssertEqual(secondTask.state, NSURLSessionTaskStateSuspended, @"Other client's task shouldn't change.");
+
+    XCTestExpectation *expectation = [self expectationWithDescription:@"Tasks list"];
+    [second getTasksWithCompletion:^(NSArray<id <PNTransportTask>> *tasks) {
+
+        XCTAssertEqual(tasks.count, 1, @"Transport should report only own tasks.");
+        XCTAssertTrue(tasks.firstObject == secondTask, @"Unexpected task.");
+        [expectation fulfill];
+    }];
+    [self waitForExpectationsWithTimeout:5 handler:nil];
+    [second invalidate];
+}
+
+- (void)testSessionRecreatedAfterLastTransportInvalidation {
+
+    PNSharedURLSessionTransport *transport = [PNSharedURLSessionTransport transportForLongPollRequests:YES
+                                                                                        requestTimeout:310];
+    NSURLSession *session = transport.session;
+    [transport invalidate];
+    transport = [PNSharedURLSessionTransport transportForLongPollRequests:YES requestTimeout:310];
+
+    XCTAssertFalse(transport.session == session, @"Invalidated shared session shouldn't be reused.");
+    [transport invalidate];
+}
+
+- (void)testSeparateSessionsSetUpPerformance {
+
+    [self measureBlock:^{
+
+        NSMutableArray<PNURLSessionTransport *> *transports = [NSMutableArray new];
+        for (NSUInteger clientIdx = 0; clientIdx < kPNSharedURLSessionTransportTestsClientsCount; clientIdx++) {
+
+            NSOperationQueue *queue = [NSOperationQueue new];
+            NSURLSessionConfiguration *configuration = [NSURLSessionConfiguration ephemeralSessionConfiguration];
+            PNURLSessionTransport *transport = [PNURLSessionTransport transportWithConfiguration:configuration
+                                                                                        delegate:nil
+                                                                                   delegateQueue:queue];
+            [transport taskWithRequest:[self subscribeRequest] completion:^(NSData *data, NSURLResponse *response,
+                                                                            NSError *error) {}];
+            [transports addObject:transport];
+        }
+        [transports makeObjectsPerformSelector:@selector(invalidate)];
+    }];
+}
+
+- (void)testSharedSessionSetUpPerformance {
+
+    [self measureBlock:^{
+
+        NSMutableArray<PNSharedURLSessionTransport *> *transports = [NSMutableArray new];
+        for (NSUInteger clientIdx = 0; clientIdx < kPNSharedURLSessionTransportTestsClientsCount; clientIdx++) {
+
+            PNSharedURLSessionTransport *transport = nil;
+            transport = [PNSharedURLSessionTransport transportForLongPollRequests:YES requestTimeout:310];
+            [transport taskWithRequest:[self subscribeRequest] completion:^(NSData *data, NSURLResponse *response,
+                                                                            NSError *error) {}];
+            [transports addObject:transport];
+        }
+        [transports makeObjectsPerformSelector:@selector(invalidate)];
+    }];
+}
+
+
+#pragma mark - Misc
+
+- (NSURLRequest *)subscribeRequest {
+
+    return [NSURLRequest requestWithURL:[NSURL URLWithString:@"http://127.0.0.1:9/v2/subscribe/demo/a/0"]];
+}
+
+#pragma mark -
+
+
+@end
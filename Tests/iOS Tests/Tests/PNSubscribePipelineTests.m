@@ -0,0 +1,197 @@
+#import "PNLoopbackClientTestCase.h"
+#import "PubNub+CorePrivate.h"
+#import "PNLoopbackTransport.h"
+#import "PNStateListener.h"
+#import "PNSubscriber.h"
+
+
+#pragma mark Static
+
+/**
+ @brief  Time token which is returned by service in response on initial subscribe request.
+ */
+static long long const kPNSubscribePipelineTestsTimeToken = 15000000000000000;
+
+
+/**
+ @brief      Pipelined subscribe requests testing.
+ @discussion Verify that events from pipelined long-poll cycles delivered in order they has been received and
+             that next long-poll request held when too many event batches wait for delivery.
+
+ @author Sergey Mamontov
+ @copyright © 2009-2017 PubNub, Inc.
+ */
+@interface PNSubscribePipelineTests : PNLoopbackClientTestCase
+
+
+#pragma mark - Properties
+
+/**
+ @brief  Stores list of sequence numbers from messages in order in which they has been delivered to listener.
+ */
+@property (nonatomic, strong) NSMutableArray<NSNumber *> *receivedSequenceNumbers;
+
+/**
+ @brief  Stores reference on block which is called by listener for each received message.
+ */
+@property (atomic, nullable, copy) void(^messageHandler)(PNMessageResult *message);
+
+
+#pragma mark - Misc
+
+/**
+ @brief  Compose subscribe response body for request with specified time token.
+ @discussion Each non-initial response contain single message with sequence number which is equal to number
+             of long-poll cycle.
+
+ @param request Reference on subscribe request for which response should be created.
+
+ @return Response body.
+ */
+- (NSData *)responseForRequest:(NSURLRequest *)request;
+
+#pragma mark -
+
+
+@end
+
+
+#pragma mark - Test case implementation
+
+@implementation PNSubscribePipelineTests
+
+- (void)setUp {
+
+    // Forward method call to the super class.
+    [super setUp];
+
+
+    // Prepare 'fixtures'
+    PNConfiguration *configuration = [PNConfiguration configurationWithPublishKey:@"demo"
+                                                                     subscribeKey:@"demo"];
+    configuration.pipelineSubscribeRequests = YES;
+    self.receivedSequenceNumbers = [NSMutableArray new];
+    [self createClientWithConfiguration:configuration];
+    [self useLoopbackTransportWithMaximumSubscribeConnections:1];
+}
+
+- (void)tearDown {
+
+    self.messageHandler = nil;
+
+    // Forward method call to the super class.
+    [super tearDown];
+}
+
+- (void)testPipelinedEventsDeliveredInOrder {
+
+    NSUInteger cyclesCount = 5;
+    dispatch_semaphore_t requestsSemaphore = dispatch_semaphore_create(0);
+    __weak __typeof(self) weakSelf = self;
+    self.transport.responder = ^(NSURLRequest *request, PNLoopbackTransportRespondBlock respond) {
+
+        // Stop subscription loop after specified number of cycles.
+        NSUInteger requestsCount = weakSelf.transport.requestsCount;
+        if (requestsCount <= cyclesCount + 1) { respond(200, [weakSelf responseForRequest:request], nil); }
+        if (requestsCount == 4) { dispatch_semaphore_signal(requestsSemaphore); }
+    };
+    __block BOOL requestsSentWhileListenerBusy = NO;
+    self.messageHandler = ^(PNMessageResult *message) {
+
+        // Listener hold first message till two more long-poll requests will be sent.
+        if (weakSelf.receivedSequenceNumbers.count == 1) {
+
+            dispatch_time_t timeout = dispatch_time(DISPATCH_TIME_NOW, (int64_t)(5 * NSEC_PER_SEC));
+            requestsSentWhileListenerBusy = (dispatch_semaphore_wait(requestsSemaphore, timeout) == 0);
+        }
+    };
+    [self.client subscribeToChannels:@[@"a"] withPresence:NO];
+
+    XCTAssertTrue([self waitFor:5 condition:^BOOL{
+        @synchronized (self.receivedSequenceNumbers) { return self.receivedSequenceNumbers.count == cyclesCount; }
+    }]);
+    XCTAssertEqualObjects(self.receivedSequenceNumbers, (@[@1, @2, @3, @4, @5]),
+                          @"Messages from pipelined cycles should be delivered in order.");
+    XCTAssertTrue(requestsSentWhileListenerBusy,
+                  @"Next long-poll requests should be sent while listener process events.");
+}
+
+- (void)testNextCycleHeldWhenTooManyBatchesPending {
+
+    __weak __typeof(self) weakSelf = self;
+    self.transport.responder = ^(NSURLRequest *request, PNLoopbackTransportRespondBlock respond) {
+
+        respond(200, [weakSelf responseForRequest:request], nil);
+    };
+    dispatch_semaphore_t semaphore = dispatch_semaphore_create(0);
+    // Block listeners notification, so received batches can't be delivered.
+    [self.client.listenersManager notifyWithBlock:^{
+        dispatch_semaphore_wait(semaphore, DISPATCH_TIME_FOREVER);
+    }];
+    [self.client subscribeToChannels:@[@"a"] withPresence:NO];
+
+    // Subscriber defer next cycle right after last allowed batch has been placed into pipeline.
+    NSUInteger maximumPendingBatches = [PNSubscriber maximumPendingEventBatches];
+    PNSubscriber *subscriber = self.client.subscriberManager;
+    XCTAssertTrue([self waitFor:5 condition:^BOOL{
+        return ((NSNumber *)[subscriber valueForKey:@"subscriptionCycleDeferred"]).boolValue;
+    }]);
+
+    // Initial subscribe request and one request for each of pending batches.
+    NSUInteger expectedRequestsCount = maximumPendingBatches + 1;
+    XCTAssertEqual(self.transport.requestsCount, expectedRequestsCount,
+                   @"Next long-poll request should be held while batches wait for delivery.");
+
+    self.transport.responder = ^(NSURLRequest *request, PNLoopbackTransportRespondBlock respond) {};
+    dispatch_semaphore_signal(semaphore);
+    XCTAssertTrue([self waitFor:5 condition:^BOOL{
+        return self.transport.requestsCount > expectedRequestsCount;
+    }], @"Subscription loop should continue after batches delivery.");
+    XCTAssertTrue([self waitFor:5 condition:^BOOL{
+        @synchronized (self.receivedSequenceNumbers) {
+            return self.receivedSequenceNumbers.count == maximumPendingBatches;
+        }
+    }]);
+    XCTAssertEqualObjects(self.receivedSequenceNumbers.lastObject, @(maximumPendingBatches));
+}
+
+
+#pragma mark - Listener
+
+- (void)client:(PubNub *)client didReceiveMessage:(PNMessageResult *)message {
+
+    @synchronized (self.receivedSequenceNumbers) {
+        [self.receivedSequenceNumbers addObject:((NSDictionary *)message.data.message)[@"seq"]];
+    }
+    if (self.messageHandler) { self.messageHandler(message); }
+}
+
+
+#pragma mark - Misc
+
+- (NSData *)responseForRequest:(NSURLRequest *)request {
+
+    NSURLComponents *components = [NSURLComponents componentsWithURL:request.URL resolvingAgainstBaseURL:NO];
+    long long timeToken = 0;
+    for (NSURLQueryItem *item in components.queryItems) {
+        if ([item.name isEqualToString:@"tt"]) { timeToken = item.value.longLongValue; }
+    }
+    long long nextTimeToken = (timeToken == 0 ? kPNSubscribePipelineTestsTimeToken : timeToken + 1);
+    NSMutableArray *events = [NSMutableArray new];
+    if (timeToken != 0) {
+
+        [events addObject:@{
+            @"a": @"3", @"f": @0, @"i": @"tester", @"c": @"a", @"k": @"demo",
+            @"p": @{@"t": @(nextTimeToken).stringValue, @"r": @4},
+            @"d": @{@"seq": @(nextTimeToken - kPNSubscribePipelineTestsTimeToken)}
+        }];
+    }
+    NSDictionary *response = @{@"t": @{@"t": @(nextTimeToken).stringValue, @"r": @4}, @"m": events};
+
+    return [NSJSONSerialization dataWithJSONObject:response options:(NSJSONWritingOptions)0 error:NULL];
+}
+
+#pragma mark -
+
+
+@end
@@ -0,0 +1,160 @@
+#import <XCTest/XCTest.h>
+#import <PubNub/PubNub.h>
+#import "PubNub+CorePrivate.h"
+#import "PNRequestParameters.h"
+#import "PNClientState.h"
+#import "PNSubscriber.h"
+
+
+#pragma mark Private interface declaration
+
+/**
+ @brief  Subscriber methods which is used by tests to compose subscribe request parameters.
+ */
+@interface PNSubscriber (PNSubscribeRequestComponentsTests)
+
+- (PNRequestParameters *)subscribeRequestParametersWithState:(nullable NSDictionary<NSString *, id> *)state;
+
+@end
+
+
+/**
+ @brief      Subscribe request components cache testing.
+ @discussion Verify that percent-encoded subscribe request components re-used while subscription objects list
+             and client state not changed and composed again when any of them change.
+
+ @author Sergey Mamontov
+ @copyright © 2009-2017 PubNub, Inc.
+ */
+@interface PNSubscribeRequestComponentsTests : XCTestCase
+
+
+#pragma mark - Properties
+
+/**
+ @brief  Stores reference on client which is used by tests.
+ */
+@property (nonatomic, strong) PubNub *client;
+
+/**
+ @brief  Stores reference on client's subscriber which compose subscribe request parameters.
+ */
+@property (nonatomic, strong) PNSubscriber *subscriber;
+
+
+#pragma mark - Misc
+
+/**
+ @brief  Retrieve subscribe request components which has been stored by subscriber for re-use.
+
+ @return Stored components or \c nil in case if nothing has been stored.
+ */
+- (NSDictionary *)storedComponents;
+
+#pragma mark -
+
+
+@end
+
+
+#pragma mark - Test case implementation
+
+@implementation PNSubscribeRequestComponentsTests
+
+- (void)setUp {
+
+    // Forward method call to the super class.
+    [super setUp];
+
+
+    // Prepare 'fixtures'
+    PNConfiguration *configuration = [PNConfiguration configurationWithPublishKey:@"demo"
+                                                                     subscribeKey:@"demo"];
+    self.client = [PubNub clientWithConfiguration:configuration];
+    self.subscriber = self.client.subscriberManager;
+    [self.subscriber addChannels:@[@"a"]];
+}
+
+- (void)testComponentsReusedWhileObjectsListAndStateNotChanged {
+
+    PNRequestParameters *parameters = [self.subscriber subscribeRequestParametersWithState:nil];
+    NSDictionary *components = [self storedComponents];
+    PNRequestParameters *nextParameters = [self.subscriber subscribeRequestParametersWithState:nil];
+
+    XCTAssertNotNil(components, @"Composed components should be stored for re-use.");
+    XCTAssertTrue([self storedComponents] == components, @"Stored components should be re-used.");
+    XCTAssertEqualObjects(nextParameters.pathComponents, parameters.pathComponents);
+}
+
+- (void)testComponentsComposedWhenObjectsListChange {
+
+    [self.subscriber subscribeRequestParametersWithState:nil];
+    NSDictionary *components = [self storedComponents];
+    [self.subscriber addChannels:@[@"b"]];
+    PNRequestParameters *parameters = [self.subscriber subscribeRequestParametersWithState:nil];
+
+    XCTAssertFalse([self storedComponents] == components, @"Components should be composed again.");
+    XCTAssertTrue([parameters.pathComponents[@"{channels}"] rangeOfString:@"b"].location != NSNotFound,
+                  @"Components should include new channel.");
+}
+
+- (void)testComponentsComposedWhenStateChange {
+
+    PNRequestParameters *parameters = [self.subscriber subscribeRequestParametersWithState:nil];
+    NSDictionary *components = [self storedComponents];
+    [self.client.clientStateManager setState:@{@"key": @"value"} forObject:@"a"];
+    PNRequestParameters *nextParameters = [self.subscriber subscribeRequestParametersWithState:nil];
+
+    XCTAssertNil(parameters.query[@"state"]);
+    XCTAssertFalse([self storedComponents] == components, @"Components should be composed again.");
+    XCTAssertTrue([nextParameters.query[@"state"] rangeOfString:@"key"].location != NSNotFound,
+                  @"Components should include new client state.");
+}
+
+- (void)testComponentsWithExplicitStateNotStored {
+
+    [self.subscriber subscribeRequestParametersWithState:nil];
+    NSDictionary *components = [self storedComponents];
+    PNRequestParameters *parameters = [self.subscriber subscribeRequestParametersWithState:@{
+        @"a": @{@"key": @"value"}
+    }];
+
+    XCTAssertTrue([parameters.query[@"state"] rangeOfString:@"key"].location != NSNotFound);
+    XCTAssertTrue([self storedComponents] == components,
+                  @"Components with explicitly passed state shouldn't be stored.");
+
+    PNRequestParameters *nextParameters = [self.subscriber subscribeRequestParametersWithState:nil];
+    XCTAssertEqualObjects(nextParameters.query[@"state"], parameters.query[@"state"],
+                          @"Explicitly passed state should be merged into client state.");
+    XCTAssertFalse([self storedComponents] == components, @"Components should be composed again.");
+}
+
+- (void)testMergedStateReturnedWithItsVersion {
+
+    NSUInteger version = 0;
+    NSDictionary *state = [self.client.clientStateManager mergeWithState:@{@"a": @{@"key": @"value"}}
+                                                               forObjects:@[@"a"] version:&version];
+
+    XCTAssertEqualObjects(state, (@{@"a": @{@"key": @"value"}}));
+    XCTAssertEqual(version, self.client.clientStateManager.version);
+
+    NSUInteger sameVersion = 0;
+    [self.client.clientStateManager mergeWithState:nil forObjects:@[@"a"] version:&sameVersion];
+    XCTAssertEqual(sameVersion, version, @"Version shouldn't change if state not changed.");
+
+    [self.client.clientStateManager setState:@{@"key": @"another value"} forObject:@"a"];
+    XCTAssertGreaterThan(self.client.clientStateManager.version, version);
+}
+
+
+#pragma mark - Misc
+
+- (NSDictionary *)storedComponents {
+
+    return [self.subscriber valueForKey:@"subscribeRequestComponents"];
+}
+
+#pragma mark -
+
+
+@end
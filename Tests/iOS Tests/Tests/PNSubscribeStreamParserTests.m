@@ -0,0 +1,231 @@
+#import <XCTest/XCTest.h>
+#import <PubNub/PubNub.h>
+#import "PNSubscribeStreamParser.h"
+#import "PNLoopbackTransport.h"
+#import "PNRequestParameters.h"
+#import "PNSubscribeParser.h"
+#import "PNResult+Private.h"
+#import "PNNetwork.h"
+
+
+#pragma mark Static
+
+/**
+ @brief  Number of events in catch up response which is used for performance measurement.
+ */
+static NSUInteger const kPNSubscribeStreamParserTestsEventsCount = 10000;
+
+/**
+ @brief  Size of response body portions which is passed to parser during performance measurement.
+ */
+static NSUInteger const kPNSubscribeStreamParserTestsChunkSize = 16384;
+
+
+/**
+ @brief      PNSubscribeStreamParser testing.
+ @discussion Verify that incremental parser provide same result as parser for complete response regardless
+             of response body split, handle malformed and oversized responses and compare incremental and
+             complete response parsing cost for big catch up response.
+
+ @author Sergey Mamontov
+ @copyright © 2009-2017 PubNub, Inc.
+ */
+@interface PNSubscribeStreamParserTests : XCTestCase
+
+
+#pragma mark - Misc
+
+/**
+ @brief  Compose subscribe response body.
+
+ @param count Number of events which should be added to response.
+
+ @return Response body.
+ */
+- (NSData *)responseWithEventsCount:(NSUInteger)count;
+
+/**
+ @brief  Parse response body with incremental parser.
+
+ @param data      Reference on response body.
+ @param chunkSize Size of portions in which response body should be passed to parser.
+ @param parser    Reference on parser which should be used.
+
+ @return Parsed service response.
+ */
+- (NSDictionary *)parseData:(NSData *)data inChunksOfSize:(NSUInteger)chunkSize
+                 withParser:(PNSubscribeStreamParser *)parser;
+
+/**
+ @brief  Construct parser with default buffer size.
+
+ @return Configured and ready to use parser.
+ */
+- (PNSubscribeStreamParser *)parser;
+
+#pragma mark -
+
+
+@end
+
+
+#pragma mark - Test case implementation
+
+@implementation PNSubscribeStreamParserTests
+
+- (void)testResultMatchCompleteResponseParsing {
+
+    NSData *response = [self responseWithEventsCount:10];
+    id serializedResponse = [NSJSONSerialization JSONObjectWithData:response options:(NSJSONReadingOptions)0
+                                                              error:NULL];
+    NSDictionary *expected = [PNSubscribeParser parsedServiceResponse:serializedResponse withData:nil];
+
+    for (NSUInteger chunkSize = 1; chunkSize <= response.length; chunkSize += 37) {
+
+        NSDictionary *parsed = [self parseData:response inChunksOfSize:chunkSize withParser:[self parser]];
+        XCTAssertEqualObjects(parsed[@"timetoken"], expected[@"timetoken"], @"Unexpected time token.");
+        XCTAssertEqualObjects(parsed[@"region"], expected[@"region"], @"Unexpected region.");
+        XCTAssertEqual(((NSArray *)parsed[@"events"]).count, 10, @"Unexpected number of events.");
+        for (NSUInteger eventIdx = 0; eventIdx < 10; eventIdx++) {
+
+            NSDictionary *event = parsed[@"events"][eventIdx];
+            NSDictionary *expectedEvent = expected[@"events"][eventIdx];
+            XCTAssertEqualObjects(event[@"message"], expectedEvent[@"message"], @"Unexpected message.");
+            XCTAssertEqualObjects(event[@"channel"], expectedEvent[@"channel"], @"Unexpected channel.");
+            XCTAssertEqualObjects(event[@"timetoken"], expectedEvent[@"timetoken"], @"Unexpected time token.");
+        }
+    }
+}
+
+- (void)testEventsParsedBeforeResponseCompletion {
+
+    NSData *response = [self responseWithEventsCount:3];
+    PNSubscribeStreamParser *parser = [self parser];
+
+    XCTAssertTrue([parser appendData:[response subdataWithRange:NSMakeRange(0, response.length - 1)]]);
+    XCTAssertEqual(parser.eventsCount, 3, @"All events should be parsed before response completion.");
+    XCTAssertTrue([parser appendData:[response subdataWithRange:NSMakeRange(response.length - 1, 1)]]);
+    XCTAssertNotNil([parser finish], @"Complete response should be parsed.");
+}
+
+- (void)testEmptyEventsList {
+
+    NSData *response = [@"{\"t\":{\"t\":\"15000000000000000\",\"r\":4},\"m\":[]}"
+                        dataUsingEncoding:NSUTF8StringEncoding];
+    NSDictionary *parsed = [self parseData:response inChunksOfSize:5 withParser:[self parser]];
+
+    XCTAssertEqualObjects(parsed[@"timetoken"], @(15000000000000000), @"Unexpected time token.");
+    XCTAssertEqualObjects(parsed[@"region"], @4, @"Unexpected region.");
+    XCTAssertEqual(((NSArray *)parsed[@"events"]).count, 0, @"Unexpected number of events.");
+}
+
+- (void)testIncompleteResponse {
+
+    NSData *response = [self responseWithEventsCount:3];
+    PNSubscribeStreamParser *parser = [self parser];
+    [parser appendData:[response subdataWithRange:NSMakeRange(0, response.length / 2)]];
+
+    XCTAssertNil([parser finish], @"Incomplete response shouldn't be parsed.");
+    XCTAssertEqual(parser.error.code, NSURLErrorCannotParseResponse, @"Unexpected error.");
+}
+
+- (void)testEventExceedBufferSize {
+
+    NSData *response = [self responseWithEventsCount:3];
+    PNSubscribeStreamParser *parser = [PNSubscribeStreamParser parserWithAdditionalData:nil maximumBufferSize:32];
+
+    XCTAssertFalse([parser appendData:response], @"Oversized event should be rejected.");
+    XCTAssertNil([parser finish], @"Response with oversized event shouldn't be parsed.");
+}
+
+- (void)testStreamedResponseDeliveredThroughNetwork {
+
+    PNConfiguration *configuration = [PNConfiguration configurationWithPublishKey:@"demo"
+                                                                     subscribeKey:@"demo"];
+    configuration.streamSubscribeResponses = YES;
+    PubNub *client = [PubNub clientWithConfiguration:configuration];
+    PNLoopbackTransport *transport = [PNLoopbackTransport transport];
+    transport.streamChunkSize = 7;
+    [transport setResponseData:[self responseWithEventsCount:5] statusCode:200
+                 forPathPrefix:@"/v2/subscribe"];
+    PNNetwork *network = [PNNetwork networkForClient:client requestTimeout:10 maximumConnections:1
+                                            longPoll:YES transport:transport];
+    PNRequestParameters *parameters = [PNRequestParameters new];
+    [parameters addPathComponent:@"a" forPlaceholder:@"{channels}"];
+    XCTestExpectation *expectation = [self expectationWithDescription:@"Subscribe"];
+
+    [network processOperation:PNSubscribeOperation withParameters:parameters data:nil
+              completionBlock:^(PNSubscribeStatus *status) {
+
+        XCTAssertFalse(status.isError, @"Streamed response shouldn't be treated as error.");
+        XCTAssertEqualObjects(status.data.timetoken, @(15000000000000000), @"Unexpected time token.");
+        XCTAssertEqual(((NSArray *)status.serviceData[@"events"]).count, 5, @"Unexpected number of events.");
+        [expectation fulfill];
+    }];
+
+    [self waitForExpectationsWithTimeout:5 handler:nil];
+    [network invalidate];
+}
+
+- (void)testCompleteResponseParsingPerformance {
+
+    NSData *response = [self responseWithEventsCount:kPNSubscribeStreamParserTestsEventsCount];
+    [self measureBlock:^{
+
+        id serializedResponse = [NSJSONSerialization JSONObjectWithData:response options:(NSJSONReadingOptions)0
+                                                                  error:NULL];
+        XCTAssertNotNil([PNSubscribeParser parsedServiceResponse:serializedResponse withData:nil]);
+    }];
+}
+
+- (void)testIncrementalResponseParsingPerformance {
+
+    NSData *response = [self responseWithEventsCount:kPNSubscribeStreamParserTestsEventsCount];
+    [self measureBlock:^{
+
+        XCTAssertNotNil([self parseData:response inChunksOfSize:kPNSubscribeStreamParserTestsChunkSize
+                             withParser:[self parser]]);
+    }];
+}
+
+
+#pragma mark - Misc
+
+- (NSData *)responseWithEventsCount:(NSUInteger)count {
+
+    NSMutableArray *events = [NSMutableArray new];
+    for (NSUInteger eventIdx = 0; eventIdx < count; eventIdx++) {
+
+        [events addObject:@{
+            @"a": @"3", @"f": @0, @"i": @"tester", @"s": @(eventIdx), @"c": @"a", @"k": @"demo",
+            @"p": @{@"t": [@(15000000000000000 + eventIdx) stringValue], @"r": @4},
+            @"d": @{@"text": [NSString stringWithFormat:@"Hello \"%@\" {[,]}\\", @(eventIdx)],
+                    @"list": @[@1, @2, @{@"nested": @YES}]}
+        }];
+    }
+    NSDictionary *response = @{@"t": @{@"t": @"15000000000000000", @"r": @4}, @"m": events};
+
+    return [NSJSONSerialization dataWithJSONObject:response options:(NSJSONWritingOptions)0 error:NULL];
+}
+
+- (NSDictionary *)parseData:(NSData *)data inChunksOfSize:(NSUInteger)chunkSize
+                 withParser:(PNSubscribeStreamParser *)parser {
+
+    for (NSUInteger offset = 0; offset < data.length; offset += chunkSize) {
+
+        NSRange range = NSMakeRange(offset, MIN(chunkSize, data.length - offset));
+        if (![parser appendData:[data subdataWithRange:range]]) { break; }
+    }
+
+    return [parser finish];
+}
+
+- (PNSubscribeStreamParser *)parser {
+
+    return [PNSubscribeStreamParser parserWithAdditionalData:nil maximumBufferSize:(1024 * 1024)];
+}
+
+#pragma mark -
+
+
+@end
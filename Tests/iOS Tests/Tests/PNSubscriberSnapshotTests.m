@@ -0,0 +1,204 @@
+#import <XCTest/XCTest.h>
+#import <os/lock.h>
+#import "PNSubscriberSnapshot.h"
+
+
+#pragma mark Static
+
+/**
+ @brief  Number of subscription information reads performed by single measurement.
+ */
+static NSUInteger const kPNSubscriberSnapshotTestsReadsCount = 100000;
+
+
+/**
+ @brief      PNSubscriberSnapshot testing.
+ @discussion Verify snapshot copying behaviour and compare cost of subscription information reads through
+             resource access queue with reads of atomically published snapshot while heartbeat, state and
+             subscribe threads modify it.
+
+ @author Sergey Mamontov
+ @copyright © 2009-2017 PubNub, Inc.
+ */
+@interface PNSubscriberSnapshotTests : XCTestCase
+
+
+#pragma mark - Properties
+
+/**
+ @brief  Stores reference on snapshot which is published by writer threads.
+ */
+@property (atomic, strong) PNSubscriberSnapshot *snapshot;
+
+/**
+ @brief  Stores reference on lock which is used to serialize snapshot writers.
+ */
+@property (nonatomic, assign) os_unfair_lock snapshotLock;
+
+/**
+ @brief  Stores reference on time token which is guarded by resource access queue.
+ */
+@property (nonatomic, strong) NSNumber *timeToken;
+
+/**
+ @brief  Stores reference on queue which is used to guard \c timeToken access.
+ */
+@property (nonatomic, strong) dispatch_queue_t resourceAccessQueue;
+
+/**
+ @brief  Stores whether writer threads should continue information modification or not.
+ */
+@property (atomic, assign, getter = isWriting) BOOL writing;
+
+/**
+ @brief  Stores reference on group which is used to wait for writer threads completion.
+ */
+@property (nonatomic, strong) dispatch_group_t writersGroup;
+
+
+#pragma mark - Misc
+
+/**
+ @brief  Launch heartbeat, state and subscribe writer threads which modify subscription information.
+
+ @param block Reference on block which should perform single modification.
+ */
+- (void)startWritersWithBlock:(void(^)(NSUInteger iteration))block;
+
+/**
+ @brief  Stop writer threads and wait for their completion.
+ */
+- (void)stopWriters;
+
+#pragma mark -
+
+
+@end
+
+
+#pragma mark - Test case implementation
+
+@implementation PNSubscriberSnapshotTests
+
+- (void)setUp {
+
+    // Forward method call to the super class.
+    [super setUp];
+
+
+    // Prepare 'fixtures'
+    self.snapshot = [PNSubscriberSnapshot snapshot];
+    self.snapshotLock = OS_UNFAIR_LOCK_INIT;
+    self.timeToken = @0;
+    self.resourceAccessQueue = dispatch_queue_create("com.pubnub.tests.subscriber", DISPATCH_QUEUE_CONCURRENT);
+    self.writersGroup = dispatch_group_create();
+}
+
+- (void)testInitialSnapshot {
+
+    PNSubscriberSnapshot *snapshot = [PNSubscriberSnapshot snapshot];
+
+    XCTAssertEqual(snapshot.channels.count, 0, @"Initial snapshot shouldn't have channels.");
+    XCTAssertEqualObjects(snapshot.currentTimeToken, @0, @"Unexpected initial time token.");
+    XCTAssertEqualObjects(snapshot.currentTimeTokenRegion, @(-1), @"Unexpected initial time token region.");
+    XCTAssertNil(snapshot.filterExpression, @"Initial snapshot shouldn't have filter expression.");
+}
+
+- (void)testImmutableCopyReturnSameInstance {
+
+    PNSubscriberSnapshot *snapshot = [PNSubscriberSnapshot snapshot];
+
+    XCTAssertTrue([snapshot copy] == snapshot, @"Immutable snapshot copy should return same instance.");
+}
+
+- (void)testMutableCopyDoesntModifyPublishedSnapshot {
+
+    PNSubscriberSnapshot *snapshot = [PNSubscriberSnapshot snapshot];
+    PNMutableSubscriberSnapshot *mutableSnapshot = [snapshot mutableCopy];
+    mutableSnapshot.channels = [NSSet setWithObject:@"a"];
+    mutableSnapshot.currentTimeToken = @(14893210000000000);
+    PNSubscriberSnapshot *updatedSnapshot = [mutableSnapshot copy];
+
+    XCTAssertEqual(snapshot.channels.count, 0, @"Published snapshot has been modified.");
+    XCTAssertEqualObjects(snapshot.currentTimeToken, @0, @"Published snapshot has been modified.");
+    XCTAssertFalse([updatedSnapshot isKindOfClass:[PNMutableSubscriberSnapshot class]],
+                   @"Copy of mutable snapshot should be immutable.");
+    XCTAssertEqualObjects(updatedSnapshot.channels, [NSSet setWithObject:@"a"], @"Unexpected channels.");
+    XCTAssertEqualObjects(updatedSnapshot.currentTimeToken, @(14893210000000000), @"Unexpected time token.");
+}
+
+- (void)testQueueGuardedReadsPerformanceUnderContention {
+
+    [self startWritersWithBlock:^(NSUInteger iteration) {
+
+        dispatch_barrier_async(self.resourceAccessQueue, ^{ self->_timeToken = @(iteration); });
+    }];
+
+    [self measureBlock:^{
+
+        for (NSUInteger readIdx = 0; readIdx < kPNSubscriberSnapshotTestsReadsCount; readIdx++) {
+
+            __block NSNumber *timeToken = nil;
+            dispatch_sync(self.resourceAccessQueue, ^{ timeToken = self->_timeToken; });
+            XCTAssertNotNil(timeToken);
+        }
+    }];
+
+    [self stopWriters];
+}
+
+- (void)testSnapshotReadsPerformanceUnderContention {
+
+    [self startWritersWithBlock:^(NSUInteger iteration) {
+
+        os_unfair_lock_lock(&self->_snapshotLock);
+        PNMutableSubscriberSnapshot *snapshot = [self.snapshot mutableCopy];
+        snapshot.currentTimeToken = @(iteration);
+        self.snapshot = [snapshot copy];
+        os_unfair_lock_unlock(&self->_snapshotLock);
+    }];
+
+    [self measureBlock:^{
+
+        for (NSUInteger readIdx = 0; readIdx < kPNSubscriberSnapshotTestsReadsCount; readIdx++) {
+
+            XCTAssertNotNil(self.snapshot.currentTimeToken);
+        }
+    }];
+
+    [self stopWriters];
+}
+
+
+#pragma mark - Misc
+
+- (void)startWritersWithBlock:(void(^)(NSUInteger iteration))block {
+
+    self.writing = YES;
+    for (NSString *writer in @[@"heartbeat", @"state", @"subscribe"]) {
+
+        NSString *label = [@"com.pubnub.tests.writer." stringByAppendingString:writer];
+        dispatch_queue_t queue = dispatch_queue_create(label.UTF8String, DISPATCH_QUEUE_SERIAL);
+        dispatch_group_async(self.writersGroup, queue, ^{
+
+            NSUInteger iteration = 0;
+            while (self.isWriting) {
+
+                block(iteration++);
+                usleep(10);
+            }
+        });
+    }
+}
+
+- (void)stopWriters {
+
+    self.writing = NO;
+    dispatch_group_wait(self.writersGroup, DISPATCH_TIME_FOREVER);
+    dispatch_barrier_sync(self.resourceAccessQueue, ^{});
+}
+
+#pragma mark -
+
+
+@end
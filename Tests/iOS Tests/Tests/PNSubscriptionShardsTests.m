@@ -0,0 +1,427 @@
+#import "PNLoopbackClientTestCase.h"
+#import "PubNub+SubscribePrivate.h"
+#import "PubNub+CorePrivate.h"
+#import "PNLoopbackTransport.h"
+#import "PNSubscriber.h"
+#import "PNRetryPolicy.h"
+
+
+#pragma mark Static
+
+/**
+ @brief  Maximum subscribe request URL length which leave \b 100 characters for channels and groups (\b 1024
+         characters reserved by subscriber for rest of URL).
+ */
+static NSUInteger const kPNSubscriptionShardsTestsMaximumURLLength = 1124;
+
+/**
+ @brief  Maximum length of encoded channels and groups names list in single subscribe request.
+ */
+static NSUInteger const kPNSubscriptionShardsTestsMaximumObjectsLength = 100;
+
+
+/**
+ @brief      Subscription sharding testing.
+ @discussion Verify that subscription objects split between few subscribe requests by URL length, shards
+             re-used and removed along with subscription objects list changes, initial subscription restart
+             long-poll requests of all shards and shard errors reported to listeners.
+
+ @author Sergey Mamontov
+ @copyright © 2009-2017 PubNub, Inc.
+ */
+@interface PNSubscriptionShardsTests : PNLoopbackClientTestCase
+
+
+#pragma mark - Properties
+
+/**
+ @brief  Stores list of initial subscribe requests (with \b 0 time token) which has been sent by client.
+ */
+@property (nonatomic, strong) NSMutableArray<NSURLRequest *> *initialRequests;
+
+/**
+ @brief  Stores list of statuses which has been delivered to listener.
+ */
+@property (nonatomic, strong) NSMutableArray<PNStatus *> *statuses;
+
+
+#pragma mark - Misc
+
+/**
+ @brief  Compose list of channel names.
+
+ @param count Number of channels which should be created.
+ @param start Index which should be used with first channel name.
+
+ @return List of channel names.
+ */
+- (NSArray<NSString *> *)channels:(NSUInteger)count startingAt:(NSUInteger)start;
+
+/**
+ @brief  Retrieve list of channels and groups which is used with subscribe request.
+
+ @param request Reference on subscribe request from which objects should be extracted.
+
+ @return List of channels and groups names.
+ */
+- (NSArray<NSString *> *)objectsFromRequest:(NSURLRequest *)request;
+
+/**
+ @brief  Check whether subscribe request sent with \b 0 time token or not.
+
+ @param request Reference on subscribe request which should be checked.
+
+ @return \c YES in case if request send to perform initial subscription.
+ */
+- (BOOL)isInitialRequest:(NSURLRequest *)request;
+
+/**
+ @brief  Retrieve time token which has been used with subscribe request.
+
+ @param request Reference on subscribe request from which time token should be extracted.
+
+ @return Time token string or \c nil in case if request doesn't have it.
+ */
+- (NSString *)timeTokenFromRequest:(NSURLRequest *)request;
+
+/**
+ @brief  Retrieve list of subscription shards which is created by client's subscriber.
+
+ @return List of shard subscribers.
+ */
+- (NSArray<PNSubscriber *> *)shards;
+
+/**
+ @brief  Retrieve number of tasks which currently active in loopback transport.
+
+ @return Number of long-poll requests which wait for response.
+ */
+- (NSUInteger)activeTasksCount;
+
+#pragma mark -
+
+
+@end
+
+
+#pragma mark - Test case implementation
+
+@implementation PNSubscriptionShardsTests
+
+- (void)setUp {
+
+    // Forward method call to the super class.
+    [super setUp];
+
+
+    // Prepare 'fixtures'
+    PNConfiguration *configuration = [PNConfiguration configurationWithPublishKey:@"demo"
+                                                                     subscribeKey:@"demo"];
+    configuration.maximumSubscribeRequestURLLength = kPNSubscriptionShardsTestsMaximumURLLength;
+    self.initialRequests = [NSMutableArray new];
+    self.statuses = [NSMutableArray new];
+    [self createClientWithConfiguration:configuration];
+    [self useLoopbackTransportWithMaximumSubscribeConnections:8];
+    [self.serviceTransport setResponseData:[@"{\"status\":200,\"message\":\"OK\",\"action\":\"leave\"}"
+                                            dataUsingEncoding:NSUTF8StringEncoding]
+                                statusCode:200 forPathPrefix:@"/v2/presence"];
+
+    // Complete only initial subscription, so long-poll requests will wait for events.
+    __weak __typeof(self) weakSelf = self;
+    self.transport.responder = ^(NSURLRequest *request, PNLoopbackTransportRespondBlock respond) {
+
+        if ([weakSelf isInitialRequest:request]) {
+
+            @synchronized (weakSelf.initialRequests) { [weakSelf.initialRequests addObject:request]; }
+            respond(200, [@"{\"t\":{\"t\":\"15000000000000000\",\"r\":4},\"m\":[]}"
+                          dataUsingEncoding:NSUTF8StringEncoding], nil);
+        }
+    };
+}
+
+- (void)testShardingDisabledByDefault {
+
+    PNConfiguration *configuration = [PNConfiguration configurationWithPublishKey:@"demo"
+                                                                     subscribeKey:@"demo"];
+
+    XCTAssertEqual(configuration.maximumSubscribeRequestURLLength, 0,
+                   @"Subscription shouldn't be split unless enabled by user.");
+}
+
+- (void)testObjectsSplitBetweenShardsByURLLength {
+
+    NSArray<NSString *> *channels = [self channels:20 startingAt:0];
+    NSArray<NSString *> *groups = @[@"group-a", @"group-b"];
+    [self.client subscribeToChannels:channels groups:groups withPresence:NO usingTimeToken:nil clientState:nil];
+
+    // Channels and groups names take 11 and 8 characters (with separator), so 9 channels fit into request.
+    XCTAssertTrue([self waitFor:5 condition:^BOOL{ return [self activeTasksCount] == 3; }]);
+    NSMutableSet<NSString *> *objects = [NSMutableSet new];
+    NSUInteger objectsCount = 0;
+    XCTAssertEqual(self.initialRequests.count, 3, @"Each shard should perform initial subscription.");
+    for (NSURLRequest *request in [self.initialRequests copy]) {
+
+        NSArray<NSString *> *requestObjects = [self objectsFromRequest:request];
+        NSUInteger length = [[requestObjects componentsJoinedByString:@","] length] + 1;
+        XCTAssertLessThanOrEqual(length, kPNSubscriptionShardsTestsMaximumObjectsLength,
+                                 @"Subscription objects exceed available URL length.");
+        [objects addObjectsFromArray:requestObjects];
+        objectsCount += requestObjects.count;
+    }
+
+    XCTAssertEqual([self shards].count, 2, @"Unexpected number of shards.");
+    XCTAssertEqual(objectsCount, channels.count + groups.count, @"Object shouldn't be used by few shards.");
+    XCTAssertEqualObjects(objects, [NSSet setWithArray:[channels arrayByAddingObjectsFromArray:groups]],
+                          @"All subscription objects should be used with subscribe requests.");
+    [self waitFor:0.2f condition:^BOOL{ return NO; }];
+    NSUInteger connectedCount = 0;
+    for (PNStatus *status in [self.statuses copy]) { connectedCount += (status.category == PNConnectedCategory); }
+    XCTAssertEqual(connectedCount, 1, @"Shards shouldn't report connection to listeners.");
+}
+
+- (void)testShardsReusedAndRemovedWhenObjectsListChange {
+
+    [self.client subscribeToChannels:[self channels:20 startingAt:0] withPresence:NO];
+    XCTAssertTrue([self waitFor:5 condition:^BOOL{ return [self activeTasksCount] == 3; }]);
+    NSArray<PNSubscriber *> *shards = [self shards];
+
+    [self.client subscribeToChannels:[self channels:1 startingAt:20] withPresence:NO];
+    XCTAssertTrue([self waitFor:5 condition:^BOOL{ return self.initialRequests.count == 6; }]);
+    XCTAssertEqual([self shards].count, shards.count, @"Unexpected number of shards.");
+    XCTAssertTrue([self shards][0] == shards[0] && [self shards][1] == shards[1],
+                  @"Existing shards should be re-used.");
+
+    [self.client unsubscribeFromChannels:[self channels:18 startingAt:0] withPresence:NO];
+    XCTAssertTrue([self waitFor:5 condition:^BOOL{ return [self shards].count == 0; }],
+                  @"Shards should be removed when objects fit into single request.");
+    XCTAssertTrue([self waitFor:5 condition:^BOOL{ return [self activeTasksCount] == 1; }],
+                  @"Long-poll requests of removed shards should be cancelled.");
+    for (PNSubscriber *shard in shards) {
+        XCTAssertEqual([[shard valueForKey:@"allObjects"] count], 0, @"Removed shard shouldn't have objects.");
+    }
+    XCTAssertEqualObjects([NSSet setWithArray:[self objectsFromRequest:self.initialRequests.lastObject]],
+                          [NSSet setWithArray:[self channels:3 startingAt:18]]);
+}
+
+- (void)testShardsKeepObjectsWithDifferentTimeTokens {
+
+    NSMutableArray<NSURLRequest *> *longPollRequests = [NSMutableArray new];
+    __weak __typeof(self) weakSelf = self;
+    self.transport.responder = ^(NSURLRequest *request, PNLoopbackTransportRespondBlock respond) {
+
+        if (![weakSelf isInitialRequest:request]) {
+
+            @synchronized (longPollRequests) { [longPollRequests addObject:request]; }
+            return;
+        }
+
+        // Each shard receive own time token.
+        NSArray<NSString *> *objects = [weakSelf objectsFromRequest:request];
+        NSUInteger shardIdx = ([objects containsObject:@"channel-18"] ? 2 :
+                               ([objects containsObject:@"channel-09"] ? 1 : 0));
+        @synchronized (weakSelf.initialRequests) { [weakSelf.initialRequests addObject:request]; }
+        respond(200, [[NSString stringWithFormat:@"{\"t\":{\"t\":\"1500000000000000%lu\",\"r\":4},\"m\":[]}",
+                       (unsigned long)shardIdx] dataUsingEncoding:NSUTF8StringEncoding], nil);
+    };
+    [self.client subscribeToChannels:[self channels:20 startingAt:0] withPresence:NO];
+    XCTAssertTrue([self waitFor:5 condition:^BOOL{ return longPollRequests.count == 3; }]);
+    NSMutableDictionary<NSString *, NSString *> *timeTokens = [NSMutableDictionary new];
+    for (NSURLRequest *request in [longPollRequests copy]) {
+        for (NSString *object in [self objectsFromRequest:request]) {
+            timeTokens[object] = [self timeTokenFromRequest:request];
+        }
+    }
+    XCTAssertEqual([NSSet setWithArray:timeTokens.allValues].count, 3, @"Shards should use own time tokens.");
+
+    // New channel name sorted between channels of first shard.
+    [self.client subscribeToChannels:@[@"channel-05a"] withPresence:NO];
+    XCTAssertTrue([self waitFor:5 condition:^BOOL{ return longPollRequests.count == 6; }],
+                  @"Each shard should catch up after initial subscription.");
+    NSMutableSet<NSString *> *objects = [NSMutableSet new];
+    for (NSURLRequest *request in [[longPollRequests copy] subarrayWithRange:NSMakeRange(3, 3)]) {
+        for (NSString *object in [self objectsFromRequest:request]) {
+            [objects addObject:object];
+            if (!timeTokens[object]) { continue; }
+            XCTAssertEqualObjects([self timeTokenFromRequest:request], timeTokens[object],
+                                  @"'%@' should catch up from time token of shard which used it before.", object);
+        }
+    }
+    XCTAssertEqual(objects.count, 21, @"All subscription objects should be used with subscribe requests.");
+    XCTAssertTrue([objects containsObject:@"channel-05a"]);
+}
+
+- (void)testInitialSubscribeCancelAllShardsLongPolls {
+
+    [self.client subscribeToChannels:[self channels:20 startingAt:0] withPresence:NO];
+    XCTAssertTrue([self waitFor:5 condition:^BOOL{ return [self activeTasksCount] == 3; }]);
+
+    [self.client subscribeToChannels:[self channels:1 startingAt:20] withPresence:NO];
+    XCTAssertTrue([self waitFor:5 condition:^BOOL{ return self.initialRequests.count == 6; }],
+                  @"Each shard should perform initial subscription.");
+    XCTAssertTrue([self waitFor:5 condition:^BOOL{ return [self activeTasksCount] == 3; }]);
+    [self waitFor:0.2f condition:^BOOL{ return NO; }];
+    XCTAssertEqual([self activeTasksCount], 3, @"Long-poll requests from previous cycle should be cancelled.");
+}
+
+- (void)testShardRetryAfterRetryBudgetExhausted {
+
+    NSError *networkError = [NSError errorWithDomain:NSURLErrorDomain code:NSURLErrorNotConnectedToInternet
+                                            userInfo:nil];
+    __block BOOL shouldFail = NO;
+    __block NSUInteger failedAttempts = 0;
+    __block PNLoopbackTransportRespondBlock longPollRespond = nil;
+    __weak __typeof(self) weakSelf = self;
+    self.transport.responder = ^(NSURLRequest *request, PNLoopbackTransportRespondBlock respond) {
+
+        BOOL isShardRequest = [[weakSelf objectsFromRequest:request] containsObject:@"channel-19"];
+        @synchronized (networkError) {
+            if (isShardRequest && shouldFail && failedAttempts < 4) {
+
+                failedAttempts++;
+                respond(0, nil, networkError);
+                return;
+            }
+            if (isShardRequest && ![weakSelf isInitialRequest:request]) { longPollRespond = respond; }
+        }
+        if ([weakSelf isInitialRequest:request]) {
+
+            @synchronized (weakSelf.initialRequests) { [weakSelf.initialRequests addObject:request]; }
+            respond(200, [@"{\"t\":{\"t\":\"15000000000000000\",\"r\":4},\"m\":[]}"
+                          dataUsingEncoding:NSUTF8StringEncoding], nil);
+        }
+    };
+    [self.client subscribeToChannels:[self channels:20 startingAt:0] withPresence:NO];
+    XCTAssertTrue([self waitFor:5 condition:^BOOL{
+        @synchronized (networkError) { return longPollRespond != nil && [self activeTasksCount] == 3; }
+    }]);
+
+    // Single retry allowed by budget.
+    for (PNSubscriber *shard in [self shards]) {
+        [shard setValue:[PNRetryPolicy policyWithInitialDelay:0.05f maximumDelay:0.1f budget:1]
+                 forKey:@"retryPolicy"];
+    }
+    PNLoopbackTransportRespondBlock respond = nil;
+    @synchronized (networkError) {
+        shouldFail = YES;
+        respond = longPollRespond;
+    }
+    respond(0, nil, networkError);
+
+    XCTAssertTrue([self waitFor:5 condition:^BOOL{
+        @synchronized (networkError) { return failedAttempts == 4 && [self activeTasksCount] == 3; }
+    }], @"Shard should continue retry with maximum delay after retry budget exhausted.");
+}
+
+- (void)testShardErrorReportedToListeners {
+
+    __weak __typeof(self) weakSelf = self;
+    self.transport.responder = ^(NSURLRequest *request, PNLoopbackTransportRespondBlock respond) {
+
+        if (![weakSelf isInitialRequest:request]) { return; }
+        if ([[weakSelf objectsFromRequest:request] containsObject:@"channel-19"]) {
+
+            respond(403, [@"{\"message\":\"Forbidden\",\"payload\":{\"channels\":[\"channel-19\"]},"
+                          "\"error\":true,\"service\":\"Access Manager\",\"status\":403}"
+                          dataUsingEncoding:NSUTF8StringEncoding], nil);
+        } else {
+
+            respond(200, [@"{\"t\":{\"t\":\"15000000000000000\",\"r\":4},\"m\":[]}"
+                          dataUsingEncoding:NSUTF8StringEncoding], nil);
+        }
+    };
+    [self.client subscribeToChannels:[self channels:20 startingAt:0] withPresence:NO];
+
+    __block PNStatus *accessDeniedStatus = nil;
+    XCTAssertTrue([self waitFor:5 condition:^BOOL{
+        for (PNStatus *status in [self.statuses copy]) {
+            if (status.category == PNAccessDeniedCategory) { accessDeniedStatus = status; }
+        }
+        return accessDeniedStatus != nil;
+    }], @"Shard error should be reported to listeners.");
+    XCTAssertTrue([((PNSubscribeStatus *)accessDeniedStatus).subscribedChannels containsObject:@"channel-19"]);
+    XCTAssertFalse([((PNSubscribeStatus *)accessDeniedStatus).subscribedChannels containsObject:@"channel-00"],
+                   @"Status should describe channels from failed shard.");
+}
+
+
+#pragma mark - Listener
+
+- (void)client:(PubNub *)client didReceiveStatus:(PNStatus *)status {
+
+    @synchronized (self.statuses) { [self.statuses addObject:status]; }
+}
+
+
+#pragma mark - Misc
+
+- (NSArray<NSString *> *)channels:(NSUInteger)count startingAt:(NSUInteger)start {
+
+    NSMutableArray<NSString *> *channels = [NSMutableArray new];
+    for (NSUInteger channelIdx = start; channelIdx < start + count; channelIdx++) {
+        [channels addObject:[NSString stringWithFormat:@"channel-%02lu", (unsigned long)channelIdx]];
+    }
+
+    return channels;
+}
+
+- (NSArray<NSString *> *)objectsFromRequest:(NSURLRequest *)request {
+
+    NSMutableArray<NSString *> *objects = [NSMutableArray new];
+    NSString *channels = request.URL.pathComponents[4];
+    if (![channels isEqualToString:@","]) {
+        [objects addObjectsFromArray:[channels componentsSeparatedByString:@","]];
+    }
+
+    NSURLComponents *components = [NSURLComponents componentsWithURL:request.URL resolvingAgainstBaseURL:NO];
+    for (NSURLQueryItem *item in components.queryItems) {
+        if ([item.name isEqualToString:@"channel-group"]) {
+            [objects addObjectsFromArray:[item.value componentsSeparatedByString:@","]];
+        }
+    }
+
+    return objects;
+}
+
+- (BOOL)isInitialRequest:(NSURLRequest *)request {
+
+    NSURLComponents *components = [NSURLComponents componentsWithURL:request.URL resolvingAgainstBaseURL:NO];
+    for (NSURLQueryItem *item in components.queryItems) {
+        if ([item.name isEqualToString:@"tt"]) { return [item.value isEqualToString:@"0"]; }
+    }
+
+    return YES;
+}
+
+- (NSString *)timeTokenFromRequest:(NSURLRequest *)request {
+
+    NSURLComponents *components = [NSURLComponents componentsWithURL:request.URL resolvingAgainstBaseURL:NO];
+    for (NSURLQueryItem *item in components.queryItems) {
+        if ([item.name isEqualToString:@"tt"]) { return item.value; }
+    }
+
+    return nil;
+}
+
+- (NSArray<PNSubscriber *> *)shards {
+
+    return [[self.client.subscriberManager valueForKey:@"shards"] copy];
+}
+
+- (NSUInteger)activeTasksCount {
+
+    __block NSUInteger count = 0;
+    dispatch_semaphore_t semaphore = dispatch_semaphore_create(0);
+    [self.transport getTasksWithCompletion:^(NSArray<id <PNTransportTask>> *tasks) {
+
+        count = tasks.count;
+        dispatch_semaphore_signal(semaphore);
+    }];
+    dispatch_semaphore_wait(semaphore, dispatch_time(DISPATCH_TIME_NOW, (int64_t)(5 * NSEC_PER_SEC)));
+
+    return count;
+}
+
+#pragma mark -
+
+
+@end